@@ -172,19 +172,23 @@ if test "$PHP_V8" != "no"; then
     src/php_v8_exceptions.cc                              \
     src/php_v8_callbacks.cc                               \
     src/php_v8_startup_data.cc                            \
+    src/php_v8_mapped_file.cc                             \
     src/php_v8_heap_statistics.cc                         \
     src/php_v8_isolate.cc                                 \
     src/php_v8_isolate_limits.cc                          \
+    src/php_v8_isolate_pool.cc                            \
     src/php_v8_context.cc                                 \
     src/php_v8_object_template.cc                         \
     src/php_v8_function_template.cc                       \
     src/php_v8_script.cc                                  \
     src/php_v8_unbound_script.cc                          \
     src/php_v8_cached_data.cc                             \
+    src/php_v8_code_cache.cc                              \
     src/php_v8_script_compiler.cc                         \
     src/php_v8_source.cc                                  \
     src/php_v8_data.cc                                    \
     src/php_v8_value.cc                                   \
+    src/php_v8_value_converter.cc                         \
     src/php_v8_primitive.cc                               \
     src/php_v8_undefined.cc                               \
     src/php_v8_null.cc                                    \
@@ -206,10 +210,16 @@ if test "$PHP_V8" != "no"; then
     src/php_v8_promise.cc                                 \
     src/php_v8_promise_resolver.cc                        \
     src/php_v8_proxy.cc                                   \
+    src/php_v8_array_buffer.cc                            \
+    src/php_v8_array_buffer_allocator.cc                  \
+    src/php_v8_array_buffer_view.cc                       \
+    src/php_v8_typed_array.cc                             \
+    src/php_v8_data_view.cc                               \
     src/php_v8_number_object.cc                           \
     src/php_v8_boolean_object.cc                          \
     src/php_v8_string_object.cc                           \
     src/php_v8_symbol_object.cc                           \
+    src/php_v8_prepared_call.cc                           \
     src/php_v8_template.cc                                \
     src/php_v8_return_value.cc                            \
     src/php_v8_callback_info_interface.cc                 \
@@ -218,6 +228,9 @@ if test "$PHP_V8" != "no"; then
     src/php_v8_named_property_handler_configuration.cc    \
     src/php_v8_indexed_property_handler_configuration.cc  \
     src/php_v8_json.cc                                    \
+    src/php_v8_serializer.cc                              \
+    src/php_v8_deserializer.cc                            \
+    src/php_v8_wire_format.cc                             \
   ], $ext_shared, , -DZEND_ENABLE_STATIC_TSRMLS_CACHE=1)
 
   PHP_ADD_BUILD_DIR($ext_builddir/src)
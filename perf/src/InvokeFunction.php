@@ -16,9 +16,17 @@
 namespace PhpV8\V8\Tests\Perf;
 
 
+use V8\CallbackFlags;
+use V8\ConstructorBehavior;
 use V8\Context;
+use V8\FunctionCallbackInfo;
 use V8\FunctionObject;
 use V8\Isolate;
+use V8\NumberValue;
+use V8\PreparedCall;
+use V8\Script;
+use V8\StringValue;
+use V8\Value;
 
 
 /**
@@ -48,6 +56,36 @@ class InvokeFunction
 
     private $stub_callback;
 
+    /**
+     * @var FunctionObject
+     */
+    private $js_fnc;
+
+    /**
+     * @var Value[]
+     */
+    private $arguments;
+
+    /**
+     * @var PreparedCall
+     */
+    private $prepared_call;
+
+    /**
+     * @var array[]
+     */
+    private $arg_lists;
+
+    /**
+     * @var FunctionObject
+     */
+    private $return_value_fnc;
+
+    /**
+     * @var FunctionObject
+     */
+    private $direct_return_fnc;
+
     public function init()
     {
         $this->isolate = $isolate = new Isolate();
@@ -66,6 +104,27 @@ class InvokeFunction
 
         $this->stub_callback = function () {
         };
+
+        $source = 'function sum(a, b, c, d) { return a + b + c + d; }; sum';
+        $this->js_fnc = (new Script($context, new StringValue($isolate, $source)))->run($context);
+
+        $this->arguments = [
+            new NumberValue($isolate, 1),
+            new NumberValue($isolate, 2),
+            new NumberValue($isolate, 3),
+            new NumberValue($isolate, 4),
+        ];
+
+        $this->prepared_call = new PreparedCall($context, $this->js_fnc, $this->js_fnc);
+        $this->arg_lists = array_fill(0, 100, [1, 2, 3, 4]);
+
+        $this->return_value_fnc = new FunctionObject($context, function (FunctionCallbackInfo $info) {
+            $info->getReturnValue()->set(new StringValue($info->getIsolate(), 'result'));
+        });
+
+        $this->direct_return_fnc = new FunctionObject($context, function (FunctionCallbackInfo $info) {
+            return 'result';
+        }, 0, ConstructorBehavior::ALLOW, CallbackFlags::DIRECT_RETURN);
     }
 
     public function benchOutsideContext()
@@ -86,4 +145,39 @@ class InvokeFunction
 
         $this->callback = $this->stub_callback;
     }
+
+    public function benchJsFunctionWithValueArguments()
+    {
+        $this->js_fnc->call($this->context, $this->js_fnc, $this->arguments);
+    }
+
+    public function benchJsFunctionWithVariadicValueArguments()
+    {
+        $this->js_fnc->callArgs($this->context, $this->js_fnc, ...$this->arguments);
+    }
+
+    public function benchJsFunctionWithScalarArguments()
+    {
+        $this->js_fnc->callArgs($this->context, $this->js_fnc, 1, 2, 3, 4);
+    }
+
+    public function benchPreparedCallWithScalarArguments()
+    {
+        $this->prepared_call->invoke(1, 2, 3, 4);
+    }
+
+    public function benchPreparedCallBatchOf100()
+    {
+        $this->prepared_call->invokeBatch($this->arg_lists);
+    }
+
+    public function benchPhpCallbackSetsReturnValue()
+    {
+        $this->return_value_fnc->callArgs($this->context, $this->return_value_fnc);
+    }
+
+    public function benchPhpCallbackWithDirectReturn()
+    {
+        $this->direct_return_fnc->callArgs($this->context, $this->direct_return_fnc);
+    }
 }
@@ -0,0 +1,128 @@
+<?php declare(strict_types=1);
+
+/**
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+
+namespace PhpV8\V8\Tests\Perf;
+
+
+use V8\ArrayObject;
+use V8\Context;
+use V8\FunctionObject;
+use V8\Int32Value;
+use V8\Isolate;
+use V8\ObjectValue;
+use V8\Script;
+use V8\StringValue;
+
+
+/**
+ * Cost of passing js objects to php (finding existing wrapper or creating new one) and its impact on js code that
+ * works with objects that crossed the boundary.
+ *
+ * Compare results of the same benchmark on builds before and after changes to wrapper lookup.
+ *
+ * @Warmup(2)
+ * @Revs(100)
+ * @Iterations(10)
+ * @BeforeMethods("init")
+ */
+class ObjectWrapperLookup
+{
+    const ITEMS = 1000;
+
+    /**
+     * @var Isolate
+     */
+    private $isolate;
+    /**
+     * @var Context
+     */
+    private $context;
+    /**
+     * @var ArrayObject
+     */
+    private $items;
+    /**
+     * @var ObjectValue[]
+     */
+    private $wrappers = [];
+    /**
+     * @var Int32Value[]
+     */
+    private $indexes = [];
+    /**
+     * @var FunctionObject
+     */
+    private $sum;
+
+    public function init()
+    {
+        $this->isolate = $isolate = new Isolate();
+        $this->context = $context = new Context($isolate);
+
+        $source = '
+            var items = [];
+            for (var i = 0; i < ' . self::ITEMS . '; i++) {
+                items.push({id: i, value: i * 2});
+            }
+
+            var fresh = [];
+            for (var i = 0; i < ' . self::ITEMS . '; i++) {
+                fresh.push({id: i, value: i * 2});
+            }
+
+            function sum(list) {
+                var total = 0;
+                for (var i = 0; i < list.length; i++) {
+                    total += list[i].id + list[i].value;
+                }
+                return total;
+            }
+        ';
+
+        (new Script($context, new StringValue($isolate, $source)))->run($context);
+
+        $global = $context->globalObject();
+
+        $this->items = $global->get($context, new StringValue($isolate, 'items'));
+        $this->sum = $global->get($context, new StringValue($isolate, 'sum'));
+
+        for ($i = 0; $i < self::ITEMS; $i++) {
+            $this->indexes[] = $index = new Int32Value($isolate, $i);
+            // objects that crossed the boundary and stay referenced from php
+            $this->wrappers[] = $this->items->get($context, $index);
+        }
+    }
+
+    public function benchGetExistingWrappers()
+    {
+        foreach ($this->indexes as $index) {
+            $this->items->get($this->context, $index);
+        }
+    }
+
+    public function benchCreateNewWrappers()
+    {
+        $fresh = $this->context->globalObject()->get($this->context, new StringValue($this->isolate, 'fresh'));
+
+        foreach ($this->indexes as $index) {
+            $fresh->get($this->context, $index);
+        }
+    }
+
+    public function benchJsOverCrossedObjects()
+    {
+        $this->sum->call($this->context, $this->sum, [$this->items]);
+    }
+}
@@ -19,6 +19,8 @@
 
 #include <v8-version.h>
 #include <v8.h>
+#include <map>
+#include <string>
 
 extern "C" {
 #include "php.h"
@@ -56,9 +58,23 @@ extern zend_module_entry php_v8_module_entry;
 #endif
 
 
+namespace phpv8 {
+    class IsolatePool;
+    class StartupData;
+    class PersistentCachedData;
+
+    typedef std::map<std::string, IsolatePool *> IsolatePools;
+    typedef std::map<std::string, StartupData *> PersistentStartupDataStore;
+    typedef std::map<std::string, PersistentCachedData *> PersistentCachedDataStore;
+}
+
 ZEND_BEGIN_MODULE_GLOBALS(v8)
     bool v8_initialized;
     v8::Platform *platform;
+    phpv8::IsolatePools *isolate_pools;
+    phpv8::PersistentStartupDataStore *persistent_startup_data;
+    phpv8::PersistentCachedDataStore *persistent_cached_data;
+    zval code_cache_store;
 ZEND_END_MODULE_GLOBALS(v8)
 
 #define PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(name, return_reference, required_num_args, classname, allow_null) \
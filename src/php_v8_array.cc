@@ -45,7 +45,7 @@ static PHP_METHOD(Array, __construct) {
 
     php_v8_object_store_self_ptr(php_v8_value, local_array);
 
-    php_v8_value->persistent->Reset(isolate, local_array);
+    php_v8_value->persistent.Reset(isolate, local_array);
 }
 
 static PHP_METHOD(Array, length) {
@@ -0,0 +1,189 @@
+/*
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "php_v8_array_buffer.h"
+#include "php_v8_object.h"
+#include "php_v8_context.h"
+#include "php_v8_value.h"
+#include "php_v8_callbacks.h"
+#include "php_v8.h"
+
+zend_class_entry *php_v8_array_buffer_class_entry;
+#define this_ce php_v8_array_buffer_class_entry
+
+
+void php_v8_array_buffer_get_contents(zval *return_value, v8::Local<v8::ArrayBuffer> local_buffer, size_t byte_offset, size_t byte_length) {
+    if (!byte_length) {
+        RETURN_EMPTY_STRING();
+    }
+
+    // Always a copy: buffer memory stays writable from js, while php strings are immutable
+    RETURN_STRINGL(static_cast<char *>(local_buffer->GetContents().Data()) + byte_offset, byte_length);
+}
+
+
+static PHP_METHOD(ArrayBuffer, __construct) {
+    zval rv;
+    zval *php_v8_context_zv;
+    zend_long byte_length = 0;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "o|l", &php_v8_context_zv, &byte_length) == FAILURE) {
+        return;
+    }
+
+    if (byte_length < 0 || static_cast<size_t>(byte_length) > v8::TypedArray::kMaxLength) {
+        PHP_V8_THROW_VALUE_EXCEPTION("Byte length is out of range");
+        return;
+    }
+
+    PHP_V8_OBJECT_CONSTRUCT(getThis(), php_v8_context_zv, php_v8_context, php_v8_value);
+
+    // v8 treats failed allocation of buffer created through api as fatal OOM, so memory limit is checked up front
+    if (!php_v8_isolate_limits_fits_array_buffer(php_v8_context->php_v8_isolate, static_cast<size_t>(byte_length))) {
+        PHP_V8_THROW_EXCEPTION_WHEN_LIMITS_HIT(php_v8_context);
+    }
+
+    v8::Local<v8::ArrayBuffer> local_buffer = v8::ArrayBuffer::New(isolate, static_cast<size_t>(byte_length));
+
+    PHP_V8_THROW_VALUE_EXCEPTION_WHEN_EMPTY(local_buffer, "Failed to create ArrayBuffer value");
+
+    php_v8_object_store_self_ptr(php_v8_value, local_buffer);
+
+    php_v8_value->persistent.Reset(isolate, local_buffer);
+}
+
+static PHP_METHOD(ArrayBuffer, fromString) {
+    zval *php_v8_context_zv;
+    zend_string *data;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "oS", &php_v8_context_zv, &data) == FAILURE) {
+        return;
+    }
+
+    if (ZSTR_LEN(data) > v8::TypedArray::kMaxLength) {
+        PHP_V8_THROW_VALUE_EXCEPTION("Byte length is out of range");
+        return;
+    }
+
+    PHP_V8_CONTEXT_FETCH_WITH_CHECK(php_v8_context_zv, php_v8_context);
+
+    PHP_V8_ENTER_STORED_ISOLATE(php_v8_context);
+    PHP_V8_ENTER_CONTEXT(php_v8_context);
+
+    v8::Local<v8::ArrayBuffer> local_buffer;
+
+    // Only string nobody else refers to is handed over to js, as js writes would be seen through every other
+    // reference to it, including hash table keys. Interned strings may also live in read-only shared memory.
+    bool is_zero_copy = !ZSTR_IS_INTERNED(data) && GC_REFCOUNT(data) == 1;
+
+    if (is_zero_copy) {
+        local_buffer = v8::ArrayBuffer::New(isolate, ZSTR_VAL(data), ZSTR_LEN(data), v8::ArrayBufferCreationMode::kExternalized);
+    } else {
+        if (!php_v8_isolate_limits_fits_array_buffer(php_v8_context->php_v8_isolate, ZSTR_LEN(data))) {
+            PHP_V8_THROW_EXCEPTION_WHEN_LIMITS_HIT(php_v8_context);
+        }
+
+        local_buffer = v8::ArrayBuffer::New(isolate, ZSTR_LEN(data));
+    }
+
+    PHP_V8_THROW_VALUE_EXCEPTION_WHEN_EMPTY(local_buffer, "Failed to create ArrayBuffer value");
+
+    if (!is_zero_copy && ZSTR_LEN(data)) {
+        memcpy(local_buffer->GetContents().Data(), ZSTR_VAL(data), ZSTR_LEN(data));
+    }
+
+    php_v8_value_t *php_v8_value = php_v8_get_or_create_value(return_value, local_buffer, php_v8_context->php_v8_isolate);
+
+    if (is_zero_copy) {
+        // string stays alive while wrapper exists and, after it gone, while js buffer is not garbage collected
+        php_v8_value_get_persistent_data(php_v8_value)->pin(data);
+    }
+}
+
+static PHP_METHOD(ArrayBuffer, byteLength) {
+    if (zend_parse_parameters_none() == FAILURE) {
+        return;
+    }
+
+    PHP_V8_VALUE_FETCH_WITH_CHECK(getThis(), php_v8_value);
+    PHP_V8_ENTER_STORED_ISOLATE(php_v8_value);
+
+    RETURN_LONG(static_cast<zend_long>(php_v8_value_get_local_as<v8::ArrayBuffer>(php_v8_value)->ByteLength()));
+}
+
+static PHP_METHOD(ArrayBuffer, isExternal) {
+    if (zend_parse_parameters_none() == FAILURE) {
+        return;
+    }
+
+    PHP_V8_VALUE_FETCH_WITH_CHECK(getThis(), php_v8_value);
+    PHP_V8_ENTER_STORED_ISOLATE(php_v8_value);
+
+    RETURN_BOOL(php_v8_value_get_local_as<v8::ArrayBuffer>(php_v8_value)->IsExternal());
+}
+
+static PHP_METHOD(ArrayBuffer, getContents) {
+    if (zend_parse_parameters_none() == FAILURE) {
+        return;
+    }
+
+    PHP_V8_VALUE_FETCH_WITH_CHECK(getThis(), php_v8_value);
+    PHP_V8_ENTER_STORED_ISOLATE(php_v8_value);
+
+    v8::Local<v8::ArrayBuffer> local_buffer = php_v8_value_get_local_as<v8::ArrayBuffer>(php_v8_value);
+
+    php_v8_array_buffer_get_contents(return_value, local_buffer, 0, local_buffer->ByteLength());
+}
+
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_CONSTRUCTOR_INFO_EX(arginfo___construct, 1)
+                ZEND_ARG_OBJ_INFO(0, context, V8\\Context, 0)
+                ZEND_ARG_TYPE_INFO(0, byte_length, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_fromString, ZEND_RETURN_VALUE, 2, V8\\ArrayBufferObject, 0)
+                ZEND_ARG_OBJ_INFO(0, context, V8\\Context, 0)
+                ZEND_ARG_TYPE_INFO(0, data, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_byteLength, ZEND_RETURN_VALUE, 0, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_isExternal, ZEND_RETURN_VALUE, 0, _IS_BOOL, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_getContents, ZEND_RETURN_VALUE, 0, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
+
+static const zend_function_entry php_v8_array_buffer_methods[] = {
+        PHP_V8_ME(ArrayBuffer, __construct, ZEND_ACC_PUBLIC | ZEND_ACC_CTOR)
+        PHP_V8_ME(ArrayBuffer, fromString,  ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+        PHP_V8_ME(ArrayBuffer, byteLength,  ZEND_ACC_PUBLIC)
+        PHP_V8_ME(ArrayBuffer, isExternal,  ZEND_ACC_PUBLIC)
+        PHP_V8_ME(ArrayBuffer, getContents, ZEND_ACC_PUBLIC)
+
+        PHP_FE_END
+};
+
+
+PHP_MINIT_FUNCTION(php_v8_array_buffer) {
+    zend_class_entry ce;
+    INIT_NS_CLASS_ENTRY(ce, PHP_V8_NS, "ArrayBufferObject", php_v8_array_buffer_methods);
+    this_ce = zend_register_internal_class_ex(&ce, php_v8_object_class_entry);
+
+    return SUCCESS;
+}
@@ -0,0 +1,33 @@
+/*
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+#ifndef PHP_V8_ARRAY_BUFFER_H
+#define PHP_V8_ARRAY_BUFFER_H
+
+#include "php_v8_value.h"
+#include <v8.h>
+
+extern "C" {
+#include "php.h"
+
+#ifdef ZTS
+#include "TSRM.h"
+#endif
+}
+
+extern zend_class_entry* php_v8_array_buffer_class_entry;
+
+extern void php_v8_array_buffer_get_contents(zval *return_value, v8::Local<v8::ArrayBuffer> local_buffer, size_t byte_offset, size_t byte_length);
+
+PHP_MINIT_FUNCTION(php_v8_array_buffer);
+
+#endif //PHP_V8_ARRAY_BUFFER_H
@@ -0,0 +1,146 @@
+/*
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "php_v8_array_buffer_allocator.h"
+#include "php_v8_isolate_limits.h"
+#include "php_v8_isolate.h"
+
+#include <cstdlib>
+#include <cstring>
+
+
+static inline int php_v8_array_buffer_allocator_size_class(size_t length) {
+    int size_class = 0;
+    size_t size = static_cast<size_t>(1) << PHP_V8_ARRAY_BUFFER_ALLOCATOR_MIN_SIZE_SHIFT;
+
+    while (size < length) {
+        if (++size_class == PHP_V8_ARRAY_BUFFER_ALLOCATOR_SIZE_CLASSES) {
+            return -1;
+        }
+
+        size <<= 1;
+    }
+
+    return size_class;
+}
+
+static inline size_t php_v8_array_buffer_allocator_class_size(int size_class) {
+    return static_cast<size_t>(1) << (PHP_V8_ARRAY_BUFFER_ALLOCATOR_MIN_SIZE_SHIFT + size_class);
+}
+
+
+namespace phpv8 {
+    ArrayBufferAllocator::~ArrayBufferAllocator() {
+        for (auto &free_list : free_lists) {
+            for (auto const &block : free_list) {
+                free(block);
+            }
+        }
+    }
+
+    void *ArrayBufferAllocator::Allocate(size_t length) {
+        return allocate(length, true);
+    }
+
+    void *ArrayBufferAllocator::AllocateUninitialized(size_t length) {
+        return allocate(length, false);
+    }
+
+    void ArrayBufferAllocator::Free(void *data, size_t length) {
+        if (!data) {
+            return;
+        }
+
+        allocated_size.fetch_sub(length, std::memory_order_relaxed);
+
+        int size_class = php_v8_array_buffer_allocator_size_class(length);
+
+        if (size_class >= 0) {
+            size_t size = php_v8_array_buffer_allocator_class_size(size_class);
+
+            std::lock_guard<std::mutex> lock(mutex);
+
+            if (pooled_size + size <= PHP_V8_ARRAY_BUFFER_ALLOCATOR_MAX_POOLED_SIZE) {
+                free_lists[size_class].push_back(data);
+                pooled_size += size;
+                return;
+            }
+        }
+
+        free(data);
+    }
+
+    void ArrayBufferAllocator::bind(php_v8_isolate_t *php_v8_isolate) {
+        // peak is reported for the current owner only, pooled isolate may have served bigger requests before
+        peak_allocated_size.store(allocatedSize(), std::memory_order_relaxed);
+        owner.store(php_v8_isolate);
+    }
+
+    void ArrayBufferAllocator::unbind() {
+        owner.store(nullptr);
+    }
+
+    void *ArrayBufferAllocator::allocate(size_t length, bool initialize) {
+        php_v8_isolate_t *php_v8_isolate = owner.load();
+
+        if (php_v8_isolate && !php_v8_isolate_limits_fits_array_buffer(php_v8_isolate, length)) {
+            // v8 throws RangeError on failed allocation, though it is superseded by execution termination
+            return nullptr;
+        }
+
+        void *data = nullptr;
+        int size_class = php_v8_array_buffer_allocator_size_class(length);
+
+        if (size_class >= 0) {
+            size_t size = php_v8_array_buffer_allocator_class_size(size_class);
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+
+                if (!free_lists[size_class].empty()) {
+                    data = free_lists[size_class].back();
+                    free_lists[size_class].pop_back();
+                    pooled_size -= size;
+                }
+            }
+
+            if (data) {
+                if (initialize) {
+                    memset(data, 0, length);
+                }
+            } else {
+                // whole size class is allocated so that block can serve any buffer of the same class once freed
+                data = initialize ? calloc(size, 1) : malloc(size);
+            }
+        } else {
+            data = initialize ? calloc(length, 1) : malloc(length);
+        }
+
+        if (data) {
+            account(length);
+        }
+
+        return data;
+    }
+
+    void ArrayBufferAllocator::account(size_t length) {
+        size_t allocated = allocated_size.fetch_add(length, std::memory_order_relaxed) + length;
+        size_t peak = peak_allocated_size.load(std::memory_order_relaxed);
+
+        while (allocated > peak && !peak_allocated_size.compare_exchange_weak(peak, allocated, std::memory_order_relaxed)) {
+        }
+    }
+}
@@ -0,0 +1,91 @@
+/*
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+#ifndef PHP_V8_ARRAY_BUFFER_ALLOCATOR_H
+#define PHP_V8_ARRAY_BUFFER_ALLOCATOR_H
+
+namespace phpv8 {
+    class ArrayBufferAllocator;
+}
+
+#include "php_v8_isolate.h"
+#include <v8.h>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+extern "C" {
+#include "php.h"
+
+#ifdef ZTS
+#include "TSRM.h"
+#endif
+}
+
+// smallest size class is 64 bytes, largest one is 64 << (PHP_V8_ARRAY_BUFFER_ALLOCATOR_SIZE_CLASSES - 1) = 64kb
+#define PHP_V8_ARRAY_BUFFER_ALLOCATOR_MIN_SIZE_SHIFT 6
+#define PHP_V8_ARRAY_BUFFER_ALLOCATOR_SIZE_CLASSES 11
+#define PHP_V8_ARRAY_BUFFER_ALLOCATOR_MAX_POOLED_SIZE (4 * 1024 * 1024)
+
+
+namespace phpv8 {
+
+    /**
+     * ArrayBuffer backing store allocator, one per isolate.
+     *
+     * It lives in isolate create params, so it outlives V8\Isolate object when isolate goes back to isolate pool,
+     * together with blocks it keeps in its free lists. Small blocks are rounded up to power-of-two size classes
+     * and freed ones are kept for reuse, up to PHP_V8_ARRAY_BUFFER_ALLOCATOR_MAX_POOLED_SIZE bytes in total, larger
+     * ones go straight to the system allocator.
+     *
+     * While isolate is owned by V8\Isolate object, allocator is bound to it to enforce isolate memory limit on
+     * buffers allocation.
+     */
+    class ArrayBufferAllocator : public v8::ArrayBuffer::Allocator {
+    public:
+        ~ArrayBufferAllocator() override;
+
+        void *Allocate(size_t length) override;
+        void *AllocateUninitialized(size_t length) override;
+        void Free(void *data, size_t length) override;
+
+        void bind(php_v8_isolate_t *php_v8_isolate);
+        void unbind();
+
+        inline size_t allocatedSize() {
+            return allocated_size.load(std::memory_order_relaxed);
+        }
+
+        inline size_t peakAllocatedSize() {
+            return peak_allocated_size.load(std::memory_order_relaxed);
+        }
+
+        inline size_t pooledSize() {
+            std::lock_guard<std::mutex> lock(mutex);
+            return pooled_size;
+        }
+    private:
+        void *allocate(size_t length, bool initialize);
+        void account(size_t length);
+
+        std::atomic<php_v8_isolate_t *> owner{nullptr};
+        std::atomic<size_t> allocated_size{0};
+        std::atomic<size_t> peak_allocated_size{0};
+
+        // buffers may be freed from GC background threads, so free lists are guarded
+        std::mutex mutex;
+        std::vector<void *> free_lists[PHP_V8_ARRAY_BUFFER_ALLOCATOR_SIZE_CLASSES];
+        size_t pooled_size = 0;
+    };
+}
+
+#endif //PHP_V8_ARRAY_BUFFER_ALLOCATOR_H
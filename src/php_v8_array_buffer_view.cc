@@ -0,0 +1,177 @@
+/*
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "php_v8_array_buffer_view.h"
+#include "php_v8_array_buffer.h"
+#include "php_v8_exceptions.h"
+#include "php_v8_object.h"
+#include "php_v8_value.h"
+#include "php_v8.h"
+
+zend_class_entry *php_v8_array_buffer_view_class_entry;
+#define this_ce php_v8_array_buffer_view_class_entry
+
+
+bool php_v8_array_buffer_view_check_range(v8::Local<v8::ArrayBuffer> local_buffer, zend_long byte_offset, zend_long *length, bool length_is_null, size_t element_size) {
+    size_t buffer_length = local_buffer->ByteLength();
+
+    if (byte_offset < 0 || static_cast<size_t>(byte_offset) > buffer_length) {
+        PHP_V8_THROW_VALUE_EXCEPTION("Byte offset is out of range");
+        return false;
+    }
+
+    if (static_cast<size_t>(byte_offset) % element_size) {
+        zend_throw_exception_ex(php_v8_value_exception_class_entry, 0, "Byte offset should be a multiple of %zu", element_size);
+        return false;
+    }
+
+    size_t available = buffer_length - static_cast<size_t>(byte_offset);
+
+    if (length_is_null) {
+        if (available % element_size) {
+            zend_throw_exception_ex(php_v8_value_exception_class_entry, 0, "Byte length of buffer should be a multiple of %zu", element_size);
+            return false;
+        }
+
+        *length = static_cast<zend_long>(available / element_size);
+
+        return true;
+    }
+
+    if (*length < 0 || static_cast<size_t>(*length) > available / element_size) {
+        PHP_V8_THROW_VALUE_EXCEPTION("Length is out of range");
+        return false;
+    }
+
+    return true;
+}
+
+
+static PHP_METHOD(ArrayBufferView, buffer) {
+    if (zend_parse_parameters_none() == FAILURE) {
+        return;
+    }
+
+    PHP_V8_VALUE_FETCH_WITH_CHECK(getThis(), php_v8_value);
+    PHP_V8_ENTER_STORED_ISOLATE(php_v8_value);
+    PHP_V8_ENTER_STORED_CONTEXT(php_v8_value);
+
+    v8::Local<v8::ArrayBufferView> local_view = php_v8_value_get_local_as<v8::ArrayBufferView>(php_v8_value);
+
+    // view which still keeps its data on heap gets it copied out through our allocator, and v8 treats failed
+    // allocation there as fatal OOM, so memory limit is checked up front
+    if (!local_view->HasBuffer() && !php_v8_isolate_limits_fits_array_buffer(php_v8_value->php_v8_isolate, local_view->ByteLength())) {
+        PHP_V8_THROW_EXCEPTION_WHEN_LIMITS_HIT(php_v8_value->php_v8_context);
+    }
+
+    v8::Local<v8::ArrayBuffer> local_buffer = local_view->Buffer();
+
+    php_v8_get_or_create_value(return_value, local_buffer, php_v8_value->php_v8_isolate);
+}
+
+static PHP_METHOD(ArrayBufferView, byteOffset) {
+    if (zend_parse_parameters_none() == FAILURE) {
+        return;
+    }
+
+    PHP_V8_VALUE_FETCH_WITH_CHECK(getThis(), php_v8_value);
+    PHP_V8_ENTER_STORED_ISOLATE(php_v8_value);
+
+    RETURN_LONG(static_cast<zend_long>(php_v8_value_get_local_as<v8::ArrayBufferView>(php_v8_value)->ByteOffset()));
+}
+
+static PHP_METHOD(ArrayBufferView, byteLength) {
+    if (zend_parse_parameters_none() == FAILURE) {
+        return;
+    }
+
+    PHP_V8_VALUE_FETCH_WITH_CHECK(getThis(), php_v8_value);
+    PHP_V8_ENTER_STORED_ISOLATE(php_v8_value);
+
+    RETURN_LONG(static_cast<zend_long>(php_v8_value_get_local_as<v8::ArrayBufferView>(php_v8_value)->ByteLength()));
+}
+
+static PHP_METHOD(ArrayBufferView, hasBuffer) {
+    if (zend_parse_parameters_none() == FAILURE) {
+        return;
+    }
+
+    PHP_V8_VALUE_FETCH_WITH_CHECK(getThis(), php_v8_value);
+    PHP_V8_ENTER_STORED_ISOLATE(php_v8_value);
+
+    RETURN_BOOL(php_v8_value_get_local_as<v8::ArrayBufferView>(php_v8_value)->HasBuffer());
+}
+
+static PHP_METHOD(ArrayBufferView, getContents) {
+    if (zend_parse_parameters_none() == FAILURE) {
+        return;
+    }
+
+    PHP_V8_VALUE_FETCH_WITH_CHECK(getThis(), php_v8_value);
+    PHP_V8_ENTER_STORED_ISOLATE(php_v8_value);
+
+    v8::Local<v8::ArrayBufferView> local_view = php_v8_value_get_local_as<v8::ArrayBufferView>(php_v8_value);
+    size_t byte_length = local_view->ByteLength();
+
+    if (local_view->HasBuffer()) {
+        php_v8_array_buffer_get_contents(return_value, local_view->Buffer(), local_view->ByteOffset(), byte_length);
+        return;
+    }
+
+    // Small views created by js keep their data on v8 heap, so we copy it without materializing buffer
+    zend_string *contents = zend_string_alloc(byte_length, 0);
+    local_view->CopyContents(ZSTR_VAL(contents), byte_length);
+    ZSTR_VAL(contents)[byte_length] = '\0';
+
+    RETURN_NEW_STR(contents);
+}
+
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_buffer, ZEND_RETURN_VALUE, 0, V8\\ArrayBufferObject, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_byteOffset, ZEND_RETURN_VALUE, 0, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_byteLength, ZEND_RETURN_VALUE, 0, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_hasBuffer, ZEND_RETURN_VALUE, 0, _IS_BOOL, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_getContents, ZEND_RETURN_VALUE, 0, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
+
+static const zend_function_entry php_v8_array_buffer_view_methods[] = {
+        PHP_V8_ME(ArrayBufferView, buffer,      ZEND_ACC_PUBLIC)
+        PHP_V8_ME(ArrayBufferView, byteOffset,  ZEND_ACC_PUBLIC)
+        PHP_V8_ME(ArrayBufferView, byteLength,  ZEND_ACC_PUBLIC)
+        PHP_V8_ME(ArrayBufferView, hasBuffer,   ZEND_ACC_PUBLIC)
+        PHP_V8_ME(ArrayBufferView, getContents, ZEND_ACC_PUBLIC)
+
+        PHP_FE_END
+};
+
+
+PHP_MINIT_FUNCTION(php_v8_array_buffer_view) {
+    zend_class_entry ce;
+    INIT_NS_CLASS_ENTRY(ce, PHP_V8_NS, "ArrayBufferViewObject", php_v8_array_buffer_view_methods);
+    this_ce = zend_register_internal_class_ex(&ce, php_v8_object_class_entry);
+    this_ce->ce_flags |= ZEND_ACC_EXPLICIT_ABSTRACT_CLASS;
+
+    return SUCCESS;
+}
@@ -38,7 +38,7 @@ static PHP_METHOD(BooleanValue, __construct) {
 
     PHP_V8_THROW_VALUE_EXCEPTION_WHEN_EMPTY(local_value, "Failed to create Boolean value");
 
-    php_v8_value->persistent->Reset(isolate, local_value);
+    php_v8_value->persistent.Reset(isolate, local_value);
 }
 
 static PHP_METHOD(BooleanValue, value) {
@@ -40,7 +40,7 @@ static PHP_METHOD(BooleanObject, __construct) {
 
     php_v8_object_store_self_ptr(php_v8_value, local_bool_obj);
 
-    php_v8_value->persistent->Reset(isolate, local_bool_obj);
+    php_v8_value->persistent.Reset(isolate, local_bool_obj);
 }
 
 
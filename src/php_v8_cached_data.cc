@@ -16,8 +16,12 @@
 
 #include "php_v8_cached_data.h"
 #include "php_v8_string.h"
+#include "php_v8_a.h"
 #include "php_v8.h"
 
+#include <cerrno>
+#include <cstring>
+
 
 zend_class_entry * php_v8_cached_data_class_entry;
 #define this_ce php_v8_cached_data_class_entry
@@ -39,6 +43,67 @@ php_v8_cached_data_t * php_v8_create_cached_data(zval *return_value, const v8::S
     return php_v8_cached_data;
 }
 
+namespace phpv8 {
+    PersistentCachedData::PersistentCachedData(const uint8_t *data, int length, script_compiler_tag version)
+            : _length(length), _version(version), in_use(1), _mapping(nullptr) {
+        uint8_t *copy = (uint8_t *) pemalloc(static_cast<size_t>(length), 1);
+        memcpy(copy, data, static_cast<size_t>(length));
+
+        _data = copy;
+    }
+
+    PersistentCachedData::PersistentCachedData(MappedFile *mapping, script_compiler_tag version)
+            : _data(reinterpret_cast<const uint8_t *>(mapping->data())), _length(static_cast<int>(mapping->size())),
+              _version(version), in_use(1), _mapping(mapping) {
+    }
+
+    PersistentCachedData::~PersistentCachedData() {
+        if (_mapping) {
+            delete _mapping;
+            return;
+        }
+
+        pefree(const_cast<uint8_t *>(_data), 1);
+    }
+}
+
+static inline void php_v8_cached_data_release_persistent(phpv8::PersistentCachedData *persistent) {
+    if (persistent->release()) {
+        delete persistent;
+    }
+}
+
+static void php_v8_cached_data_use_persistent(php_v8_cached_data_t *php_v8_cached_data, phpv8::PersistentCachedData *persistent) {
+    persistent->acquire();
+
+    if (php_v8_cached_data->cached_data) {
+        delete php_v8_cached_data->cached_data;
+    }
+
+    if (php_v8_cached_data->persistent) {
+        php_v8_cached_data_release_persistent(php_v8_cached_data->persistent);
+    }
+
+    php_v8_cached_data->persistent = persistent;
+    php_v8_cached_data->cached_data = new v8::ScriptCompiler::CachedData(persistent->data(), persistent->length(), v8::ScriptCompiler::CachedData::BufferPolicy::BufferNotOwned);
+}
+
+void php_v8_cached_data_shutdown() {
+    phpv8::PersistentCachedDataStore *store = PHP_V8_G(persistent_cached_data);
+
+    if (!store) {
+        return;
+    }
+
+    for (auto const &item : *store) {
+        php_v8_cached_data_release_persistent(item.second);
+    }
+
+    delete store;
+
+    PHP_V8_G(persistent_cached_data) = nullptr;
+}
+
 static void php_v8_cached_data_free(zend_object *object)
 {
     php_v8_cached_data_t *php_v8_cached_data = php_v8_cached_data_fetch_object(object);
@@ -47,6 +112,10 @@ static void php_v8_cached_data_free(zend_object *object)
         delete php_v8_cached_data->cached_data;
     }
 
+    if (php_v8_cached_data->persistent) {
+        php_v8_cached_data_release_persistent(php_v8_cached_data->persistent);
+    }
+
     zend_object_std_dtor(&php_v8_cached_data->std);
 }
 
@@ -105,6 +174,177 @@ static PHP_METHOD(CachedData, isRejected)
     RETVAL_BOOL(php_v8_cached_data->cached_data->rejected);
 }
 
+bool php_v8_cached_data_from_file(zval *return_value, const char *path) {
+    if (php_check_open_basedir(path)) {
+        PHP_V8_THROW_EXCEPTION("Unable to map cached data file (open_basedir restriction in effect)");
+        return false;
+    }
+
+    phpv8::MappedFile *mapping = phpv8::MappedFile::open(path);
+
+    if (!mapping) {
+        zend_throw_exception_ex(php_v8_generic_exception_class_entry, 0, "Unable to map cached data file '%s': %s", path, strerror(errno));
+        return false;
+    }
+
+    if (mapping->size() > INT_MAX) {
+        delete mapping;
+        PHP_V8_THROW_VALUE_EXCEPTION("CachedData data file is too long");
+        return false;
+    }
+
+    php_v8_init();
+
+    // v8 validates its own header on consumption, so the data itself is untouched until then
+    phpv8::PersistentCachedData *persistent = new phpv8::PersistentCachedData(mapping, php_v8_startup_data_get_current_tag());
+
+    object_init_ex(return_value, this_ce);
+    PHP_V8_FETCH_CACHED_DATA_INTO(return_value, php_v8_cached_data);
+
+    php_v8_cached_data_use_persistent(php_v8_cached_data, persistent);
+    php_v8_cached_data_release_persistent(persistent);
+
+    return true;
+}
+
+void php_v8_cached_data_persist(php_v8_cached_data_t *php_v8_cached_data, const std::string &name) {
+    php_v8_init();
+
+    phpv8::PersistentCachedData *persistent = php_v8_cached_data->persistent;
+
+    if (!persistent) {
+        persistent = new phpv8::PersistentCachedData(php_v8_cached_data->cached_data->data, php_v8_cached_data->cached_data->length, php_v8_startup_data_get_current_tag());
+
+        // from now on this object uses persistent copy too, so it doesn't hold the same data twice
+        php_v8_cached_data_use_persistent(php_v8_cached_data, persistent);
+    } else {
+        persistent->acquire();
+    }
+
+    if (!PHP_V8_G(persistent_cached_data)) {
+        PHP_V8_G(persistent_cached_data) = new phpv8::PersistentCachedDataStore();
+    }
+
+    phpv8::PersistentCachedDataStore *store = PHP_V8_G(persistent_cached_data);
+
+    auto it = store->find(name);
+
+    if (it != store->end()) {
+        php_v8_cached_data_release_persistent(it->second);
+    }
+
+    (*store)[name] = persistent;
+}
+
+bool php_v8_cached_data_fetch_persisted(zval *return_value, const std::string &name) {
+    phpv8::PersistentCachedDataStore *store = PHP_V8_G(persistent_cached_data);
+
+    if (!store) {
+        return false;
+    }
+
+    auto it = store->find(name);
+
+    if (it == store->end()) {
+        return false;
+    }
+
+    phpv8::PersistentCachedData *persistent = it->second;
+
+    php_v8_init();
+
+    script_compiler_tag runtime = php_v8_startup_data_get_current_tag();
+    script_compiler_tag version = persistent->version();
+
+    if (runtime.magic != version.magic || runtime.tag != version.tag) {
+        // v8 would reject it anyway
+        store->erase(it);
+        php_v8_cached_data_release_persistent(persistent);
+
+        return false;
+    }
+
+    object_init_ex(return_value, this_ce);
+    PHP_V8_FETCH_CACHED_DATA_INTO(return_value, php_v8_cached_data);
+
+    php_v8_cached_data_use_persistent(php_v8_cached_data, persistent);
+
+    return true;
+}
+
+bool php_v8_cached_data_forget_persisted(const std::string &name) {
+    phpv8::PersistentCachedDataStore *store = PHP_V8_G(persistent_cached_data);
+
+    if (!store) {
+        return false;
+    }
+
+    auto it = store->find(name);
+
+    if (it == store->end()) {
+        return false;
+    }
+
+    php_v8_cached_data_release_persistent(it->second);
+    store->erase(it);
+
+    return true;
+}
+
+static PHP_METHOD(CachedData, fromFile)
+{
+    char *path = NULL;
+    size_t path_len = 0;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "p", &path, &path_len) == FAILURE) {
+        return;
+    }
+
+    php_v8_cached_data_from_file(return_value, path);
+}
+
+static PHP_METHOD(CachedData, persist)
+{
+    zend_string *name = NULL;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "S", &name) == FAILURE) {
+        return;
+    }
+
+    PHP_V8_FETCH_CACHED_DATA_WITH_CHECK(getThis(), php_v8_cached_data);
+
+    if (php_v8_cached_data->cached_data->rejected) {
+        PHP_V8_THROW_EXCEPTION("Unable to persist rejected cached data");
+        return;
+    }
+
+    php_v8_cached_data_persist(php_v8_cached_data, std::string(ZSTR_VAL(name), ZSTR_LEN(name)));
+}
+
+static PHP_METHOD(CachedData, fetchPersisted)
+{
+    zend_string *name = NULL;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "S", &name) == FAILURE) {
+        return;
+    }
+
+    if (!php_v8_cached_data_fetch_persisted(return_value, std::string(ZSTR_VAL(name), ZSTR_LEN(name)))) {
+        RETURN_NULL();
+    }
+}
+
+static PHP_METHOD(CachedData, forgetPersisted)
+{
+    zend_string *name = NULL;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "S", &name) == FAILURE) {
+        return;
+    }
+
+    RETURN_BOOL(php_v8_cached_data_forget_persisted(std::string(ZSTR_VAL(name), ZSTR_LEN(name))));
+}
+
 
 PHP_V8_ZEND_BEGIN_ARG_WITH_CONSTRUCTOR_INFO_EX(arginfo___construct, 1)
                 ZEND_ARG_TYPE_INFO(0, data, IS_STRING, 0)
@@ -116,11 +356,31 @@ ZEND_END_ARG_INFO()
 PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_isRejected, ZEND_RETURN_VALUE, 0, _IS_BOOL, 0)
 ZEND_END_ARG_INFO()
 
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_fromFile, ZEND_RETURN_VALUE, 1, V8\\ScriptCompiler\\CachedData, 0)
+                ZEND_ARG_TYPE_INFO(0, path, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_VOID_INFO_EX(arginfo_persist, 1)
+                ZEND_ARG_TYPE_INFO(0, name, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_fetchPersisted, ZEND_RETURN_VALUE, 1, V8\\ScriptCompiler\\CachedData, 1)
+                ZEND_ARG_TYPE_INFO(0, name, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_forgetPersisted, ZEND_RETURN_VALUE, 1, _IS_BOOL, 0)
+                ZEND_ARG_TYPE_INFO(0, name, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
 
 static const zend_function_entry php_v8_cached_data_methods[] = {
     PHP_V8_ME(CachedData, __construct, ZEND_ACC_PUBLIC | ZEND_ACC_CTOR)
     PHP_V8_ME(CachedData, getData,     ZEND_ACC_PUBLIC)
     PHP_V8_ME(CachedData, isRejected,  ZEND_ACC_PUBLIC)
+    PHP_V8_ME(CachedData, fromFile,        ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+    PHP_V8_ME(CachedData, persist,         ZEND_ACC_PUBLIC)
+    PHP_V8_ME(CachedData, fetchPersisted,  ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+    PHP_V8_ME(CachedData, forgetPersisted, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
 
     PHP_FE_END
 };
@@ -15,8 +15,14 @@
 
 typedef struct _php_v8_cached_data_t php_v8_cached_data_t;
 
+namespace phpv8 {
+    class PersistentCachedData;
+}
+
 #include "php_v8_exceptions.h"
+#include "php_v8_startup_data.h"
 #include <v8.h>
+#include <string>
 
 extern "C" {
 #include "php.h"
@@ -30,6 +36,11 @@ extern zend_class_entry *php_v8_cached_data_class_entry;
 
 inline php_v8_cached_data_t * php_v8_cached_data_fetch_object(zend_object *obj);
 extern php_v8_cached_data_t * php_v8_create_cached_data(zval *return_value, const v8::ScriptCompiler::CachedData *cached_data);
+extern void php_v8_cached_data_shutdown();
+extern bool php_v8_cached_data_from_file(zval *return_value, const char *path);
+extern void php_v8_cached_data_persist(php_v8_cached_data_t *php_v8_cached_data, const std::string &name);
+extern bool php_v8_cached_data_fetch_persisted(zval *return_value, const std::string &name);
+extern bool php_v8_cached_data_forget_persisted(const std::string &name);
 
 
 #define PHP_V8_FETCH_CACHED_DATA(zv) php_v8_cached_data_fetch_object(Z_OBJ_P(zv))
@@ -51,8 +62,54 @@ extern php_v8_cached_data_t * php_v8_create_cached_data(zval *return_value, cons
     }
 
 
+namespace phpv8 {
+    /**
+     * Code cache copy in persistent memory (or mapped file) which outlives request, shared by CachedData objects
+     * without copying
+     */
+    class PersistentCachedData {
+    public:
+        PersistentCachedData(const uint8_t *data, int length, script_compiler_tag version);
+        /**
+         * Use mapped file contents as is, mapping is owned by this object
+         */
+        PersistentCachedData(MappedFile *mapping, script_compiler_tag version);
+        ~PersistentCachedData();
+
+        inline const uint8_t *data() {
+            return _data;
+        }
+
+        inline int length() {
+            return _length;
+        }
+
+        inline script_compiler_tag version() {
+            return _version;
+        }
+
+        inline void acquire() {
+            assert(in_use < UINT32_MAX);
+            in_use++;
+        }
+
+        inline bool release() {
+            assert(in_use > 0);
+            return --in_use == 0;
+        }
+    private:
+        const uint8_t *_data;
+        int _length;
+        script_compiler_tag _version;
+        uint32_t in_use;
+        MappedFile *_mapping;
+    };
+}
+
+
 struct _php_v8_cached_data_t {
     v8::ScriptCompiler::CachedData *cached_data;
+    phpv8::PersistentCachedData *persistent;
 
   zend_object std;
 };
@@ -15,6 +15,7 @@
 #endif
 
 #include "php_v8_callback_info_interface.h"
+#include "php_v8_return_value.h"
 #include "php_v8.h"
 
 
@@ -22,6 +23,54 @@ zend_class_entry *php_v8_callback_info_interface_class_entry;
 #define this_ce php_v8_callback_info_interface_class_entry
 
 
+/*
+ * Each isolate keeps single idle callback info object of each kind, so that callbacks which don't hold a reference
+ * to their callback info (or its return value) beyond the call don't create new objects on every invocation.
+ * Nested callbacks find pool empty and create objects as usual.
+ */
+bool php_v8_callback_info_acquire(zval *pool, zval *callback_info) {
+    if (Z_ISUNDEF_P(pool)) {
+        return false;
+    }
+
+    ZVAL_COPY_VALUE(callback_info, pool);
+    ZVAL_UNDEF(pool);
+
+    return true;
+}
+
+bool php_v8_callback_info_is_reusable(zval *pool, zval *callback_info, zend_class_entry *ce) {
+    zval rv;
+    zval *return_value_zv;
+
+    if (!Z_ISUNDEF_P(pool) || Z_REFCOUNT_P(callback_info) > 1) {
+        return false;
+    }
+
+    // dynamic properties set by user would leak into next invocation
+    if (Z_OBJ_P(callback_info)->properties && zend_hash_num_elements(Z_OBJ_P(callback_info)->properties) > static_cast<uint32_t>(ce->default_properties_count)) {
+        return false;
+    }
+
+    return_value_zv = zend_read_property(ce, callback_info, ZEND_STRL("return_value"), 1, &rv);
+
+    return Z_TYPE_P(return_value_zv) == IS_OBJECT && Z_REFCOUNT_P(return_value_zv) == 1;
+}
+
+void php_v8_callback_info_store(zval *pool, zval *callback_info, zend_class_entry *ce) {
+    zval rv;
+
+    // idle object should not keep isolate, context or any js value alive
+    zend_update_property_null(ce, callback_info, ZEND_STRL("isolate"));
+    zend_update_property_null(ce, callback_info, ZEND_STRL("context"));
+    zend_update_property_null(ce, callback_info, ZEND_STRL("this"));
+    zend_update_property_null(ce, callback_info, ZEND_STRL("holder"));
+
+    php_v8_return_value_clear(zend_read_property(ce, callback_info, ZEND_STRL("return_value"), 1, &rv));
+
+    ZVAL_COPY_VALUE(pool, callback_info);
+}
+
 PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_getIsolate, ZEND_RETURN_VALUE, 0, V8\\Isolate, 0)
 ZEND_END_ARG_INFO()
 
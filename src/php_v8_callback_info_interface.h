@@ -23,6 +23,10 @@ extern "C" {
 
 extern zend_class_entry* php_v8_callback_info_interface_class_entry;
 
+extern bool php_v8_callback_info_acquire(zval *pool, zval *callback_info);
+extern bool php_v8_callback_info_is_reusable(zval *pool, zval *callback_info, zend_class_entry *ce);
+extern void php_v8_callback_info_store(zval *pool, zval *callback_info, zend_class_entry *ce);
+
 
 PHP_MINIT_FUNCTION(php_v8_callback_info_interface);
 
@@ -27,26 +27,43 @@
 /* end of type listing */
 
 #include "php_v8_value.h"
+#include "php_v8_value_converter.h"
 #include "php_v8_isolate.h"
 #include <string>
 #include <algorithm>
 
 namespace phpv8 {
 
-    Callback::Callback(zend_fcall_info fci, zend_fcall_info_cache fci_cache) : fci_(fci), fci_cache_(fci_cache) {
-        if (fci_.size) {
-            Z_ADDREF(fci_.function_name);
+    Callback::Callback() : fci_(empty_fcall_info), fci_cache_(empty_fcall_info_cache) {
+        ZVAL_UNDEF(&object_);
+    }
 
-            if (fci_.object) {
-                ZVAL_OBJ(&object_, fci_.object);
-                Z_ADDREF(object_);
-            } else {
-                ZVAL_UNDEF(&object_);
+    Callback::~Callback() {
+        clear();
+    }
+
+    void Callback::set(zend_fcall_info fci, zend_fcall_info_cache fci_cache) {
+        zval object;
+        ZVAL_UNDEF(&object);
+
+        // take new references before releasing old ones, as they may point to the same callable
+        if (fci.size) {
+            Z_TRY_ADDREF(fci.function_name);
+
+            if (fci.object) {
+                ZVAL_OBJ(&object, fci.object);
+                Z_ADDREF(object);
             }
         }
+
+        clear();
+
+        fci_ = fci;
+        fci_cache_ = fci_cache;
+        ZVAL_COPY_VALUE(&object_, &object);
     }
 
-    Callback::~Callback() {
+    void Callback::clear() {
         if (fci_.size) {
             zval_ptr_dtor(&fci_.function_name);
 
@@ -54,6 +71,10 @@ namespace phpv8 {
                 zval_ptr_dtor(&object_);
             }
         }
+
+        fci_ = empty_fcall_info;
+        fci_cache_ = empty_fcall_info_cache;
+        ZVAL_UNDEF(&object_);
     }
 
     int Callback::getGcCount() {
@@ -80,41 +101,103 @@ namespace phpv8 {
         }
     }
 
-    void CallbacksBucket::reset(CallbacksBucket *bucket) {
-        callbacks.clear();
+    Binding::Binding() : kind_(Kind::None), scope_(nullptr) {
+        ZVAL_UNDEF(&target_);
+        ZVAL_UNDEF(&key_);
+    }
 
-        for (auto const &item : bucket->callbacks) {
-            callbacks[item.first] = item.second;
-        }
+    Binding::~Binding() {
+        clear();
     }
 
-    phpv8::Callback *CallbacksBucket::get(Index index) {
-        auto it = callbacks.find(index);
+    void Binding::set(Kind kind, zval *target, zval *key, zend_class_entry *scope) {
+        zval new_target;
+        zval new_key;
 
-        if (it != callbacks.end()) {
-            return it->second.get();
+        // take new references before releasing old ones, as they may point to the same values
+        ZVAL_COPY(&new_target, target);
+        ZVAL_COPY(&new_key, key);
+
+        clear();
+
+        kind_ = kind;
+        scope_ = scope;
+        ZVAL_COPY_VALUE(&target_, &new_target);
+        ZVAL_COPY_VALUE(&key_, &new_key);
+    }
+
+    void Binding::clear() {
+        zval_ptr_dtor(&target_);
+        zval_ptr_dtor(&key_);
+
+        kind_ = Kind::None;
+        scope_ = nullptr;
+        ZVAL_UNDEF(&target_);
+        ZVAL_UNDEF(&key_);
+    }
+
+    int Binding::getGcCount() {
+        return empty() ? 0 : 2;
+    }
+
+    void Binding::collectGcZvals(zval *&zv) {
+        if (!empty()) {
+            ZVAL_COPY_VALUE(zv++, &target_);
+            ZVAL_COPY_VALUE(zv++, &key_);
         }
+    }
 
-        return NULL;
+    void CallbacksBucket::reset(CallbacksBucket *bucket) {
+        for (int i = 0; i < slots; i++) {
+            if (bucket->callbacks[i].empty()) {
+                callbacks[i].clear();
+            } else {
+                callbacks[i].set(bucket->callbacks[i].fci(), bucket->callbacks[i].fci_cache());
+            }
+        }
+
+        if (bucket->binding_.empty()) {
+            binding_.clear();
+        } else {
+            binding_.set(bucket->binding_.kind(), bucket->binding_.target(), bucket->binding_.key(), bucket->binding_.scope());
+        }
     }
 
     void CallbacksBucket::add(Index index, zend_fcall_info fci, zend_fcall_info_cache fci_cache) {
-        callbacks[index] = std::make_shared<Callback>(fci, fci_cache);
+        callbacks[static_cast<int>(index)].set(fci, fci_cache);
+    }
+
+    bool CallbacksBucket::empty() {
+        for (int i = 0; i < slots; i++) {
+            if (!callbacks[i].empty()) {
+                return false;
+            }
+        }
+
+        return binding_.empty();
     }
 
     int CallbacksBucket::getGcCount() {
-        int size = 0;
+        int size = binding_.getGcCount();
 
-        for (auto const &item : callbacks) {
-            size += item.second->getGcCount();
+        for (int i = 0; i < slots; i++) {
+            size += callbacks[i].getGcCount();
         }
 
         return size;
     }
 
     void CallbacksBucket::collectGcZvals(zval *&zv) {
-        for (auto const &item : callbacks) {
-            item.second->collectGcZvals(zv);
+        for (int i = 0; i < slots; i++) {
+            callbacks[i].collectGcZvals(zv);
+        }
+
+        binding_.collectGcZvals(zv);
+    }
+
+    PersistentData::~PersistentData() {
+        if (pinned_) {
+            zend_string_release(pinned_);
         }
     }
 
@@ -135,12 +218,12 @@ namespace phpv8 {
     }
 
     CallbacksBucket *PersistentData::bucket(const char *prefix, bool is_symbol, const char *name) {
-        char *internal_name;
-
-        size_t size = spprintf(&internal_name, 0, "%s%s%s", prefix, (is_symbol ? "sym_" : "str_"), name);
+        size_t prefix_len = strlen(prefix);
+        size_t name_len = strlen(name);
 
-        std::string str_name(internal_name, size);
-        efree(internal_name);
+        std::string str_name;
+        str_name.reserve(prefix_len + 4 + name_len);
+        str_name.append(prefix, prefix_len).append(is_symbol ? "sym_" : "str_", 4).append(name, name_len);
 
         auto it = buckets.find(str_name);
 
@@ -148,17 +231,31 @@ namespace phpv8 {
             return it->second.get();
         }
 
-        auto bucket = std::make_shared<CallbacksBucket>();
-        buckets[str_name] = bucket;
+        // buckets are heap allocated, so pointers to them passed to v8 stay valid when map grows
+        CallbacksBucket *bucket = new CallbacksBucket();
+        buckets.emplace(std::move(str_name), std::unique_ptr<CallbacksBucket>(bucket));
 
-        return bucket.get();
+        return bucket;
+    }
+
+    void PersistentData::pin(zend_string *string) {
+        if (pinned_) {
+            zend_string_release(pinned_);
+        }
+
+        pinned_ = zend_string_copy(string);
+        size_ = 0;
     }
 
     int64_t PersistentData::calculateSize() {
         int64_t size = sizeof(*this);
 
+        if (pinned_) {
+            size += ZSTR_LEN(pinned_);
+        }
+
         for (auto const &item : buckets) {
-            size += sizeof(std::shared_ptr<CallbacksBucket>);
+            size += sizeof(std::unique_ptr<CallbacksBucket>);
             size += item.first.capacity();
             size += item.second->calculateSize();
         }
@@ -234,7 +331,17 @@ static inline void php_v8_callback_set_retval_from_callback_info(v8::ReturnValue
 }
 
 
-void php_v8_callback_call_from_bucket_with_zargs(phpv8::CallbacksBucket::Index index, v8::Local<v8::Value> data, zval *args, zval *retval) {
+static inline void php_v8_callback_info_release(zval *callback_info, php_v8_isolate_t *php_v8_isolate, const v8::FunctionCallbackInfo<v8::Value> &) {
+    php_v8_function_callback_info_release(callback_info, php_v8_isolate);
+}
+
+template<class T>
+static inline void php_v8_callback_info_release(zval *callback_info, php_v8_isolate_t *php_v8_isolate, const v8::PropertyCallbackInfo<T> &) {
+    php_v8_property_callback_info_release(callback_info, php_v8_isolate);
+}
+
+
+static void php_v8_callback_call_from_bucket(phpv8::CallbacksBucket::Index index, v8::Local<v8::Value> data, zval *params, uint32_t param_count, zval *retval) {
     phpv8::CallbacksBucket *bucket;
 
     if (data.IsEmpty() || !data->IsExternal()) {
@@ -255,273 +362,391 @@ void php_v8_callback_call_from_bucket_with_zargs(phpv8::CallbacksBucket::Index i
     zend_fcall_info fci = cb->fci();
     zend_fcall_info_cache fci_cache = cb->fci_cache();
 
-    /* Convert everything to be callable */
-    zend_fcall_info_args(&fci, args);
+    // Arguments are passed as is, without building intermediate array and copying it into fci
+    fci.params = params;
+    fci.param_count = param_count;
+    fci.retval = retval;
 
-    /* Initialize the return persistent pointer */
-    zval retval_tmp;
-    fci.retval = &retval_tmp;
-
-    /* Call the function */
-    if (zend_call_function(&fci, &fci_cache) == SUCCESS && fci.retval && retval != NULL) {
-        ZVAL_ZVAL(retval, fci.retval, 1, 1);
-    }
+    zend_call_function(&fci, &fci_cache);
 
     // We let user handle any case of exceptions for themselves
-
-    /* Clean up our mess */
-    zend_fcall_info_args_clear(&fci, 1);
 }
 
+/**
+ * Calls php callback with given arguments followed by callback info object, which is the last argument.
+ * Callback info object (together with its return value object) comes from per-isolate pool when possible.
+ *
+ * Value returned from php callback is stored in retval when it is given and ignored otherwise.
+ */
 template<class T, class M>
-void php_v8_callback_call_from_bucket_with_zargs(phpv8::CallbacksBucket::Index index, const T &info, M rv, zval *args) {
-    zval callback_info;
+void php_v8_callback_call_from_bucket_with_params(phpv8::CallbacksBucket::Index index, const T &info, M rv, zval *params, uint32_t param_count, zval *retval = nullptr) {
     php_v8_return_value_t *php_v8_return_value;
-    // Wrap callback info
+    zval *callback_info = &params[param_count];
+    zval ignored_retval;
 
-    php_v8_return_value = php_v8_callback_info_create_from_info(&callback_info, info);
+    if (!retval) {
+        retval = &ignored_retval;
+    }
+
+    ZVAL_UNDEF(retval);
+
+    // Wrap callback info
+    php_v8_return_value = php_v8_callback_info_create_from_info(callback_info, info);
 
     if (!php_v8_return_value) {
         return;
     }
 
-    add_next_index_zval(args, &callback_info);
-
     php_v8_callback_set_retval_from_callback_info(&rv, php_v8_return_value);
 
-    php_v8_callback_call_from_bucket_with_zargs(index, info.Data(), args, NULL);
+    php_v8_isolate_t *php_v8_isolate = PHP_V8_ISOLATE_FETCH_REFERENCE(info.GetIsolate());
+
+    php_v8_isolate_limits_callback_enter(php_v8_isolate);
+    php_v8_callback_call_from_bucket(index, info.Data(), params, param_count + 1, retval);
+    php_v8_isolate_limits_callback_leave(php_v8_isolate);
 
     php_v8_return_value_mark_expired(php_v8_return_value);
+
+    php_v8_callback_info_release(callback_info, php_v8_isolate, info);
+
+    if (retval == &ignored_retval) {
+        zval_ptr_dtor(&ignored_retval);
+    }
+}
+
+/**
+ * Sets value returned from php callback as js result. Booleans and numbers are set without allocating any handle,
+ * other values go through value converter. Null (or no value at all) leaves result untouched.
+ */
+static void php_v8_callback_set_direct_return_value(v8::Isolate *isolate, v8::ReturnValue<v8::Value> rv, zval *retval) {
+    if (Z_TYPE_P(retval) <= IS_NULL || EG(exception)) {
+        return;
+    }
+
+    switch (Z_TYPE_P(retval)) {
+        case IS_FALSE:
+            rv.Set(false);
+            return;
+        case IS_TRUE:
+            rv.Set(true);
+            return;
+        case IS_LONG:
+            if (Z_LVAL_P(retval) >= INT32_MIN && Z_LVAL_P(retval) <= INT32_MAX) {
+                rv.Set(static_cast<int32_t>(Z_LVAL_P(retval)));
+            } else {
+                rv.Set(static_cast<double>(Z_LVAL_P(retval)));
+            }
+            return;
+        case IS_DOUBLE:
+            rv.Set(Z_DVAL_P(retval));
+            return;
+        default:
+            break;
+    }
+
+    php_v8_isolate_t *php_v8_isolate = PHP_V8_ISOLATE_FETCH_REFERENCE(isolate);
+
+    phpv8::ValueConverter converter(php_v8_isolate, isolate->GetCurrentContext(), PHP_V8_VALUE_CONVERTER_DEFAULT_MAX_DEPTH);
+
+    v8::Local<v8::Value> local_value;
+
+    if (converter.fromPhp(retval).ToLocal(&local_value)) {
+        rv.Set(local_value);
+    }
 }
 
 
 void php_v8_callback_function(const v8::FunctionCallbackInfo<v8::Value> &info) {
-    PHP_V8_DECLARE_ISOLATE_LOCAL_ALIAS(info.GetIsolate());
+    zval params[1];
 
-    zval args;
+    php_v8_callback_call_from_bucket_with_params(phpv8::CallbacksBucket::Index::Callback, info, info.GetReturnValue(), params, 0);
+}
 
-    /* Build the parameter array */
-    array_init_size(&args, 1);
+void php_v8_callback_function_direct(const v8::FunctionCallbackInfo<v8::Value> &info) {
+    zval params[1];
+    zval retval;
 
-    php_v8_callback_call_from_bucket_with_zargs(phpv8::CallbacksBucket::Index::Callback, info, info.GetReturnValue(), &args);
+    php_v8_callback_call_from_bucket_with_params(phpv8::CallbacksBucket::Index::Callback, info, info.GetReturnValue(), params, 0, &retval);
+    php_v8_callback_set_direct_return_value(info.GetIsolate(), info.GetReturnValue(), &retval);
 
-    zval_ptr_dtor(&args);
+    zval_ptr_dtor(&retval);
 }
 
 void php_v8_callback_accessor_name_getter(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value> &info) {
-    PHP_V8_DECLARE_ISOLATE_LOCAL_ALIAS(info.GetIsolate());
-    php_v8_isolate_t *php_v8_isolate = PHP_V8_ISOLATE_FETCH_REFERENCE(isolate);
+    php_v8_isolate_t *php_v8_isolate = PHP_V8_ISOLATE_FETCH_REFERENCE(info.GetIsolate());
 
-    zval args;
-    zval property_name;
+    zval params[2];
 
-    /* Build the parameter array */
-    array_init_size(&args, 2);
+    php_v8_get_or_create_value(&params[0], property, php_v8_isolate);
 
-    php_v8_get_or_create_value(&property_name, property, php_v8_isolate);
-    add_index_zval(&args, 0, &property_name);
+    php_v8_callback_call_from_bucket_with_params(phpv8::CallbacksBucket::Index::Getter, info, info.GetReturnValue(), params, 1);
+
+    zval_ptr_dtor(&params[0]);
+}
 
-    php_v8_callback_call_from_bucket_with_zargs(phpv8::CallbacksBucket::Index::Getter, info, info.GetReturnValue(), &args);
+void php_v8_callback_accessor_name_getter_direct(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value> &info) {
+    php_v8_isolate_t *php_v8_isolate = PHP_V8_ISOLATE_FETCH_REFERENCE(info.GetIsolate());
 
-    zval_ptr_dtor(&args);
+    zval params[2];
+    zval retval;
+
+    php_v8_get_or_create_value(&params[0], property, php_v8_isolate);
+
+    php_v8_callback_call_from_bucket_with_params(phpv8::CallbacksBucket::Index::Getter, info, info.GetReturnValue(), params, 1, &retval);
+    php_v8_callback_set_direct_return_value(info.GetIsolate(), info.GetReturnValue(), &retval);
+
+    zval_ptr_dtor(&retval);
+    zval_ptr_dtor(&params[0]);
 }
 
 void php_v8_callback_accessor_name_setter(v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void> &info) {
-    PHP_V8_DECLARE_ISOLATE_LOCAL_ALIAS(info.GetIsolate());
-    php_v8_isolate_t *php_v8_isolate = PHP_V8_ISOLATE_FETCH_REFERENCE(isolate);
+    php_v8_isolate_t *php_v8_isolate = PHP_V8_ISOLATE_FETCH_REFERENCE(info.GetIsolate());
 
-    zval args;
-    zval property_name;
-    zval property_value;
+    zval params[3];
 
-    /* Build the parameter array */
-    array_init_size(&args, 3);
+    php_v8_get_or_create_value(&params[0], property, php_v8_isolate);
+    php_v8_get_or_create_value(&params[1], value, php_v8_isolate);
 
-    php_v8_get_or_create_value(&property_name, property, php_v8_isolate);
-    php_v8_get_or_create_value(&property_value, value, php_v8_isolate);
+    php_v8_callback_call_from_bucket_with_params(phpv8::CallbacksBucket::Index::Setter, info, info.GetReturnValue(), params, 2);
 
-    add_index_zval(&args, 0, &property_name);
-    add_index_zval(&args, 1, &property_value);
+    zval_ptr_dtor(&params[0]);
+    zval_ptr_dtor(&params[1]);
+}
+
+
+static phpv8::Binding *php_v8_callback_binding_from_data(v8::Local<v8::Value> data) {
+    if (data.IsEmpty() || !data->IsExternal()) {
+        PHP_V8_THROW_EXCEPTION("Callback doesn't have stored binding");
+        return nullptr;
+    }
 
-    php_v8_callback_call_from_bucket_with_zargs(phpv8::CallbacksBucket::Index::Setter, info, info.GetReturnValue(), &args);
+    phpv8::Binding *binding = static_cast<phpv8::CallbacksBucket *>(v8::Local<v8::External>::Cast(data)->Value())->binding();
 
-    zval_ptr_dtor(&args);
+    // highly unlikely, but to play safe
+    if (binding->empty()) {
+        PHP_V8_THROW_EXCEPTION("Callback doesn't have stored binding");
+        return nullptr;
+    }
+
+    return binding;
 }
 
+static zval *php_v8_callback_binding_find(phpv8::Binding *binding, zval *rv) {
+    zval *target = binding->target();
+    zval *key = binding->key();
+    zval *array;
+
+    switch (binding->kind()) {
+        case phpv8::Binding::Kind::Constant:
+            return target;
+        case phpv8::Binding::Kind::Property:
+            return zend_read_property_ex(binding->scope(), target, Z_STR_P(key), 1, rv);
+        case phpv8::Binding::Kind::ArrayOffset:
+            array = Z_REFVAL_P(target);
+
+            if (Z_TYPE_P(array) != IS_ARRAY) {
+                return nullptr;
+            }
 
-void php_v8_callback_generic_named_property_getter(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value> &info) {
-    PHP_V8_DECLARE_ISOLATE_LOCAL_ALIAS(info.GetIsolate());
-    php_v8_isolate_t *php_v8_isolate = PHP_V8_ISOLATE_FETCH_REFERENCE(isolate);
+            // numeric string keys are normalized to integers when binding is created
+            return Z_TYPE_P(key) == IS_LONG
+                   ? zend_hash_index_find(Z_ARRVAL_P(array), static_cast<zend_ulong>(Z_LVAL_P(key)))
+                   : zend_hash_find(Z_ARRVAL_P(array), Z_STR_P(key));
+        default:
+            return nullptr;
+    }
+}
 
-    zval args;
-    zval property_name;
+static void php_v8_callback_binding_assign(phpv8::Binding *binding, zval *value) {
+    zval *target = binding->target();
+    zval *key = binding->key();
+    zval *array;
+    zval *slot;
+
+    switch (binding->kind()) {
+        case phpv8::Binding::Kind::Property:
+            zend_update_property_ex(binding->scope(), target, Z_STR_P(key), value);
+            break;
+        case phpv8::Binding::Kind::ArrayOffset:
+            array = Z_REFVAL_P(target);
+
+            if (Z_TYPE_P(array) != IS_ARRAY) {
+                break;
+            }
 
-    /* Build the parameter array */
-    array_init_size(&args, 2);
+            SEPARATE_ARRAY(array);
 
-    php_v8_get_or_create_value(&property_name, property, php_v8_isolate);
-    add_index_zval(&args, 0, &property_name);
+            slot = Z_TYPE_P(key) == IS_LONG
+                   ? zend_hash_index_find(Z_ARRVAL_P(array), static_cast<zend_ulong>(Z_LVAL_P(key)))
+                   : zend_hash_find(Z_ARRVAL_P(array), Z_STR_P(key));
 
-    php_v8_callback_call_from_bucket_with_zargs(phpv8::CallbacksBucket::Index::Getter, info, info.GetReturnValue(), &args);
+            if (slot) {
+                zval old;
 
-    zval_ptr_dtor(&args);
+                // assign through references, just like php does
+                ZVAL_DEREF(slot);
+                ZVAL_COPY_VALUE(&old, slot);
+                ZVAL_COPY(slot, value);
+                zval_ptr_dtor(&old);
+            } else {
+                Z_TRY_ADDREF_P(value);
+
+                if (Z_TYPE_P(key) == IS_LONG) {
+                    zend_hash_index_add_new(Z_ARRVAL_P(array), static_cast<zend_ulong>(Z_LVAL_P(key)), value);
+                } else {
+                    zend_hash_add_new(Z_ARRVAL_P(array), Z_STR_P(key), value);
+                }
+            }
+            break;
+        default:
+            // constants are read-only and have no setter installed
+            break;
+    }
 }
 
-void php_v8_callback_generic_named_property_setter(v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<v8::Value> &info) {
-    PHP_V8_DECLARE_ISOLATE_LOCAL_ALIAS(info.GetIsolate());
-    php_v8_isolate_t *php_v8_isolate = PHP_V8_ISOLATE_FETCH_REFERENCE(isolate);
+void php_v8_callback_binding_getter(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value> &info) {
+    phpv8::Binding *binding = php_v8_callback_binding_from_data(info.Data());
 
-    zval args;
-    zval property_name;
-    zval property_value;
+    if (!binding) {
+        return;
+    }
 
-    /* Build the parameter array */
-    array_init_size(&args, 3);
+    zval rv;
+    ZVAL_UNDEF(&rv);
 
-    php_v8_get_or_create_value(&property_name, property, php_v8_isolate);
-    php_v8_get_or_create_value(&property_value, value, php_v8_isolate);
+    zval *value = php_v8_callback_binding_find(binding, &rv);
 
-    add_index_zval(&args, 0, &property_name);
-    add_index_zval(&args, 1, &property_value);
+    if (value) {
+        php_v8_isolate_t *php_v8_isolate = PHP_V8_ISOLATE_FETCH_REFERENCE(info.GetIsolate());
+        phpv8::ValueConverter converter(php_v8_isolate, info.GetIsolate()->GetCurrentContext(), PHP_V8_VALUE_CONVERTER_DEFAULT_MAX_DEPTH);
 
-    php_v8_callback_call_from_bucket_with_zargs(phpv8::CallbacksBucket::Index::Setter, info, info.GetReturnValue(), &args);
+        v8::Local<v8::Value> local_value;
+
+        if (converter.fromPhp(value).ToLocal(&local_value)) {
+            info.GetReturnValue().Set(local_value);
+        }
+    }
 
-    zval_ptr_dtor(&args);
+    zval_ptr_dtor(&rv);
 }
 
-void php_v8_callback_generic_named_property_query(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Integer> &info) {
-    PHP_V8_DECLARE_ISOLATE_LOCAL_ALIAS(info.GetIsolate());
-    php_v8_isolate_t *php_v8_isolate = PHP_V8_ISOLATE_FETCH_REFERENCE(isolate);
+void php_v8_callback_binding_setter(v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void> &info) {
+    phpv8::Binding *binding = php_v8_callback_binding_from_data(info.Data());
 
-    zval args;
-    zval property_name;
+    if (!binding) {
+        return;
+    }
 
-    /* Build the parameter array */
-    array_init_size(&args, 2);
+    php_v8_isolate_t *php_v8_isolate = PHP_V8_ISOLATE_FETCH_REFERENCE(info.GetIsolate());
+    phpv8::ValueConverter converter(php_v8_isolate, info.GetIsolate()->GetCurrentContext(), PHP_V8_VALUE_CONVERTER_DEFAULT_MAX_DEPTH);
 
-    php_v8_get_or_create_value(&property_name, property, php_v8_isolate);
-    add_index_zval(&args, 0, &property_name);
+    zval php_value;
+    ZVAL_UNDEF(&php_value);
 
-    php_v8_callback_call_from_bucket_with_zargs(phpv8::CallbacksBucket::Index::Query, info, info.GetReturnValue(), &args);
+    if (converter.toPhp(value, &php_value)) {
+        php_v8_callback_binding_assign(binding, &php_value);
+    }
 
-    zval_ptr_dtor(&args);
+    zval_ptr_dtor(&php_value);
 }
 
-void php_v8_callback_generic_named_property_deleter(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Boolean> &info) {
-    PHP_V8_DECLARE_ISOLATE_LOCAL_ALIAS(info.GetIsolate());
-    php_v8_isolate_t *php_v8_isolate = PHP_V8_ISOLATE_FETCH_REFERENCE(isolate);
 
-    zval args;
-    zval property_name;
+void php_v8_callback_generic_named_property_getter(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value> &info) {
+    php_v8_isolate_t *php_v8_isolate = PHP_V8_ISOLATE_FETCH_REFERENCE(info.GetIsolate());
 
-    /* Build the parameter array */
-    array_init_size(&args, 2);
+    zval params[2];
 
-    php_v8_get_or_create_value(&property_name, property, php_v8_isolate);
-    add_index_zval(&args, 0, &property_name);
+    php_v8_get_or_create_value(&params[0], property, php_v8_isolate);
 
-    php_v8_callback_call_from_bucket_with_zargs(phpv8::CallbacksBucket::Index::Deleter, info, info.GetReturnValue(), &args);
+    php_v8_callback_call_from_bucket_with_params(phpv8::CallbacksBucket::Index::Getter, info, info.GetReturnValue(), params, 1);
 
-    zval_ptr_dtor(&args);
+    zval_ptr_dtor(&params[0]);
 }
 
-void php_v8_callback_generic_named_property_enumerator(const v8::PropertyCallbackInfo<v8::Array> &info) {
-    PHP_V8_DECLARE_ISOLATE_LOCAL_ALIAS(info.GetIsolate());
+void php_v8_callback_generic_named_property_setter(v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<v8::Value> &info) {
+    php_v8_isolate_t *php_v8_isolate = PHP_V8_ISOLATE_FETCH_REFERENCE(info.GetIsolate());
 
-    zval args;
+    zval params[3];
 
-    /* Build the parameter array */
-    array_init_size(&args, 1);
+    php_v8_get_or_create_value(&params[0], property, php_v8_isolate);
+    php_v8_get_or_create_value(&params[1], value, php_v8_isolate);
 
-    php_v8_callback_call_from_bucket_with_zargs(phpv8::CallbacksBucket::Index::Enumerator, info, info.GetReturnValue(), &args);
+    php_v8_callback_call_from_bucket_with_params(phpv8::CallbacksBucket::Index::Setter, info, info.GetReturnValue(), params, 2);
 
-    zval_ptr_dtor(&args);
+    zval_ptr_dtor(&params[0]);
+    zval_ptr_dtor(&params[1]);
 }
 
+void php_v8_callback_generic_named_property_query(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Integer> &info) {
+    php_v8_isolate_t *php_v8_isolate = PHP_V8_ISOLATE_FETCH_REFERENCE(info.GetIsolate());
 
-void php_v8_callback_indexed_property_getter(uint32_t index, const v8::PropertyCallbackInfo<v8::Value> &info) {
-    PHP_V8_DECLARE_ISOLATE_LOCAL_ALIAS(info.GetIsolate());
-
-    zval args;
-    zval property_name;
-
-    /* Build the parameter array */
-    array_init_size(&args, 2);
+    zval params[2];
 
-    // Wrap property name
-    ZVAL_LONG(&property_name, index);
-    add_index_zval(&args, 0, &property_name);
+    php_v8_get_or_create_value(&params[0], property, php_v8_isolate);
 
-    php_v8_callback_call_from_bucket_with_zargs(phpv8::CallbacksBucket::Index::Getter, info, info.GetReturnValue(), &args);
+    php_v8_callback_call_from_bucket_with_params(phpv8::CallbacksBucket::Index::Query, info, info.GetReturnValue(), params, 1);
 
-    zval_ptr_dtor(&args);
+    zval_ptr_dtor(&params[0]);
 }
 
-void php_v8_callback_indexed_property_setter(uint32_t index, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<v8::Value> &info) {
-    PHP_V8_DECLARE_ISOLATE_LOCAL_ALIAS(info.GetIsolate());
-    php_v8_isolate_t *php_v8_isolate = PHP_V8_ISOLATE_FETCH_REFERENCE(isolate);
+void php_v8_callback_generic_named_property_deleter(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Boolean> &info) {
+    php_v8_isolate_t *php_v8_isolate = PHP_V8_ISOLATE_FETCH_REFERENCE(info.GetIsolate());
 
-    zval args;
-    zval property_name;
-    zval property_value;
+    zval params[2];
 
-    /* Build the parameter array */
-    array_init_size(&args, 3);
+    php_v8_get_or_create_value(&params[0], property, php_v8_isolate);
 
-    ZVAL_LONG(&property_name, index);
-    php_v8_get_or_create_value(&property_value, value, php_v8_isolate);
+    php_v8_callback_call_from_bucket_with_params(phpv8::CallbacksBucket::Index::Deleter, info, info.GetReturnValue(), params, 1);
 
-    add_index_zval(&args, 0, &property_name);
-    add_index_zval(&args, 1, &property_value);
+    zval_ptr_dtor(&params[0]);
+}
 
-    php_v8_callback_call_from_bucket_with_zargs(phpv8::CallbacksBucket::Index::Setter, info, info.GetReturnValue(), &args);
+void php_v8_callback_generic_named_property_enumerator(const v8::PropertyCallbackInfo<v8::Array> &info) {
+    zval params[1];
 
-    zval_ptr_dtor(&args);
+    php_v8_callback_call_from_bucket_with_params(phpv8::CallbacksBucket::Index::Enumerator, info, info.GetReturnValue(), params, 0);
 }
 
-void php_v8_callback_indexed_property_query(uint32_t index, const v8::PropertyCallbackInfo<v8::Integer> &info) {
-    PHP_V8_DECLARE_ISOLATE_LOCAL_ALIAS(info.GetIsolate());
 
-    zval args;
-    zval property_name;
+void php_v8_callback_indexed_property_getter(uint32_t index, const v8::PropertyCallbackInfo<v8::Value> &info) {
+    zval params[2];
 
-    /* Build the parameter array */
-    array_init_size(&args, 2);
+    ZVAL_LONG(&params[0], index);
 
-    ZVAL_LONG(&property_name, index);
-    add_index_zval(&args, 0, &property_name);
+    php_v8_callback_call_from_bucket_with_params(phpv8::CallbacksBucket::Index::Getter, info, info.GetReturnValue(), params, 1);
+}
 
-    php_v8_callback_call_from_bucket_with_zargs(phpv8::CallbacksBucket::Index::Query, info, info.GetReturnValue(), &args);
+void php_v8_callback_indexed_property_setter(uint32_t index, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<v8::Value> &info) {
+    php_v8_isolate_t *php_v8_isolate = PHP_V8_ISOLATE_FETCH_REFERENCE(info.GetIsolate());
 
-    zval_ptr_dtor(&args);
-}
+    zval params[3];
 
-void php_v8_callback_indexed_property_deleter(uint32_t index, const v8::PropertyCallbackInfo<v8::Boolean> &info) {
-    PHP_V8_DECLARE_ISOLATE_LOCAL_ALIAS(info.GetIsolate());
+    ZVAL_LONG(&params[0], index);
+    php_v8_get_or_create_value(&params[1], value, php_v8_isolate);
 
-    zval args;
-    zval property_name;
+    php_v8_callback_call_from_bucket_with_params(phpv8::CallbacksBucket::Index::Setter, info, info.GetReturnValue(), params, 2);
 
-    /* Build the parameter array */
-    array_init_size(&args, 2);
+    zval_ptr_dtor(&params[1]);
+}
 
-    ZVAL_LONG(&property_name, index);
-    add_index_zval(&args, 0, &property_name);
+void php_v8_callback_indexed_property_query(uint32_t index, const v8::PropertyCallbackInfo<v8::Integer> &info) {
+    zval params[2];
 
-    php_v8_callback_call_from_bucket_with_zargs(phpv8::CallbacksBucket::Index::Deleter, info, info.GetReturnValue(), &args);
+    ZVAL_LONG(&params[0], index);
 
-    zval_ptr_dtor(&args);
+    php_v8_callback_call_from_bucket_with_params(phpv8::CallbacksBucket::Index::Query, info, info.GetReturnValue(), params, 1);
 }
 
-void php_v8_callback_indexed_property_enumerator(const v8::PropertyCallbackInfo<v8::Array> &info) {
-    PHP_V8_DECLARE_ISOLATE_LOCAL_ALIAS(info.GetIsolate());
+void php_v8_callback_indexed_property_deleter(uint32_t index, const v8::PropertyCallbackInfo<v8::Boolean> &info) {
+    zval params[2];
 
-    zval args;
+    ZVAL_LONG(&params[0], index);
 
-    /* Build the parameter array */
-    array_init_size(&args, 1);
+    php_v8_callback_call_from_bucket_with_params(phpv8::CallbacksBucket::Index::Deleter, info, info.GetReturnValue(), params, 1);
+}
 
-    php_v8_callback_call_from_bucket_with_zargs(phpv8::CallbacksBucket::Index::Enumerator, info, info.GetReturnValue(), &args);
+void php_v8_callback_indexed_property_enumerator(const v8::PropertyCallbackInfo<v8::Array> &info) {
+    zval params[1];
 
-    zval_ptr_dtor(&args);
+    php_v8_callback_call_from_bucket_with_params(phpv8::CallbacksBucket::Index::Enumerator, info, info.GetReturnValue(), params, 0);
 }
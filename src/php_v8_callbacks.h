@@ -15,6 +15,7 @@
 
 namespace phpv8 {
     class Callback;
+    class Binding;
     class CallbacksBucket;
     class PersistentData;
     template <class T> class PersistentCollection;
@@ -24,6 +25,8 @@ namespace phpv8 {
 #include <v8.h>
 #include <limits>
 #include <map>
+#include <memory>
+#include <unordered_map>
 #include <string>
 #include <utility>
 
@@ -41,9 +44,14 @@ extern void php_v8_callbacks_gc(phpv8::PersistentData *data, zval **gc_data, int
 extern void php_v8_bucket_gc(phpv8::CallbacksBucket *bucket, zval **gc_data, int * gc_data_count, zval **table, int *n);
 
 extern void php_v8_callback_function(const v8::FunctionCallbackInfo<v8::Value>& info);
+extern void php_v8_callback_function_direct(const v8::FunctionCallbackInfo<v8::Value>& info);
 extern void php_v8_callback_accessor_name_getter(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& info);
+extern void php_v8_callback_accessor_name_getter_direct(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& info);
 extern void php_v8_callback_accessor_name_setter(v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void>& info);
 
+extern void php_v8_callback_binding_getter(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& info);
+extern void php_v8_callback_binding_setter(v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void>& info);
+
 extern void php_v8_callback_generic_named_property_getter(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& info);
 extern void php_v8_callback_generic_named_property_setter(v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<v8::Value>& info);
 extern void php_v8_callback_generic_named_property_query(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Integer>& info);
@@ -68,11 +76,20 @@ namespace phpv8 {
 
     class Callback {
     public:
-        Callback(zend_fcall_info fci, zend_fcall_info_cache fci_cache);
+        Callback();
+        Callback(const Callback &) = delete;
+        Callback &operator=(const Callback &) = delete;
         ~Callback();
+
+        void set(zend_fcall_info fci, zend_fcall_info_cache fci_cache);
+        void clear();
         int getGcCount();
         void collectGcZvals(zval *& zv);
 
+        inline bool empty() {
+            return !fci_.size;
+        }
+
         inline zend_fcall_info fci() {
             return fci_;
         }
@@ -88,6 +105,60 @@ namespace phpv8 {
     };
 
 
+    /**
+     * Declarative accessor target (constant, object property or array offset) which is read and written natively,
+     * without calling php functions
+     */
+    class Binding {
+    public:
+        enum class Kind {
+            None = 0,
+            Constant,
+            Property,
+            ArrayOffset,
+        };
+
+        Binding();
+        Binding(const Binding &) = delete;
+        Binding &operator=(const Binding &) = delete;
+        ~Binding();
+
+        void set(Kind kind, zval *target, zval *key, zend_class_entry *scope);
+        void clear();
+        int getGcCount();
+        void collectGcZvals(zval *& zv);
+
+        inline bool empty() {
+            return Kind::None == kind_;
+        }
+
+        inline Kind kind() {
+            return kind_;
+        }
+
+        inline zval *target() {
+            return &target_;
+        }
+
+        inline zval *key() {
+            return &key_;
+        }
+
+        inline zend_class_entry *scope() {
+            return scope_;
+        }
+
+    private:
+        Kind kind_;
+        zval target_;
+        zval key_;
+        zend_class_entry *scope_;
+    };
+
+
+    /**
+     * Callbacks for single js entity (function, accessor, interceptor), each kind stored inline in its own slot
+     */
     class CallbacksBucket {
     public:
         enum class Index {
@@ -98,29 +169,42 @@ namespace phpv8 {
             Deleter = 3,
             Enumerator = 4,
         };
-        phpv8::Callback *get(Index index);
+
+        inline phpv8::Callback *get(Index index) {
+            phpv8::Callback *cb = &callbacks[static_cast<int>(index)];
+
+            return cb->empty() ? nullptr : cb;
+        }
+
         void reset(CallbacksBucket *bucket);
 
         void add(Index index, zend_fcall_info fci, zend_fcall_info_cache fci_cache);
+
+        inline phpv8::Binding *binding() {
+            return &binding_;
+        }
+
         int getGcCount();
 
         void collectGcZvals(zval *& zv);
 
-        inline bool empty() {
-            return callbacks.empty();
-        }
+        bool empty();
 
         inline int64_t calculateSize() {
-            return sizeof(*this) + (sizeof(std::shared_ptr<Callback>) + sizeof(Callback)) * callbacks.size();
+            return sizeof(*this);
         }
 
     private:
-        std::map<Index, std::shared_ptr<Callback>> callbacks;
+        static const int slots = static_cast<int>(Index::Enumerator) + 1;
+        phpv8::Callback callbacks[slots];
+        phpv8::Binding binding_;
     };
 
 
     class PersistentData {
     public:
+        ~PersistentData();
+
         int getGcCount();
         void collectGcZvals(zval *& zv);
         CallbacksBucket *bucket(const char *prefix, bool is_symbol, const char *name);
@@ -129,8 +213,17 @@ namespace phpv8 {
             return bucket("", false, name);
         }
 
+        /**
+         * Keep php string alive as long as js entity lives, e.g. when it is used as external array buffer backing store
+         */
+        void pin(zend_string *string);
+
+        inline zend_string *pinned() {
+            return pinned_;
+        }
+
         inline bool empty() {
-            return buckets.empty();
+            return buckets.empty() && !pinned_;
         }
 
         inline int64_t getTotalSize() {
@@ -159,7 +252,8 @@ namespace phpv8 {
     private:
         int64_t size_;
         int64_t adjusted_size_;
-        std::map<std::string, std::shared_ptr<CallbacksBucket>> buckets;
+        zend_string *pinned_ = nullptr;
+        std::unordered_map<std::string, std::unique_ptr<CallbacksBucket>> buckets;
     };
 
 
@@ -0,0 +1,519 @@
+/*
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "php_v8_code_cache.h"
+#include "php_v8_cached_data.h"
+#include "php_v8_startup_data.h"
+#include "php_v8_script_origin.h"
+#include "php_v8_value.h"
+#include "php_v8_a.h"
+#include "php_v8.h"
+
+extern "C" {
+#include "zend_interfaces.h"
+#include "ext/standard/sha1.h"
+}
+
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+
+zend_class_entry *php_v8_code_cache_store_interface_class_entry;
+zend_class_entry *php_v8_memory_code_cache_store_class_entry;
+zend_class_entry *php_v8_directory_code_cache_store_class_entry;
+
+#define PHP_V8_MEMORY_CODE_CACHE_STORE_PREFIX "code-cache:"
+
+
+zval *php_v8_code_cache_get_store() {
+    if (Z_TYPE(PHP_V8_G(code_cache_store)) != IS_OBJECT) {
+        return NULL;
+    }
+
+    return &PHP_V8_G(code_cache_store);
+}
+
+void php_v8_code_cache_set_store(zval *store_zv) {
+    php_v8_code_cache_request_shutdown();
+
+    if (store_zv) {
+        ZVAL_COPY(&PHP_V8_G(code_cache_store), store_zv);
+    }
+}
+
+void php_v8_code_cache_request_shutdown() {
+    zval_ptr_dtor(&PHP_V8_G(code_cache_store));
+    ZVAL_UNDEF(&PHP_V8_G(code_cache_store));
+}
+
+zend_string *php_v8_code_cache_build_key(v8::Isolate *isolate, v8::Local<v8::String> source, zval *origin_zv) {
+    PHP_SHA1_CTX context;
+    unsigned char digest[20];
+    char hex[41];
+
+    script_compiler_tag tag = php_v8_startup_data_get_current_tag();
+
+    PHP_SHA1Init(&context);
+    PHP_SHA1Update(&context, (const unsigned char *) &tag, sizeof(script_compiler_tag));
+
+    if (origin_zv && !ZVAL_IS_NULL(origin_zv)) {
+        zval rv;
+        zval *resource_name_zv = zend_read_property(php_v8_script_origin_class_entry, origin_zv, ZEND_STRL("resource_name"), 0, &rv);
+
+        if (Z_TYPE_P(resource_name_zv) == IS_STRING) {
+            PHP_SHA1Update(&context, (const unsigned char *) Z_STRVAL_P(resource_name_zv), Z_STRLEN_P(resource_name_zv));
+        }
+    }
+
+    // separate origin from source, so that moving chars from one to another doesn't give the same key
+    PHP_SHA1Update(&context, (const unsigned char *) "", 1);
+
+    v8::String::Utf8Value source_utf8(isolate, source);
+    PHP_SHA1Update(&context, (const unsigned char *) *source_utf8, static_cast<size_t>(source_utf8.length()));
+
+    PHP_SHA1Final(digest, &context);
+    make_sha1_digest(hex, digest);
+
+    return zend_string_init(hex, 40, 0);
+}
+
+bool php_v8_code_cache_get(zval *store_zv, zend_string *key, zval *retval) {
+    zval key_zv;
+    ZVAL_STR_COPY(&key_zv, key);
+
+    ZVAL_UNDEF(retval);
+    zend_call_method_with_1_params(store_zv, Z_OBJCE_P(store_zv), NULL, "get", retval, &key_zv);
+
+    zval_ptr_dtor(&key_zv);
+
+    if (EG(exception)) {
+        zval_ptr_dtor(retval);
+        ZVAL_NULL(retval);
+        return false;
+    }
+
+    if (Z_TYPE_P(retval) == IS_NULL) {
+        return true;
+    }
+
+    if (Z_TYPE_P(retval) != IS_OBJECT
+        || !instanceof_function(Z_OBJCE_P(retval), php_v8_cached_data_class_entry)
+        || NULL == PHP_V8_FETCH_CACHED_DATA(retval)->cached_data) {
+        zval_ptr_dtor(retval);
+        ZVAL_NULL(retval);
+
+        PHP_V8_THROW_VALUE_EXCEPTION("Code cache store should return V8\\ScriptCompiler\\CachedData or null");
+        return false;
+    }
+
+    return true;
+}
+
+bool php_v8_code_cache_delete(zval *store_zv, zend_string *key) {
+    zval key_zv;
+    ZVAL_STR_COPY(&key_zv, key);
+
+    zend_call_method_with_1_params(store_zv, Z_OBJCE_P(store_zv), NULL, "delete", NULL, &key_zv);
+
+    zval_ptr_dtor(&key_zv);
+
+    return !EG(exception);
+}
+
+bool php_v8_code_cache_produce(zval *store_zv, zend_string *key, v8::Local<v8::UnboundScript> unbound_script, v8::Local<v8::String> source) {
+    v8::ScriptCompiler::CachedData *cached_data = v8::ScriptCompiler::CreateCodeCache(unbound_script, source);
+
+    if (!cached_data) {
+        // nothing to store, which is not an error from cache user point of view
+        return true;
+    }
+
+    zval key_zv;
+    zval cached_data_zv;
+
+    ZVAL_STR_COPY(&key_zv, key);
+    php_v8_create_cached_data(&cached_data_zv, cached_data);
+    delete cached_data;
+
+    zend_call_method_with_2_params(store_zv, Z_OBJCE_P(store_zv), NULL, "set", NULL, &key_zv, &cached_data_zv);
+
+    zval_ptr_dtor(&cached_data_zv);
+    zval_ptr_dtor(&key_zv);
+
+    return !EG(exception);
+}
+
+
+namespace phpv8 {
+    CodeCacheLookup::~CodeCacheLookup() {
+        zval_ptr_dtor(&store);
+        zval_ptr_dtor(&cached_data);
+
+        if (key) {
+            zend_string_release(key);
+        }
+    }
+
+    bool CodeCacheLookup::lookup(zval *store_zv, v8::Isolate *isolate, v8::Local<v8::String> source, zval *origin_zv) {
+        // store may be replaced while we are calling it, so hold our own reference
+        ZVAL_COPY(&store, store_zv);
+
+        key = php_v8_code_cache_build_key(isolate, source, origin_zv);
+
+        return php_v8_code_cache_get(&store, key, &cached_data);
+    }
+
+    bool CodeCacheLookup::rejected() {
+        return hit() && PHP_V8_FETCH_CACHED_DATA(&cached_data)->cached_data->rejected;
+    }
+
+    bool CodeCacheLookup::evict() {
+        return php_v8_code_cache_delete(&store, key);
+    }
+
+    PendingCodeCache::PendingCodeCache(zval *store_zv, zend_string *key, zval *source_string_zv) : key(zend_string_copy(key)) {
+        ZVAL_COPY(&store, store_zv);
+        ZVAL_COPY(&source_string, source_string_zv);
+    }
+
+    PendingCodeCache::~PendingCodeCache() {
+        zval_ptr_dtor(&store);
+        zval_ptr_dtor(&source_string);
+        zend_string_release(key);
+    }
+
+    bool PendingCodeCache::produce(v8::Local<v8::UnboundScript> unbound_script) {
+        PHP_V8_VALUE_FETCH_INTO(&source_string, php_v8_source_string);
+
+        return php_v8_code_cache_produce(&store, key, unbound_script, php_v8_value_get_local_as<v8::String>(php_v8_source_string));
+    }
+}
+
+
+static bool php_v8_code_cache_check_key(zend_string *key) {
+    if (!ZSTR_LEN(key) || ZSTR_VAL(key)[0] == '.') {
+        return false;
+    }
+
+    for (size_t i = 0; i < ZSTR_LEN(key); i++) {
+        char c = ZSTR_VAL(key)[i];
+
+        if (!isalnum((unsigned char) c) && c != '-' && c != '_' && c != '.') {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+#define PHP_V8_CODE_CACHE_CHECK_KEY(key) \
+    if (!php_v8_code_cache_check_key(key)) { \
+        PHP_V8_THROW_VALUE_EXCEPTION("Code cache key should be non-empty string of alphanumeric, '-', '_' and '.' chars and should not start with '.'"); \
+        return; \
+    }
+
+#define PHP_V8_DIRECTORY_CODE_CACHE_STORE_READ_DIRECTORY(from_zval) zend_read_property(php_v8_directory_code_cache_store_class_entry, (from_zval), ZEND_STRL("directory"), 0, &rv)
+
+
+static std::string php_v8_directory_code_cache_store_path(zval *object, zend_string *key) {
+    zval rv;
+    zval *directory_zv = PHP_V8_DIRECTORY_CODE_CACHE_STORE_READ_DIRECTORY(object);
+
+    std::string path(Z_STRVAL_P(directory_zv), Z_STRLEN_P(directory_zv));
+
+    path.append("/");
+    path.append(ZSTR_VAL(key), ZSTR_LEN(key));
+    path.append(PHP_V8_CODE_CACHE_FILE_SUFFIX);
+
+    return path;
+}
+
+static bool php_v8_directory_code_cache_store_write(const std::string &path, const char *data, size_t length) {
+    // write to temporary file and rename it to the target one, so that readers (including those who has old file
+    // mapped into memory) never see partially written file. Temporary name is made unique by mkstemp(), as pid alone
+    // is shared by all threads in ZTS builds
+    std::string tmp_path = path + ".tmp.XXXXXX";
+
+    int fd = mkstemp(&tmp_path[0]);
+
+    if (fd < 0) {
+        return false;
+    }
+
+    // mkstemp() creates file accessible by owner only, keep cache files readable by other processes as they were
+    if (fchmod(fd, 0644) != 0) {
+        int error = errno;
+        close(fd);
+        unlink(tmp_path.c_str());
+        errno = error;
+
+        return false;
+    }
+
+    while (length > 0) {
+        ssize_t written = write(fd, data, length);
+
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            int error = errno;
+            close(fd);
+            unlink(tmp_path.c_str());
+            errno = error;
+
+            return false;
+        }
+
+        data += written;
+        length -= static_cast<size_t>(written);
+    }
+
+    if (close(fd) != 0 || rename(tmp_path.c_str(), path.c_str()) != 0) {
+        int error = errno;
+        unlink(tmp_path.c_str());
+        errno = error;
+
+        return false;
+    }
+
+    return true;
+}
+
+
+static PHP_METHOD(MemoryCodeCacheStore, get)
+{
+    zend_string *key = NULL;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "S", &key) == FAILURE) {
+        return;
+    }
+
+    std::string name(PHP_V8_MEMORY_CODE_CACHE_STORE_PREFIX);
+    name.append(ZSTR_VAL(key), ZSTR_LEN(key));
+
+    if (!php_v8_cached_data_fetch_persisted(return_value, name)) {
+        RETURN_NULL();
+    }
+}
+
+static PHP_METHOD(MemoryCodeCacheStore, set)
+{
+    zend_string *key = NULL;
+    zval *cached_data_zv = NULL;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "So", &key, &cached_data_zv) == FAILURE) {
+        return;
+    }
+
+    PHP_V8_FETCH_CACHED_DATA_WITH_CHECK(cached_data_zv, php_v8_cached_data);
+
+    if (php_v8_cached_data->cached_data->rejected) {
+        return;
+    }
+
+    std::string name(PHP_V8_MEMORY_CODE_CACHE_STORE_PREFIX);
+    name.append(ZSTR_VAL(key), ZSTR_LEN(key));
+
+    php_v8_cached_data_persist(php_v8_cached_data, name);
+}
+
+static PHP_METHOD(MemoryCodeCacheStore, delete)
+{
+    zend_string *key = NULL;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "S", &key) == FAILURE) {
+        return;
+    }
+
+    std::string name(PHP_V8_MEMORY_CODE_CACHE_STORE_PREFIX);
+    name.append(ZSTR_VAL(key), ZSTR_LEN(key));
+
+    php_v8_cached_data_forget_persisted(name);
+}
+
+
+static PHP_METHOD(DirectoryCodeCacheStore, __construct)
+{
+    zend_string *directory = NULL;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "P", &directory) == FAILURE) {
+        return;
+    }
+
+    if (php_check_open_basedir(ZSTR_VAL(directory))) {
+        PHP_V8_THROW_EXCEPTION("Unable to use code cache directory (open_basedir restriction in effect)");
+        return;
+    }
+
+    zend_stat_t st = {};
+
+    if (VCWD_STAT(ZSTR_VAL(directory), &st) != 0 || !S_ISDIR(st.st_mode)) {
+        zend_throw_exception_ex(php_v8_generic_exception_class_entry, 0, "Code cache directory '%s' does not exist", ZSTR_VAL(directory));
+        return;
+    }
+
+    zend_update_property_str(php_v8_directory_code_cache_store_class_entry, getThis(), ZEND_STRL("directory"), directory);
+}
+
+static PHP_METHOD(DirectoryCodeCacheStore, getDirectory)
+{
+    zval rv;
+
+    if (zend_parse_parameters_none() == FAILURE) {
+        return;
+    }
+
+    RETVAL_ZVAL(PHP_V8_DIRECTORY_CODE_CACHE_STORE_READ_DIRECTORY(getThis()), 1, 0);
+}
+
+static PHP_METHOD(DirectoryCodeCacheStore, get)
+{
+    zend_string *key = NULL;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "S", &key) == FAILURE) {
+        return;
+    }
+
+    PHP_V8_CODE_CACHE_CHECK_KEY(key);
+
+    std::string path = php_v8_directory_code_cache_store_path(getThis(), key);
+
+    if (access(path.c_str(), F_OK) != 0) {
+        RETURN_NULL();
+    }
+
+    php_v8_cached_data_from_file(return_value, path.c_str());
+}
+
+static PHP_METHOD(DirectoryCodeCacheStore, set)
+{
+    zend_string *key = NULL;
+    zval *cached_data_zv = NULL;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "So", &key, &cached_data_zv) == FAILURE) {
+        return;
+    }
+
+    PHP_V8_CODE_CACHE_CHECK_KEY(key);
+    PHP_V8_FETCH_CACHED_DATA_WITH_CHECK(cached_data_zv, php_v8_cached_data);
+
+    if (php_v8_cached_data->cached_data->rejected) {
+        return;
+    }
+
+    std::string path = php_v8_directory_code_cache_store_path(getThis(), key);
+
+    const char *data = reinterpret_cast<const char *>(php_v8_cached_data->cached_data->data);
+    size_t length = static_cast<size_t>(php_v8_cached_data->cached_data->length);
+
+    if (!php_v8_directory_code_cache_store_write(path, data, length)) {
+        zend_throw_exception_ex(php_v8_generic_exception_class_entry, 0, "Unable to write code cache file '%s': %s", path.c_str(), strerror(errno));
+    }
+}
+
+static PHP_METHOD(DirectoryCodeCacheStore, delete)
+{
+    zend_string *key = NULL;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "S", &key) == FAILURE) {
+        return;
+    }
+
+    PHP_V8_CODE_CACHE_CHECK_KEY(key);
+
+    std::string path = php_v8_directory_code_cache_store_path(getThis(), key);
+
+    // mapped file stays valid for those who use it, only directory entry is removed
+    if (unlink(path.c_str()) != 0 && errno != ENOENT) {
+        zend_throw_exception_ex(php_v8_generic_exception_class_entry, 0, "Unable to delete code cache file '%s': %s", path.c_str(), strerror(errno));
+    }
+}
+
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_get, ZEND_RETURN_VALUE, 1, V8\\ScriptCompiler\\CachedData, 1)
+                ZEND_ARG_TYPE_INFO(0, key, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_VOID_INFO_EX(arginfo_set, 2)
+                ZEND_ARG_TYPE_INFO(0, key, IS_STRING, 0)
+                ZEND_ARG_OBJ_INFO(0, cached_data, V8\\ScriptCompiler\\CachedData, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_VOID_INFO_EX(arginfo_delete, 1)
+                ZEND_ARG_TYPE_INFO(0, key, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_CONSTRUCTOR_INFO_EX(arginfo___construct, 1)
+                ZEND_ARG_TYPE_INFO(0, directory, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_getDirectory, ZEND_RETURN_VALUE, 0, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
+
+static const zend_function_entry php_v8_code_cache_store_interface_methods[] = {
+        PHP_V8_ABSTRACT_ME(CodeCacheStoreInterface, get)
+        PHP_V8_ABSTRACT_ME(CodeCacheStoreInterface, set)
+        PHP_V8_ABSTRACT_ME(CodeCacheStoreInterface, delete)
+
+        PHP_FE_END
+};
+
+static const zend_function_entry php_v8_memory_code_cache_store_methods[] = {
+        PHP_V8_ME(MemoryCodeCacheStore, get,    ZEND_ACC_PUBLIC)
+        PHP_V8_ME(MemoryCodeCacheStore, set,    ZEND_ACC_PUBLIC)
+        PHP_V8_ME(MemoryCodeCacheStore, delete, ZEND_ACC_PUBLIC)
+
+        PHP_FE_END
+};
+
+static const zend_function_entry php_v8_directory_code_cache_store_methods[] = {
+        PHP_V8_ME(DirectoryCodeCacheStore, __construct,  ZEND_ACC_PUBLIC | ZEND_ACC_CTOR)
+        PHP_V8_ME(DirectoryCodeCacheStore, getDirectory, ZEND_ACC_PUBLIC)
+        PHP_V8_ME(DirectoryCodeCacheStore, get,          ZEND_ACC_PUBLIC)
+        PHP_V8_ME(DirectoryCodeCacheStore, set,          ZEND_ACC_PUBLIC)
+        PHP_V8_ME(DirectoryCodeCacheStore, delete,       ZEND_ACC_PUBLIC)
+
+        PHP_FE_END
+};
+
+
+PHP_MINIT_FUNCTION(php_v8_code_cache) {
+    zend_class_entry ce;
+
+    INIT_NS_CLASS_ENTRY(ce, "V8\\ScriptCompiler", "CodeCacheStoreInterface", php_v8_code_cache_store_interface_methods);
+    php_v8_code_cache_store_interface_class_entry = zend_register_internal_interface(&ce);
+
+    INIT_NS_CLASS_ENTRY(ce, "V8\\ScriptCompiler", "MemoryCodeCacheStore", php_v8_memory_code_cache_store_methods);
+    php_v8_memory_code_cache_store_class_entry = zend_register_internal_class(&ce);
+    zend_class_implements(php_v8_memory_code_cache_store_class_entry, 1, php_v8_code_cache_store_interface_class_entry);
+
+    INIT_NS_CLASS_ENTRY(ce, "V8\\ScriptCompiler", "DirectoryCodeCacheStore", php_v8_directory_code_cache_store_methods);
+    php_v8_directory_code_cache_store_class_entry = zend_register_internal_class(&ce);
+    zend_class_implements(php_v8_directory_code_cache_store_class_entry, 1, php_v8_code_cache_store_interface_class_entry);
+
+    zend_declare_property_string(php_v8_directory_code_cache_store_class_entry, ZEND_STRL("directory"), "", ZEND_ACC_PRIVATE);
+
+    return SUCCESS;
+}
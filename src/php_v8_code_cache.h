@@ -0,0 +1,106 @@
+/*
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+#ifndef PHP_V8_CODE_CACHE_H
+#define PHP_V8_CODE_CACHE_H
+
+namespace phpv8 {
+    class CodeCacheLookup;
+    class PendingCodeCache;
+}
+
+#include "php_v8_exceptions.h"
+#include <v8.h>
+
+extern "C" {
+#include "php.h"
+
+#ifdef ZTS
+#include "TSRM.h"
+#endif
+}
+
+extern zend_class_entry *php_v8_code_cache_store_interface_class_entry;
+extern zend_class_entry *php_v8_memory_code_cache_store_class_entry;
+extern zend_class_entry *php_v8_directory_code_cache_store_class_entry;
+
+extern zval *php_v8_code_cache_get_store();
+extern void php_v8_code_cache_set_store(zval *store_zv);
+extern zend_string *php_v8_code_cache_build_key(v8::Isolate *isolate, v8::Local<v8::String> source, zval *origin_zv);
+extern bool php_v8_code_cache_get(zval *store_zv, zend_string *key, zval *retval);
+extern bool php_v8_code_cache_delete(zval *store_zv, zend_string *key);
+extern bool php_v8_code_cache_produce(zval *store_zv, zend_string *key, v8::Local<v8::UnboundScript> unbound_script, v8::Local<v8::String> source);
+extern void php_v8_code_cache_request_shutdown();
+
+#define PHP_V8_CODE_CACHE_FILE_SUFFIX ".bin"
+
+
+namespace phpv8 {
+    /**
+     * Code cache entry looked up for the source being compiled, holds found cached data (if any) while v8 consumes it
+     */
+    class CodeCacheLookup {
+    public:
+        CodeCacheLookup() : key(nullptr) {
+            ZVAL_UNDEF(&store);
+            ZVAL_NULL(&cached_data);
+        }
+
+        ~CodeCacheLookup();
+
+        bool lookup(zval *store_zv, v8::Isolate *isolate, v8::Local<v8::String> source, zval *origin_zv);
+        bool evict();
+
+        inline bool hit() {
+            return Z_TYPE(cached_data) == IS_OBJECT;
+        }
+
+        bool rejected();
+
+        inline zval *cachedData() {
+            return &cached_data;
+        }
+
+        inline zval *storeZval() {
+            return &store;
+        }
+
+        inline zend_string *cacheKey() {
+            return key;
+        }
+    private:
+        zval store;
+        zval cached_data;
+        zend_string *key;
+    };
+
+    /**
+     * Code cache to be produced once script is executed for the first time, so that it includes lazily compiled
+     * functions too
+     */
+    class PendingCodeCache {
+    public:
+        PendingCodeCache(zval *store_zv, zend_string *key, zval *source_string_zv);
+        ~PendingCodeCache();
+
+        bool produce(v8::Local<v8::UnboundScript> unbound_script);
+    private:
+        zval store;
+        zval source_string;
+        zend_string *key;
+    };
+}
+
+
+PHP_MINIT_FUNCTION(php_v8_code_cache);
+
+#endif //PHP_V8_CODE_CACHE_H
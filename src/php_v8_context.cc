@@ -308,6 +308,30 @@ static PHP_METHOD(Context, setErrorMessageForCodeGenerationFromStrings)
     context->SetErrorMessageForCodeGenerationFromStrings(local_string);
 }
 
+static PHP_METHOD(Context, setUnwrapPrimitives)
+{
+    zend_bool unwrap = '\1';
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "b", &unwrap) == FAILURE) {
+        return;
+    }
+
+    PHP_V8_CONTEXT_FETCH_WITH_CHECK(getThis(), php_v8_context);
+
+    php_v8_context->unwrap_primitives = (bool) unwrap;
+}
+
+static PHP_METHOD(Context, getUnwrapPrimitives)
+{
+    if (zend_parse_parameters_none() == FAILURE) {
+        return;
+    }
+
+    PHP_V8_CONTEXT_FETCH_WITH_CHECK(getThis(), php_v8_context);
+
+    RETURN_BOOL(php_v8_context->unwrap_primitives);
+}
+
 PHP_V8_ZEND_BEGIN_ARG_WITH_CONSTRUCTOR_INFO_EX(arginfo___construct, 1)
     ZEND_ARG_OBJ_INFO(0, isolate, V8\\Isolate, 0)
     ZEND_ARG_OBJ_INFO(0, global_template, V8\\ObjectTemplate, 1)
@@ -348,6 +372,13 @@ PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_VOID_INFO_EX(arginfo_setErrorMessageForCodeGen
                 ZEND_ARG_OBJ_INFO(0, message, V8\\StringValue, 0)
 ZEND_END_ARG_INFO()
 
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_VOID_INFO_EX(arginfo_setUnwrapPrimitives, 1)
+                ZEND_ARG_TYPE_INFO(0, unwrap, _IS_BOOL, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_getUnwrapPrimitives, ZEND_RETURN_VALUE, 0, _IS_BOOL, 0)
+ZEND_END_ARG_INFO()
+
 
 static const zend_function_entry php_v8_context_methods[] = {
     PHP_V8_ME(Context, __construct, ZEND_ACC_PUBLIC | ZEND_ACC_CTOR)
@@ -365,6 +396,9 @@ static const zend_function_entry php_v8_context_methods[] = {
     PHP_V8_ME(Context, isCodeGenerationFromStringsAllowed,          ZEND_ACC_PUBLIC)
     PHP_V8_ME(Context, setErrorMessageForCodeGenerationFromStrings, ZEND_ACC_PUBLIC)
 
+    PHP_V8_ME(Context, setUnwrapPrimitives, ZEND_ACC_PUBLIC)
+    PHP_V8_ME(Context, getUnwrapPrimitives, ZEND_ACC_PUBLIC)
+
     PHP_FE_END
 };
 
@@ -0,0 +1,83 @@
+/*
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "php_v8_data_view.h"
+#include "php_v8_array_buffer_view.h"
+#include "php_v8_object.h"
+#include "php_v8_context.h"
+#include "php_v8_value.h"
+#include "php_v8.h"
+
+zend_class_entry *php_v8_data_view_class_entry;
+#define this_ce php_v8_data_view_class_entry
+
+
+static PHP_METHOD(DataView, __construct) {
+    zval rv;
+    zval *php_v8_context_zv;
+    zval *php_v8_buffer_zv;
+
+    zend_long byte_offset = 0;
+    zend_long byte_length = 0;
+    zend_bool byte_length_is_null = 1;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "oo|ll!", &php_v8_context_zv, &php_v8_buffer_zv, &byte_offset, &byte_length, &byte_length_is_null) == FAILURE) {
+        return;
+    }
+
+    PHP_V8_OBJECT_CONSTRUCT(getThis(), php_v8_context_zv, php_v8_context, php_v8_value);
+
+    PHP_V8_VALUE_FETCH_WITH_CHECK(php_v8_buffer_zv, php_v8_buffer);
+    PHP_V8_DATA_ISOLATES_CHECK(php_v8_value, php_v8_buffer);
+
+    v8::Local<v8::ArrayBuffer> local_buffer = php_v8_value_get_local_as<v8::ArrayBuffer>(php_v8_buffer);
+
+    if (!php_v8_array_buffer_view_check_range(local_buffer, byte_offset, &byte_length, static_cast<bool>(byte_length_is_null), 1)) {
+        return;
+    }
+
+    v8::Local<v8::DataView> local_data_view = v8::DataView::New(local_buffer, static_cast<size_t>(byte_offset), static_cast<size_t>(byte_length));
+
+    PHP_V8_THROW_VALUE_EXCEPTION_WHEN_EMPTY(local_data_view, "Failed to create DataView value");
+
+    php_v8_object_store_self_ptr(php_v8_value, local_data_view);
+
+    php_v8_value->persistent.Reset(isolate, local_data_view);
+}
+
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_CONSTRUCTOR_INFO_EX(arginfo___construct, 2)
+                ZEND_ARG_OBJ_INFO(0, context, V8\\Context, 0)
+                ZEND_ARG_OBJ_INFO(0, buffer, V8\\ArrayBufferObject, 0)
+                ZEND_ARG_TYPE_INFO(0, byte_offset, IS_LONG, 0)
+                ZEND_ARG_TYPE_INFO(0, byte_length, IS_LONG, 1)
+ZEND_END_ARG_INFO()
+
+
+static const zend_function_entry php_v8_data_view_methods[] = {
+        PHP_V8_ME(DataView, __construct, ZEND_ACC_PUBLIC | ZEND_ACC_CTOR)
+
+        PHP_FE_END
+};
+
+
+PHP_MINIT_FUNCTION(php_v8_data_view) {
+    zend_class_entry ce;
+    INIT_NS_CLASS_ENTRY(ce, PHP_V8_NS, "DataViewObject", php_v8_data_view_methods);
+    this_ce = zend_register_internal_class_ex(&ce, php_v8_array_buffer_view_class_entry);
+
+    return SUCCESS;
+}
@@ -44,7 +44,7 @@ static PHP_METHOD(Date, __construct) {
 
     php_v8_object_store_self_ptr(php_v8_value, local_date);
 
-    php_v8_value->persistent->Reset(isolate, local_date);
+    php_v8_value->persistent.Reset(isolate, local_date);
 }
 
 
@@ -0,0 +1,173 @@
+/*
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "php_v8_deserializer.h"
+#include "php_v8_wire_format.h"
+#include "php_v8_value_converter.h"
+#include "php_v8_exceptions.h"
+#include "php_v8_object.h"
+#include "php_v8_value.h"
+#include "php_v8_context.h"
+#include "php_v8.h"
+
+zend_class_entry *php_v8_deserializer_class_entry;
+#define this_ce php_v8_deserializer_class_entry
+
+
+namespace phpv8 {
+    v8::MaybeLocal<v8::Object> DeserializerDelegate::ReadHostObject(v8::Isolate *isolate) {
+        if (!fci) {
+            return v8::ValueDeserializer::Delegate::ReadHostObject(isolate);
+        }
+
+        uint32_t length;
+        const void *data;
+
+        if (!deserializer->ReadUint32(&length) || !deserializer->ReadRawBytes(length, &data)) {
+            isolate->ThrowException(v8::Exception::Error(v8::String::NewFromUtf8(isolate, "Unable to read host object data", v8::NewStringType::kNormal).ToLocalChecked()));
+
+            return v8::MaybeLocal<v8::Object>();
+        }
+
+        zval args[1];
+        zval retval;
+
+        ZVAL_STRINGL(&args[0], static_cast<const char *>(data), length);
+        ZVAL_UNDEF(&retval);
+
+        fci->params = args;
+        fci->param_count = 1;
+        fci->retval = &retval;
+
+        php_v8_isolate_limits_callback_enter(php_v8_isolate);
+        zend_call_function(fci, fci_cache);
+        php_v8_isolate_limits_callback_leave(php_v8_isolate);
+
+        zval_ptr_dtor(&args[0]);
+
+        if (!EG(exception)
+            && (Z_TYPE(retval) != IS_OBJECT || !instanceof_function(Z_OBJCE(retval), php_v8_object_class_entry))) {
+            PHP_V8_THROW_VALUE_EXCEPTION("Host object reader should return V8\\ObjectValue");
+        }
+
+        if (!EG(exception) && PHP_V8_VALUE_FETCH(&retval)->php_v8_isolate != php_v8_isolate) {
+            PHP_V8_THROW_EXCEPTION(PHP_V8_ISOLATES_MISMATCH_MSG);
+        }
+
+        if (EG(exception)) {
+            // php exception is what caller gets, js one only stops deserialization
+            zval_ptr_dtor(&retval);
+            isolate->ThrowException(v8::Exception::Error(v8::String::NewFromUtf8(isolate, "Host object deserialization failed", v8::NewStringType::kNormal).ToLocalChecked()));
+
+            return v8::MaybeLocal<v8::Object>();
+        }
+
+        v8::Local<v8::Object> local_object = php_v8_value_get_local_as<v8::Object>(PHP_V8_VALUE_FETCH(&retval));
+
+        zval_ptr_dtor(&retval);
+
+        return local_object;
+    }
+}
+
+
+static PHP_METHOD(Deserializer, deserialize) {
+    zval *php_v8_context_zv;
+    zend_string *data;
+
+    zend_fcall_info fci = empty_fcall_info;
+    zend_fcall_info_cache fci_cache = empty_fcall_info_cache;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "oS|f!", &php_v8_context_zv, &data, &fci, &fci_cache) == FAILURE) {
+        return;
+    }
+
+    PHP_V8_CONTEXT_FETCH_WITH_CHECK(php_v8_context_zv, php_v8_context);
+
+    PHP_V8_ENTER_STORED_ISOLATE(php_v8_context);
+    PHP_V8_ENTER_CONTEXT(php_v8_context);
+
+    phpv8::DeserializerDelegate delegate(php_v8_context->php_v8_isolate, fci.size ? &fci : nullptr, fci.size ? &fci_cache : nullptr);
+    v8::ValueDeserializer deserializer(isolate, reinterpret_cast<const uint8_t *>(ZSTR_VAL(data)), ZSTR_LEN(data), &delegate);
+
+    delegate.deserializer = &deserializer;
+
+    PHP_V8_TRY_CATCH(isolate);
+    PHP_V8_INIT_ISOLATE_LIMITS_ON_CONTEXT(php_v8_context);
+
+    v8::MaybeLocal<v8::Value> maybe_local_value;
+
+    if (deserializer.ReadHeader(context).FromMaybe(false)) {
+        maybe_local_value = deserializer.ReadValue(context);
+    }
+
+    if (EG(exception)) {
+        // exception thrown from host object reader
+        php_v8_isolate_limits_maybe_stop_timer(php_v8_context->php_v8_isolate);
+        return;
+    }
+
+    PHP_V8_MAYBE_CATCH(php_v8_context, try_catch);
+    PHP_V8_THROW_EXCEPTION_WHEN_EMPTY(maybe_local_value, "Failed to deserialize");
+
+    php_v8_get_or_create_value(return_value, maybe_local_value.ToLocalChecked(), php_v8_context->php_v8_isolate);
+}
+
+static PHP_METHOD(Deserializer, decode) {
+    zend_string *data;
+
+    zend_fcall_info fci = empty_fcall_info;
+    zend_fcall_info_cache fci_cache = empty_fcall_info_cache;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "S|f!", &data, &fci, &fci_cache) == FAILURE) {
+        return;
+    }
+
+    phpv8::WireFormatDecoder decoder(ZSTR_VAL(data), ZSTR_LEN(data),
+                                     fci.size ? &fci : nullptr, fci.size ? &fci_cache : nullptr,
+                                     PHP_V8_VALUE_CONVERTER_DEFAULT_MAX_DEPTH);
+
+    decoder.decode(return_value);
+}
+
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_deserialize, ZEND_RETURN_VALUE, 2, V8\\Value, 0)
+                ZEND_ARG_OBJ_INFO(0, context, V8\\Context, 0)
+                ZEND_ARG_TYPE_INFO(0, data, IS_STRING, 0)
+                ZEND_ARG_CALLABLE_INFO(0, host_object_reader, 1)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_INFO_EX(arginfo_decode, ZEND_SEND_BY_VAL, ZEND_RETURN_VALUE, 1)
+                ZEND_ARG_TYPE_INFO(0, data, IS_STRING, 0)
+                ZEND_ARG_CALLABLE_INFO(0, host_object_decoder, 1)
+ZEND_END_ARG_INFO()
+
+
+static const zend_function_entry php_v8_deserializer_methods[] = {
+        PHP_V8_ME(Deserializer, deserialize, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+        PHP_V8_ME(Deserializer, decode,      ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+
+        PHP_FE_END
+};
+
+
+PHP_MINIT_FUNCTION(php_v8_deserializer) {
+    zend_class_entry ce;
+    INIT_NS_CLASS_ENTRY(ce, PHP_V8_NS, "Deserializer", php_v8_deserializer_methods);
+    this_ce = zend_register_internal_class(&ce);
+
+    return SUCCESS;
+}
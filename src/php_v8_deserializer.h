@@ -0,0 +1,57 @@
+/*
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+#ifndef PHP_V8_DESERIALIZER_H
+#define PHP_V8_DESERIALIZER_H
+
+namespace phpv8 {
+    class DeserializerDelegate;
+}
+
+#include "php_v8_isolate.h"
+#include <v8.h>
+
+extern "C" {
+#include "php.h"
+
+#ifdef ZTS
+#include "TSRM.h"
+#endif
+}
+
+extern zend_class_entry* php_v8_deserializer_class_entry;
+
+
+namespace phpv8 {
+
+    /**
+     * Deserializer delegate that hands host objects data over to php callback, counterpart of SerializerDelegate.
+     */
+    class DeserializerDelegate : public v8::ValueDeserializer::Delegate {
+    public:
+        DeserializerDelegate(php_v8_isolate_t *php_v8_isolate, zend_fcall_info *fci, zend_fcall_info_cache *fci_cache)
+                : php_v8_isolate(php_v8_isolate), fci(fci), fci_cache(fci_cache) {}
+
+        v8::MaybeLocal<v8::Object> ReadHostObject(v8::Isolate *isolate) override;
+
+        v8::ValueDeserializer *deserializer = nullptr;
+    private:
+        php_v8_isolate_t *php_v8_isolate;
+        zend_fcall_info *fci;
+        zend_fcall_info_cache *fci_cache;
+    };
+}
+
+
+PHP_MINIT_FUNCTION(php_v8_deserializer);
+
+#endif //PHP_V8_DESERIALIZER_H
@@ -26,6 +26,7 @@ zend_class_entry *php_v8_property_filter_class_entry;
 zend_class_entry *php_v8_key_collection_mode_class_entry;
 zend_class_entry *php_v8_index_filter_class_entry;
 zend_class_entry *php_v8_rail_mode_class_entry;
+zend_class_entry *php_v8_callback_flags_class_entry;
 
 
 static const zend_function_entry php_v8_enum_methods[] = {
@@ -139,5 +140,15 @@ PHP_MINIT_FUNCTION (php_v8_enums) {
     zend_declare_class_constant_long(this_ce, ZEND_STRL("PERFORMANCE_LOAD"),      static_cast<zend_long>(v8::RAILMode::PERFORMANCE_LOAD));
     #undef this_ce
 
+    // Non-standard, php callbacks registration flags
+    #define this_ce php_v8_callback_flags_class_entry
+    INIT_NS_CLASS_ENTRY(ce, PHP_V8_NS, "CallbackFlags", php_v8_enum_methods);
+    this_ce = zend_register_internal_class(&ce);
+    this_ce->ce_flags |= ZEND_ACC_FINAL;
+
+    zend_declare_class_constant_long(this_ce, ZEND_STRL("NONE"),          PHP_V8_CALLBACK_FLAGS_NONE);
+    zend_declare_class_constant_long(this_ce, ZEND_STRL("DIRECT_RETURN"), PHP_V8_CALLBACK_FLAGS_DIRECT_RETURN);
+    #undef this_ce
+
     return SUCCESS;
 }
@@ -32,6 +32,7 @@ extern zend_class_entry* php_v8_property_filter_class_entry;
 extern zend_class_entry* php_v8_key_collection_mode_class_entry;
 extern zend_class_entry* php_v8_index_filter_class_entry;
 extern zend_class_entry *php_v8_rail_mode_class_entry;
+extern zend_class_entry *php_v8_callback_flags_class_entry;
 
 
 #define PHP_V8_ACCESS_CONTROL_FLAGS ( 0 \
@@ -83,6 +84,14 @@ extern zend_class_entry *php_v8_rail_mode_class_entry;
   | static_cast<long>(v8::IndexFilter::kSkipIndices)    \
 )
 
+#define PHP_V8_CALLBACK_FLAGS_NONE          0
+#define PHP_V8_CALLBACK_FLAGS_DIRECT_RETURN 1
+
+#define PHP_V8_CALLBACK_FLAGS ( 0           \
+  | PHP_V8_CALLBACK_FLAGS_NONE              \
+  | PHP_V8_CALLBACK_FLAGS_DIRECT_RETURN     \
+)
+
 PHP_MINIT_FUNCTION (php_v8_enums);
 
 #endif //PHP_V8_ENUMS_H
@@ -54,10 +54,16 @@ void php_v8_create_try_catch_exception(zval *return_value, php_v8_isolate_t *php
     PHP_V8_DECLARE_LIMITS(php_v8_isolate);
     PHP_V8_DECLARE_ISOLATE(php_v8_isolate);
 
-    if ((try_catch == NULL) || (try_catch->Exception()->IsNull() && try_catch->Message().IsEmpty() && !try_catch->CanContinue() && try_catch->HasTerminated())) {
+    // failed ArrayBuffer allocation throws RangeError right away, before pending termination takes place
+    if ((try_catch == NULL)
+        || (try_catch->Exception()->IsNull() && try_catch->Message().IsEmpty() && !try_catch->CanContinue() && try_catch->HasTerminated())
+        || limits->memory_limit_hit) {
         if (limits->time_limit_hit) {
             ce = php_v8_time_limit_exception_class_entry;
             message = "Time limit exceeded";
+        } else if (limits->cpu_time_limit_hit) {
+            ce = php_v8_time_limit_exception_class_entry;
+            message = "CPU time limit exceeded";
         } else if (limits->memory_limit_hit) {
             ce = php_v8_memory_limit_exception_class_entry;
             message = "Memory limit exceeded";
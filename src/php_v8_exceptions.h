@@ -106,7 +106,9 @@ extern void php_v8_throw_try_catch_exception(php_v8_context_t *php_v8_context, v
 
 
 #define PHP_V8_THROW_EXCEPTION_WHEN_LIMITS_HIT(php_v8_context) \
-    if ((php_v8_context)->php_v8_isolate->limits.time_limit_hit || (php_v8_context)->php_v8_isolate->limits.memory_limit_hit) { \
+    if ((php_v8_context)->php_v8_isolate->limits.time_limit_hit \
+        || (php_v8_context)->php_v8_isolate->limits.cpu_time_limit_hit \
+        || (php_v8_context)->php_v8_isolate->limits.memory_limit_hit) { \
         php_v8_throw_try_catch_exception((php_v8_context), NULL); \
         return; \
     }
@@ -32,7 +32,7 @@ void php_v8_ext_mem_interface_value_AdjustExternalAllocatedMemory(INTERNAL_FUNCT
 
     PHP_V8_VALUE_FETCH_INTO(getThis(), php_v8_value);
 
-    RETURN_LONG(php_v8_value->persistent_data->adjustSize(change_in_bytes));
+    RETURN_LONG(php_v8_value_get_persistent_data(php_v8_value)->adjustSize(change_in_bytes));
 }
 
 void php_v8_ext_mem_interface_value_GetExternalAllocatedMemory(INTERNAL_FUNCTION_PARAMETERS) {
@@ -42,6 +42,10 @@ void php_v8_ext_mem_interface_value_GetExternalAllocatedMemory(INTERNAL_FUNCTION
 
     PHP_V8_VALUE_FETCH_INTO(getThis(), php_v8_value);
 
+    if (!php_v8_value->persistent_data) {
+        RETURN_LONG(0);
+    }
+
     RETURN_LONG(php_v8_value->persistent_data->getAdjustedSize());
 }
 
@@ -17,6 +17,7 @@
 #include "php_v8_script_origin.h"
 #include "php_v8_function.h"
 #include "php_v8_value.h"
+#include "php_v8_value_converter.h"
 #include "php_v8_string.h"
 #include "php_v8_object.h"
 #include "php_v8_context.h"
@@ -27,88 +28,203 @@ zend_class_entry *php_v8_function_class_entry;
 #define this_ce php_v8_function_class_entry
 
 
-bool php_v8_function_unpack_args(zval *arguments_zv, int arg_position, v8::Isolate *isolate, int *argc, v8::Local<v8::Value> **argv) {
+static bool php_v8_function_check_arg(php_v8_value_t *php_v8_tmp_data, v8::Isolate *isolate, int arg_position, int offset) {
+    char *exception_message;
+
+    // Check for emptiness may be considered redundant while we may catch the fact that value was not properly
+    // constructed by checking isolates mismatch, but this check serves for user-friendly purposes to throw
+    // less confusing exception message
+    if (php_v8_tmp_data->persistent.IsEmpty()) {
+        if (offset < 0) {
+            spprintf(&exception_message, 0, PHP_V8_EMPTY_VALUE_MSG ": argument %d passed to %s::%s()",
+                     arg_position, ZSTR_VAL(zend_get_executed_scope()->name), get_active_function_name());
+        } else {
+            spprintf(&exception_message, 0, PHP_V8_EMPTY_VALUE_MSG ": argument %d passed to %s::%s() at %d offset",
+                     arg_position, ZSTR_VAL(zend_get_executed_scope()->name), get_active_function_name(), offset);
+        }
+
+        PHP_V8_THROW_EXCEPTION(exception_message);
+
+        efree(exception_message);
+        return false;
+    }
+
+    if (NULL == php_v8_tmp_data->php_v8_isolate || isolate != php_v8_tmp_data->php_v8_isolate->isolate) {
+        if (offset < 0) {
+            spprintf(&exception_message, 0, PHP_V8_ISOLATES_MISMATCH_MSG ": argument %d passed to %s::%s()",
+                     arg_position, ZSTR_VAL(zend_get_executed_scope()->name), get_active_function_name());
+        } else {
+            spprintf(&exception_message, 0, PHP_V8_ISOLATES_MISMATCH_MSG ": argument %d passed to %s::%s() at %d offset",
+                     arg_position, ZSTR_VAL(zend_get_executed_scope()->name), get_active_function_name(), offset);
+        }
+
+        PHP_V8_THROW_EXCEPTION(exception_message);
+
+        efree(exception_message);
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Checks whether zval holds \V8\Value instance. Arguments are usually of a few classes, so the last class which passed
+ * the check is remembered to skip walking class hierarchy for the following arguments.
+ */
+static inline bool php_v8_function_is_value_arg(zval *pzval, zend_class_entry **checked_ce) {
+    if (Z_TYPE_P(pzval) != IS_OBJECT) {
+        return false;
+    }
+
+    if (Z_OBJCE_P(pzval) == *checked_ce) {
+        return true;
+    }
+
+    if (!instanceof_function(Z_OBJCE_P(pzval), php_v8_value_class_entry)) {
+        return false;
+    }
+
+    *checked_ce = Z_OBJCE_P(pzval);
+
+    return true;
+}
+
+bool php_v8_function_unpack_args(zval *arguments_zv, int arg_position, v8::Isolate *isolate, phpv8::CallArguments<v8::Value> &arguments) {
     if (NULL == arguments_zv || zend_hash_num_elements(Z_ARRVAL_P(arguments_zv)) < 1) {
         return true;
     }
 
     php_v8_value_t *php_v8_tmp_data;
+    zend_class_entry *checked_ce = NULL;
 
     int i = 0;
-    bool has_error = false;
-
-    HashTable *myht;
     zval *pzval;
 
-    *argc = zend_hash_num_elements(Z_ARRVAL_P(arguments_zv));
-    *argv = (v8::Local<v8::Value> *) ecalloc(static_cast<size_t>(*argc), sizeof(*argv));
+    arguments.reserve(zend_hash_num_elements(Z_ARRVAL_P(arguments_zv)));
+
+    ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(arguments_zv), pzval) {
+        if (!php_v8_function_is_value_arg(pzval, &checked_ce)) {
+            if (Z_TYPE_P(pzval) != IS_OBJECT) {
+                zend_throw_error(zend_ce_type_error,
+                                 "Argument %d passed to %s::%s() must be an array of \\V8\\Value objects, %s given at %d offset",
+                                 arg_position, ZSTR_VAL(zend_get_executed_scope()->name), get_active_function_name(),
+                                 zend_zval_type_name(pzval), i);
+            } else {
+                zend_throw_error(zend_ce_type_error,
+                                 "Argument %d passed to %s::%s() must be an array of \\V8\\Value objects, instance of %s given at %d offset",
+                                 arg_position, ZSTR_VAL(zend_get_executed_scope()->name), get_active_function_name(),
+                                 ZSTR_VAL(Z_OBJCE_P(pzval)->name), i);
+            }
+
+            return false;
+        }
 
-    myht = Z_ARRVAL_P(arguments_zv);
+        php_v8_tmp_data = PHP_V8_VALUE_FETCH(pzval);
 
-    char *exception_message;
+        if (!php_v8_function_check_arg(php_v8_tmp_data, isolate, arg_position, i)) {
+            return false;
+        }
 
-    zend_string *ce_name = zend_get_executed_scope()->name;
+        arguments.push(php_v8_value_get_local(php_v8_tmp_data));
+        i++;
+    } ZEND_HASH_FOREACH_END();
 
-    ZEND_HASH_FOREACH_VAL(myht, pzval) {
-        if (Z_TYPE_P(pzval) != IS_OBJECT) {
-            zend_throw_error(zend_ce_type_error,
-                             "Argument %d passed to %s::%s() must be an array of \\V8\\Value objects, %s given at %d offset",
-                             arg_position, ZSTR_VAL(ce_name), get_active_function_name(),
-                             zend_zval_type_name(pzval), i);
+    return true;
+}
+
+static bool php_v8_function_unpack_mixed_arg(zval *pzval, int arg_position, int offset, zend_class_entry **checked_ce,
+                                             v8::Isolate *isolate, phpv8::ValueConverter &converter,
+                                             phpv8::CallArguments<v8::Value> &arguments) {
+    ZVAL_DEREF(pzval);
 
-            has_error = true;
-            break;
+    if (php_v8_function_is_value_arg(pzval, checked_ce)) {
+        php_v8_value_t *php_v8_tmp_data = PHP_V8_VALUE_FETCH(pzval);
+
+        if (!php_v8_function_check_arg(php_v8_tmp_data, isolate, arg_position, offset)) {
+            return false;
         }
 
-        if (!instanceof_function(Z_OBJCE_P(pzval), php_v8_value_class_entry)) {
-            zend_throw_error(zend_ce_type_error,
-                             "Argument %d passed to %s::%s() must be an array of \\V8\\Value objects, instance of %s given at %d offset",
-                             arg_position, ZSTR_VAL(ce_name), get_active_function_name(),
-                             ZSTR_VAL(Z_OBJCE_P(pzval)->name), i);
+        arguments.push(php_v8_value_get_local(php_v8_tmp_data));
+        return true;
+    }
 
-            has_error = true;
-            break;
+    if (Z_TYPE_P(pzval) > IS_STRING) {
+        if (offset < 0 && Z_TYPE_P(pzval) != IS_OBJECT) {
+            zend_throw_error(zend_ce_type_error,
+                             "Argument %d passed to %s::%s() must be an instance of \\V8\\Value or scalar, %s given",
+                             arg_position, ZSTR_VAL(zend_get_executed_scope()->name), get_active_function_name(),
+                             zend_zval_type_name(pzval));
+        } else if (offset < 0) {
+            zend_throw_error(zend_ce_type_error,
+                             "Argument %d passed to %s::%s() must be an instance of \\V8\\Value or scalar, instance of %s given",
+                             arg_position, ZSTR_VAL(zend_get_executed_scope()->name), get_active_function_name(),
+                             ZSTR_VAL(Z_OBJCE_P(pzval)->name));
+        } else if (Z_TYPE_P(pzval) != IS_OBJECT) {
+            zend_throw_error(zend_ce_type_error,
+                             "Argument %d passed to %s::%s() must be an array of \\V8\\Value objects or scalars, %s given at %d offset",
+                             arg_position, ZSTR_VAL(zend_get_executed_scope()->name), get_active_function_name(),
+                             zend_zval_type_name(pzval), offset);
+        } else {
+            zend_throw_error(zend_ce_type_error,
+                             "Argument %d passed to %s::%s() must be an array of \\V8\\Value objects or scalars, instance of %s given at %d offset",
+                             arg_position, ZSTR_VAL(zend_get_executed_scope()->name), get_active_function_name(),
+                             ZSTR_VAL(Z_OBJCE_P(pzval)->name), offset);
         }
 
-        php_v8_tmp_data = PHP_V8_VALUE_FETCH(pzval);
+        return false;
+    }
 
-        // Check for emptiness may be considered redundant while we may catch the fact that value was not properly
-        // constructed by checking isolates mismatch, but this check serves for user-friendly purposes to throw
-        // less confusing exception message
-        if (NULL == php_v8_tmp_data->persistent || php_v8_tmp_data->persistent->IsEmpty()) {
-            spprintf(&exception_message, 0, PHP_V8_EMPTY_VALUE_MSG ": argument %d passed to %s::%s() at %d offset",
-                     arg_position, ZSTR_VAL(ce_name), get_active_function_name(), i);
+    v8::Local<v8::Value> local_value;
 
-            PHP_V8_THROW_EXCEPTION(exception_message);
+    if (!converter.fromPhp(pzval).ToLocal(&local_value)) {
+        return false;
+    }
 
-            efree(exception_message);
-            has_error = true;
-            break;
-        }
+    arguments.push(local_value);
+
+    return true;
+}
 
-        if (NULL == php_v8_tmp_data->php_v8_isolate || isolate != php_v8_tmp_data->php_v8_isolate->isolate) {
-            spprintf(&exception_message, 0,
-                     PHP_V8_ISOLATES_MISMATCH_MSG ": argument %d passed to %s::%s() at %d offset",
-                     arg_position, ZSTR_VAL(ce_name), get_active_function_name(), i);
+bool php_v8_function_unpack_variadic_args(zval *args, int args_count, int arg_position, php_v8_context_t *php_v8_context, v8::Local<v8::Context> context, phpv8::CallArguments<v8::Value> &arguments) {
+    zend_class_entry *checked_ce = NULL;
+    v8::Isolate *isolate = php_v8_context->php_v8_isolate->isolate;
 
-            PHP_V8_THROW_EXCEPTION(exception_message);
+    phpv8::ValueConverter converter(php_v8_context->php_v8_isolate, context, PHP_V8_VALUE_CONVERTER_DEFAULT_MAX_DEPTH);
 
-            efree(exception_message);
-            has_error = true;
-            break;
-        }
+    arguments.reserve(args_count);
 
-        (*argv)[i++] = php_v8_value_get_local(php_v8_tmp_data);
-    } ZEND_HASH_FOREACH_END();
+    for (int i = 0; i < args_count; i++) {
+        if (!php_v8_function_unpack_mixed_arg(&args[i], arg_position + i, -1, &checked_ce, isolate, converter, arguments)) {
+            return false;
+        }
+    }
 
-    if (has_error) {
-        efree(*argv);
-        *argv = NULL;
-        *argc = 0;
+    return true;
+}
 
-        return false;
+bool php_v8_function_unpack_mixed_args(zval *arguments_zv, int arg_position, php_v8_context_t *php_v8_context, v8::Local<v8::Context> context, phpv8::CallArguments<v8::Value> &arguments) {
+    if (NULL == arguments_zv || zend_hash_num_elements(Z_ARRVAL_P(arguments_zv)) < 1) {
+        return true;
     }
 
+    zend_class_entry *checked_ce = NULL;
+    v8::Isolate *isolate = php_v8_context->php_v8_isolate->isolate;
+
+    phpv8::ValueConverter converter(php_v8_context->php_v8_isolate, context, PHP_V8_VALUE_CONVERTER_DEFAULT_MAX_DEPTH);
+
+    int i = 0;
+    zval *pzval;
+
+    arguments.reserve(zend_hash_num_elements(Z_ARRVAL_P(arguments_zv)));
+
+    ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(arguments_zv), pzval) {
+        if (!php_v8_function_unpack_mixed_arg(pzval, arg_position, i, &checked_ce, isolate, converter, arguments)) {
+            return false;
+        }
+
+        i++;
+    } ZEND_HASH_FOREACH_END();
+
     return true;
 }
 
@@ -160,7 +276,7 @@ bool php_v8_function_unpack_string_args(zval* arguments_zv, int arg_position, v8
                 // Check for emptiness may be considered redundant while we may catch the fact that value was not properly
                 // constructed by checking isolates mismatch, but this check serves for user-friendly purposes to throw
                 // less confusing exception message
-                if (NULL == php_v8_tmp_data->persistent || php_v8_tmp_data->persistent->IsEmpty()) {
+                if (php_v8_tmp_data->persistent.IsEmpty()) {
                     spprintf(&exception_message, 0, PHP_V8_EMPTY_VALUE_MSG ": argument %d passed to %s::%s() at %d offset",
                              arg_position, ZSTR_VAL(ce_name), get_active_function_name(), i);
 
@@ -245,7 +361,7 @@ bool php_v8_function_unpack_object_args(zval* arguments_zv, int arg_position, v8
                 // Check for emptiness may be considered redundant while we may catch the fact that value was not properly
                 // constructed by checking isolates mismatch, but this check serves for user-friendly purposes to throw
                 // less confusing exception message
-                if (NULL == php_v8_tmp_data->persistent || php_v8_tmp_data->persistent->IsEmpty()) {
+                if (php_v8_tmp_data->persistent.IsEmpty()) {
                     spprintf(&exception_message, 0, PHP_V8_EMPTY_VALUE_MSG ": argument %d passed to %s::%s() at %d offset",
                              arg_position, ZSTR_VAL(ce_name), get_active_function_name(), i);
 
@@ -292,15 +408,17 @@ static PHP_METHOD(Function, __construct) {
 
     zend_long length = 0;
     zend_long behavior = static_cast<zend_long>(v8::ConstructorBehavior::kAllow);
+    zend_long flags = PHP_V8_CALLBACK_FLAGS_NONE;
 
     v8::FunctionCallback callback = 0;
     v8::Local<v8::External> data;
 
-    if (zend_parse_parameters(ZEND_NUM_ARGS(), "of|ll", &php_v8_context_zv, &fci, &fci_cache, &length, &behavior) == FAILURE) {
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "of|lll", &php_v8_context_zv, &fci, &fci_cache, &length, &behavior, &flags) == FAILURE) {
         return;
     }
 
     behavior = behavior ? behavior & PHP_V8_CONSTRUCTOR_BEHAVIOR_FLAGS : behavior;
+    flags = flags ? flags & PHP_V8_CALLBACK_FLAGS : flags;
 
     PHP_V8_CHECK_FUNCTION_LENGTH_RANGE(length, "Length is out of range");
 
@@ -317,12 +435,12 @@ static PHP_METHOD(Function, __construct) {
     PHP_V8_ENTER_CONTEXT(php_v8_context);
 
     if (fci.size) {
-        phpv8::CallbacksBucket *bucket = php_v8_value->persistent_data->bucket("callback");
+        phpv8::CallbacksBucket *bucket = php_v8_value_get_persistent_data(php_v8_value)->bucket("callback");
         data = v8::External::New(isolate, bucket);
 
         bucket->add(phpv8::CallbacksBucket::Index::Getter, fci, fci_cache);
 
-        callback = php_v8_callback_function;
+        callback = flags & PHP_V8_CALLBACK_FLAGS_DIRECT_RETURN ? php_v8_callback_function_direct : php_v8_callback_function;
     }
 
     v8::MaybeLocal<v8::Function> maybe_local_function = v8::Function::New(context,
@@ -340,16 +458,14 @@ static PHP_METHOD(Function, __construct) {
 
     php_v8_object_store_self_ptr(php_v8_value, local_function);
 
-    php_v8_value->persistent->Reset(isolate, local_function);
+    php_v8_value->persistent.Reset(isolate, local_function);
 }
 
 static PHP_METHOD(Function, newInstance) {
     zval *php_v8_context_zv;
     zval *arguments_zv = NULL;
 
-    int argc = 0;
-    v8::Local<v8::Value> *argv = NULL;
-
+    phpv8::CallArguments<v8::Value> arguments;
 
     if (zend_parse_parameters(ZEND_NUM_ARGS(), "o|a", &php_v8_context_zv, &arguments_zv) == FAILURE) {
         return;
@@ -363,7 +479,7 @@ static PHP_METHOD(Function, newInstance) {
     PHP_V8_ENTER_STORED_ISOLATE(php_v8_context);
     PHP_V8_ENTER_CONTEXT(php_v8_context);
 
-    if (!php_v8_function_unpack_args(arguments_zv, 2, isolate, &argc, &argv)) {
+    if (!php_v8_function_unpack_args(arguments_zv, 2, isolate, arguments)) {
         return;
     }
 
@@ -372,11 +488,7 @@ static PHP_METHOD(Function, newInstance) {
     PHP_V8_TRY_CATCH(isolate);
     PHP_V8_INIT_ISOLATE_LIMITS_ON_CONTEXT(php_v8_context);
 
-    v8::MaybeLocal<v8::Object> maybe_local_obj = local_function->NewInstance(context, argc, argv);
-
-    if (argv) {
-        efree(argv);
-    }
+    v8::MaybeLocal<v8::Object> maybe_local_obj = local_function->NewInstance(context, arguments.argc(), arguments.argv());
 
     PHP_V8_MAYBE_CATCH(php_v8_context, try_catch);
     PHP_V8_THROW_VALUE_EXCEPTION_WHEN_EMPTY(maybe_local_obj, "Failed to create instance");
@@ -391,8 +503,7 @@ static PHP_METHOD(Function, call) {
     zval *php_v8_recv_zv;
     zval *arguments_zv = NULL;
 
-    int argc = 0;
-    v8::Local<v8::Value> *argv = NULL;
+    phpv8::CallArguments<v8::Value> arguments;
 
     if (zend_parse_parameters(ZEND_NUM_ARGS(), "oo|a", &php_v8_context_zv, &php_v8_recv_zv, &arguments_zv) == FAILURE) {
         return;
@@ -408,7 +519,7 @@ static PHP_METHOD(Function, call) {
     PHP_V8_ENTER_STORED_ISOLATE(php_v8_context);
     PHP_V8_ENTER_CONTEXT(php_v8_context);
 
-    if (!php_v8_function_unpack_args(arguments_zv, 3, isolate, &argc, &argv)) {
+    if (!php_v8_function_unpack_args(arguments_zv, 3, isolate, arguments)) {
         return;
     }
 
@@ -418,18 +529,57 @@ static PHP_METHOD(Function, call) {
     PHP_V8_TRY_CATCH(isolate);
     PHP_V8_INIT_ISOLATE_LIMITS_ON_CONTEXT(php_v8_context);
 
-    v8::MaybeLocal<v8::Value> maybe_local_res = local_function->Call(context, local_recv, argc, argv);
+    v8::MaybeLocal<v8::Value> maybe_local_res = local_function->Call(context, local_recv, arguments.argc(), arguments.argv());
+
+    PHP_V8_MAYBE_CATCH(php_v8_context, try_catch);
+    PHP_V8_THROW_VALUE_EXCEPTION_WHEN_EMPTY(maybe_local_res, "Failed to call");
+
+    v8::Local<v8::Value> local_res = maybe_local_res.ToLocalChecked();
+
+    php_v8_get_or_unwrap_value(return_value, local_res, php_v8_context);
+}
+
+/* Non-standard, variadic call which also accepts php scalars as arguments */
+static PHP_METHOD(Function, callArgs) {
+    zval *php_v8_context_zv;
+    zval *php_v8_recv_zv;
+    zval *args = NULL;
+    int args_count = 0;
+
+    phpv8::CallArguments<v8::Value> arguments;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "oo*", &php_v8_context_zv, &php_v8_recv_zv, &args, &args_count) == FAILURE) {
+        return;
+    }
+
+    PHP_V8_VALUE_FETCH_WITH_CHECK(getThis(), php_v8_value);
+    PHP_V8_VALUE_FETCH_WITH_CHECK(php_v8_recv_zv, php_v8_value_recv);
+    PHP_V8_CONTEXT_FETCH_WITH_CHECK(php_v8_context_zv, php_v8_context);
+
+    PHP_V8_DATA_ISOLATES_CHECK(php_v8_value, php_v8_value_recv)
+    PHP_V8_DATA_ISOLATES_CHECK(php_v8_value, php_v8_context)
+
+    PHP_V8_ENTER_STORED_ISOLATE(php_v8_context);
+    PHP_V8_ENTER_CONTEXT(php_v8_context);
 
-    if (argv) {
-        efree(argv);
+    if (!php_v8_function_unpack_variadic_args(args, args_count, 3, php_v8_context, context, arguments)) {
+        return;
     }
 
+    v8::Local<v8::Value> local_recv = php_v8_value_get_local(php_v8_value_recv);
+    v8::Local<v8::Function> local_function = php_v8_value_get_local_as<v8::Function>(php_v8_value);
+
+    PHP_V8_TRY_CATCH(isolate);
+    PHP_V8_INIT_ISOLATE_LIMITS_ON_CONTEXT(php_v8_context);
+
+    v8::MaybeLocal<v8::Value> maybe_local_res = local_function->Call(context, local_recv, arguments.argc(), arguments.argv());
+
     PHP_V8_MAYBE_CATCH(php_v8_context, try_catch);
     PHP_V8_THROW_VALUE_EXCEPTION_WHEN_EMPTY(maybe_local_res, "Failed to call");
 
     v8::Local<v8::Value> local_res = maybe_local_res.ToLocalChecked();
 
-    php_v8_get_or_create_value(return_value, local_res, php_v8_value->php_v8_isolate);
+    php_v8_get_or_unwrap_value(return_value, local_res, php_v8_context);
 }
 
 static PHP_METHOD(Function, setName) {
@@ -599,6 +749,8 @@ PHP_V8_ZEND_BEGIN_ARG_WITH_CONSTRUCTOR_INFO_EX(arginfo___construct, 2)
                 ZEND_ARG_OBJ_INFO(0, context, V8\\Context, 0)
                 ZEND_ARG_CALLABLE_INFO(0, callback, 0)
                 ZEND_ARG_TYPE_INFO(0, length, IS_LONG, 0)
+                ZEND_ARG_TYPE_INFO(0, behavior, IS_LONG, 0)
+                ZEND_ARG_TYPE_INFO(0, flags, IS_LONG, 0)
 ZEND_END_ARG_INFO()
 
 PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_newInstance, ZEND_RETURN_VALUE, 1, V8\\ObjectValue, 0)
@@ -606,12 +758,18 @@ PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_newInstance, ZEND_RETURN_V
                 ZEND_ARG_ARRAY_INFO(0, arguments, 0)
 ZEND_END_ARG_INFO()
 
-PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_call, ZEND_RETURN_VALUE, 2, V8\\Value, 0)
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_MIXED_INFO_EX(arginfo_call, 2)
                 ZEND_ARG_OBJ_INFO(0, context, V8\\Context, 0)
                 ZEND_ARG_OBJ_INFO(0, recv, V8\\Value, 0)
                 ZEND_ARG_ARRAY_INFO(0, arguments, 0)
 ZEND_END_ARG_INFO()
 
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_MIXED_INFO_EX(arginfo_callArgs, 2)
+                ZEND_ARG_OBJ_INFO(0, context, V8\\Context, 0)
+                ZEND_ARG_OBJ_INFO(0, recv, V8\\Value, 0)
+                ZEND_ARG_VARIADIC_INFO(0, arguments)
+ZEND_END_ARG_INFO()
+
 PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_VOID_INFO_EX(arginfo_setName, 1)
                 ZEND_ARG_OBJ_INFO(0, name, V8\\StringValue, 0)
 ZEND_END_ARG_INFO()
@@ -644,6 +802,7 @@ static const zend_function_entry php_v8_object_methods[] = {
         PHP_V8_ME(Function, __construct,           ZEND_ACC_PUBLIC | ZEND_ACC_CTOR)
         PHP_V8_ME(Function, newInstance,           ZEND_ACC_PUBLIC)
         PHP_V8_ME(Function, call,                  ZEND_ACC_PUBLIC)
+        PHP_V8_ME(Function, callArgs,              ZEND_ACC_PUBLIC)
         PHP_V8_ME(Function, setName,               ZEND_ACC_PUBLIC)
         PHP_V8_ME(Function, getName,               ZEND_ACC_PUBLIC)
         PHP_V8_ME(Function, getInferredName,       ZEND_ACC_PUBLIC)
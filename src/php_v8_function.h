@@ -26,7 +26,53 @@ extern "C" {
 
 extern zend_class_entry* php_v8_function_class_entry;
 
-extern bool php_v8_function_unpack_args(zval *arguments_zv, int arg_position, v8::Isolate *isolate, int *argc, v8::Local<v8::Value> **argv);
+// Number of call arguments which are stored on stack without allocation
+#define PHP_V8_FUNCTION_INLINE_ARGUMENTS 8
+
+namespace phpv8 {
+    template<class T>
+    class CallArguments {
+    public:
+        CallArguments() : argc_(0), argv_(inline_argv_) {
+        }
+
+        CallArguments(const CallArguments &) = delete;
+        CallArguments &operator=(const CallArguments &) = delete;
+
+        ~CallArguments() {
+            if (argv_ != inline_argv_) {
+                efree(argv_);
+            }
+        }
+
+        inline void reserve(int argc) {
+            if (argc > PHP_V8_FUNCTION_INLINE_ARGUMENTS && argv_ == inline_argv_) {
+                argv_ = static_cast<v8::Local<T> *>(safe_emalloc(static_cast<size_t>(argc), sizeof(v8::Local<T>), 0));
+            }
+        }
+
+        inline void push(v8::Local<T> value) {
+            argv_[argc_++] = value;
+        }
+
+        inline int argc() {
+            return argc_;
+        }
+
+        inline v8::Local<T> *argv() {
+            return argv_;
+        }
+
+    private:
+        int argc_;
+        v8::Local<T> *argv_;
+        v8::Local<T> inline_argv_[PHP_V8_FUNCTION_INLINE_ARGUMENTS];
+    };
+}
+
+extern bool php_v8_function_unpack_args(zval *arguments_zv, int arg_position, v8::Isolate *isolate, phpv8::CallArguments<v8::Value> &arguments);
+extern bool php_v8_function_unpack_variadic_args(zval *args, int args_count, int arg_position, php_v8_context_t *php_v8_context, v8::Local<v8::Context> context, phpv8::CallArguments<v8::Value> &arguments);
+extern bool php_v8_function_unpack_mixed_args(zval *arguments_zv, int arg_position, php_v8_context_t *php_v8_context, v8::Local<v8::Context> context, phpv8::CallArguments<v8::Value> &arguments);
 extern bool php_v8_function_unpack_string_args(zval* arguments_zv, int arg_position, v8::Isolate *isolate, int *argc, v8::Local<v8::String> **argv);
 extern bool php_v8_function_unpack_object_args(zval* arguments_zv, int arg_position, v8::Isolate *isolate, int *argc, v8::Local<v8::Object> **argv);
 
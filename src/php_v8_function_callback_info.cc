@@ -24,10 +24,69 @@
 zend_class_entry* php_v8_function_callback_info_class_entry;
 #define this_ce php_v8_function_callback_info_class_entry
 
+static zend_object_handlers php_v8_function_callback_info_object_handlers;
+
+
+static HashTable * php_v8_function_callback_info_gc(zval *object, zval **table, int *n) {
+    PHP_V8_FUNCTION_CALLBACK_INFO_FETCH_INTO(object, php_v8_callback_info);
+
+    *table = &php_v8_callback_info->isolate;
+    *n     = PHP_V8_FUNCTION_CALLBACK_INFO_GC_COUNT;
+
+    return zend_std_get_properties(object);
+}
+
+static void php_v8_function_callback_info_clear(php_v8_function_callback_info_t *php_v8_callback_info) {
+    php_v8_callback_info->info = NULL;
+
+    zval_ptr_dtor(&php_v8_callback_info->isolate);
+    zval_ptr_dtor(&php_v8_callback_info->context);
+    zval_ptr_dtor(&php_v8_callback_info->this_value);
+    zval_ptr_dtor(&php_v8_callback_info->holder);
+    zval_ptr_dtor(&php_v8_callback_info->arguments);
+    zval_ptr_dtor(&php_v8_callback_info->new_target);
+
+    ZVAL_UNDEF(&php_v8_callback_info->isolate);
+    ZVAL_UNDEF(&php_v8_callback_info->context);
+    ZVAL_UNDEF(&php_v8_callback_info->this_value);
+    ZVAL_UNDEF(&php_v8_callback_info->holder);
+    ZVAL_UNDEF(&php_v8_callback_info->arguments);
+    ZVAL_UNDEF(&php_v8_callback_info->new_target);
+}
+
+static void php_v8_function_callback_info_free(zend_object *object) {
+    php_v8_function_callback_info_t *php_v8_callback_info = php_v8_function_callback_info_fetch_object(object);
+
+    php_v8_function_callback_info_clear(php_v8_callback_info);
+    zval_ptr_dtor(&php_v8_callback_info->return_value);
+
+    zend_object_std_dtor(&php_v8_callback_info->std);
+}
+
+static zend_object *php_v8_function_callback_info_ctor(zend_class_entry *ce) {
+    php_v8_function_callback_info_t *php_v8_callback_info;
+
+    php_v8_callback_info = (php_v8_function_callback_info_t *) ecalloc(1, sizeof(php_v8_function_callback_info_t) + zend_object_properties_size(ce));
+
+    zend_object_std_init(&php_v8_callback_info->std, ce);
+    object_properties_init(&php_v8_callback_info->std, ce);
+
+    ZVAL_UNDEF(&php_v8_callback_info->isolate);
+    ZVAL_UNDEF(&php_v8_callback_info->context);
+    ZVAL_UNDEF(&php_v8_callback_info->return_value);
+    ZVAL_UNDEF(&php_v8_callback_info->this_value);
+    ZVAL_UNDEF(&php_v8_callback_info->holder);
+    ZVAL_UNDEF(&php_v8_callback_info->arguments);
+    ZVAL_UNDEF(&php_v8_callback_info->new_target);
+
+    php_v8_callback_info->std.handlers = &php_v8_function_callback_info_object_handlers;
+
+    return &php_v8_callback_info->std;
+}
+
 
 php_v8_return_value_t * php_v8_callback_info_create_from_info(zval *return_value, const v8::FunctionCallbackInfo<v8::Value> &args) {
-    zval tmp;
-    zval arg_zv;
+    php_v8_function_callback_info_t *php_v8_callback_info;
     php_v8_return_value_t *php_v8_return_value;
 
     v8::Isolate *isolate = args.GetIsolate();
@@ -41,158 +100,232 @@ php_v8_return_value_t * php_v8_callback_info_create_from_info(zval *return_value
     php_v8_isolate_t *php_v8_isolate = PHP_V8_ISOLATE_FETCH_REFERENCE(isolate);
     php_v8_context_t *php_v8_context = php_v8_context_get_reference(context);
 
-    object_init_ex(return_value, this_ce);
-
-    // common to both callback structures:
-    // isolate
-    ZVAL_OBJ(&tmp, &php_v8_isolate->std);
-    zend_update_property(php_v8_function_callback_info_class_entry, return_value, ZEND_STRL("isolate"), &tmp);
-    // context
-    ZVAL_OBJ(&tmp, &php_v8_context->std);
-    zend_update_property(php_v8_function_callback_info_class_entry, return_value, ZEND_STRL("context"), &tmp);
-    // this
-    php_v8_get_or_create_value(&tmp, args.This(), php_v8_isolate);
-    zend_update_property(php_v8_function_callback_info_class_entry, return_value, ZEND_STRL("this"), &tmp);
-    Z_DELREF(tmp);
-    // holder
-    php_v8_get_or_create_value(&tmp, args.Holder(), php_v8_isolate);
-    zend_update_property(php_v8_function_callback_info_class_entry, return_value, ZEND_STRL("holder"), &tmp);
-    Z_DELREF(tmp);
-    // return value
-    php_v8_return_value = php_v8_return_value_create_from_return_value(&tmp, php_v8_context, PHP_V8_RETVAL_ACCEPTS_ANY);
-    zend_update_property(php_v8_function_callback_info_class_entry, return_value, ZEND_STRL("return_value"), &tmp);
-    Z_DELREF(tmp);
-
-    // specific to function callback structure:
-    // length & arguments, all in one
-    array_init_size(&tmp, static_cast<uint>(args.Length()));
-
-    for (int i=0; i < args.Length(); i++) {
-        php_v8_get_or_create_value(&arg_zv,  args[i], php_v8_isolate);
-
-        add_index_zval(&tmp, static_cast<zend_ulong>(i), &arg_zv);
+    if (php_v8_callback_info_acquire(&php_v8_isolate->function_callback_info_pool, return_value)) {
+        php_v8_callback_info = PHP_V8_FUNCTION_CALLBACK_INFO_FETCH(return_value);
+        php_v8_return_value = php_v8_return_value_reset(&php_v8_callback_info->return_value, php_v8_context, PHP_V8_RETVAL_ACCEPTS_ANY);
+    } else {
+        object_init_ex(return_value, this_ce);
+
+        php_v8_callback_info = PHP_V8_FUNCTION_CALLBACK_INFO_FETCH(return_value);
+        php_v8_return_value = php_v8_return_value_create_from_return_value(&php_v8_callback_info->return_value, php_v8_context, PHP_V8_RETVAL_ACCEPTS_ANY);
     }
-    zend_update_property(this_ce, return_value, ZEND_STRL("arguments"), &tmp);
-    Z_DELREF(tmp);
 
-    // new_target
-    php_v8_get_or_create_value(&tmp, args.NewTarget(), php_v8_isolate);
-    zend_update_property(this_ce, return_value, ZEND_STRL("new_target"), &tmp);
-    Z_DELREF(tmp);
+    php_v8_callback_info->php_v8_isolate = php_v8_isolate;
+    php_v8_callback_info->php_v8_context = php_v8_context;
 
-    // is_constructor_call
-    zend_update_property_bool(this_ce, return_value, ZEND_STRL("is_constructor_call"), static_cast<zend_bool>(args.IsConstructCall()));
+    ZVAL_OBJ(&php_v8_callback_info->isolate, &php_v8_isolate->std);
+    Z_ADDREF(php_v8_callback_info->isolate);
+    ZVAL_OBJ(&php_v8_callback_info->context, &php_v8_context->std);
+    Z_ADDREF(php_v8_callback_info->context);
+
+    // everything else is wrapped on demand
+    php_v8_callback_info->info = &args;
+    php_v8_callback_info->length = args.Length();
+    php_v8_callback_info->is_construct_call = args.IsConstructCall();
 
     return php_v8_return_value;
 }
 
-static PHP_METHOD(FunctionCallbackInfo, getIsolate) {
-    zval rv;
-    zval *tmp;
+static zval *php_v8_function_callback_info_get_this(php_v8_function_callback_info_t *php_v8_callback_info) {
+    if (Z_ISUNDEF(php_v8_callback_info->this_value)) {
+        php_v8_get_or_create_value(&php_v8_callback_info->this_value, php_v8_callback_info->info->This(), php_v8_callback_info->php_v8_isolate);
+    }
 
+    return &php_v8_callback_info->this_value;
+}
+
+static zval *php_v8_function_callback_info_get_holder(php_v8_function_callback_info_t *php_v8_callback_info) {
+    if (Z_ISUNDEF(php_v8_callback_info->holder)) {
+        php_v8_get_or_create_value(&php_v8_callback_info->holder, php_v8_callback_info->info->Holder(), php_v8_callback_info->php_v8_isolate);
+    }
+
+    return &php_v8_callback_info->holder;
+}
+
+static zval *php_v8_function_callback_info_get_arguments(php_v8_function_callback_info_t *php_v8_callback_info) {
+    zval arg_zv;
+
+    if (Z_ISUNDEF(php_v8_callback_info->arguments)) {
+        const v8::FunctionCallbackInfo<v8::Value> &args = *php_v8_callback_info->info;
+
+        array_init_size(&php_v8_callback_info->arguments, static_cast<uint32_t>(php_v8_callback_info->length));
+
+        for (int i = 0; i < php_v8_callback_info->length; i++) {
+            php_v8_get_or_create_value(&arg_zv, args[i], php_v8_callback_info->php_v8_isolate);
+
+            add_index_zval(&php_v8_callback_info->arguments, static_cast<zend_ulong>(i), &arg_zv);
+        }
+    }
+
+    return &php_v8_callback_info->arguments;
+}
+
+static zval *php_v8_function_callback_info_get_new_target(php_v8_function_callback_info_t *php_v8_callback_info) {
+    if (Z_ISUNDEF(php_v8_callback_info->new_target)) {
+        php_v8_get_or_create_value(&php_v8_callback_info->new_target, php_v8_callback_info->info->NewTarget(), php_v8_callback_info->php_v8_isolate);
+    }
+
+    return &php_v8_callback_info->new_target;
+}
+
+void php_v8_function_callback_info_release(zval *callback_info, php_v8_isolate_t *php_v8_isolate) {
+    zval *pool = &php_v8_isolate->function_callback_info_pool;
+    PHP_V8_FUNCTION_CALLBACK_INFO_FETCH_INTO(callback_info, php_v8_callback_info);
+
+    if (Z_REFCOUNT_P(callback_info) > 1) {
+        // callback info outlives the call, so wrap everything while raw callback info is still valid
+        php_v8_function_callback_info_get_this(php_v8_callback_info);
+        php_v8_function_callback_info_get_holder(php_v8_callback_info);
+        php_v8_function_callback_info_get_arguments(php_v8_callback_info);
+        php_v8_function_callback_info_get_new_target(php_v8_callback_info);
+
+        php_v8_callback_info->info = NULL;
+
+        zval_ptr_dtor(callback_info);
+        return;
+    }
+
+    php_v8_callback_info->info = NULL;
+
+    if (!Z_ISUNDEF_P(pool)
+        || (Z_OBJ_P(callback_info)->properties && zend_hash_num_elements(Z_OBJ_P(callback_info)->properties) > 0)
+        || Z_REFCOUNT(php_v8_callback_info->return_value) > 1) {
+        zval_ptr_dtor(callback_info);
+        return;
+    }
+
+    // idle object should not keep isolate, context or any js value alive
+    php_v8_function_callback_info_clear(php_v8_callback_info);
+    php_v8_return_value_clear(&php_v8_callback_info->return_value);
+
+    php_v8_callback_info->php_v8_isolate = NULL;
+    php_v8_callback_info->php_v8_context = NULL;
+
+    ZVAL_COPY_VALUE(pool, callback_info);
+}
+
+static PHP_METHOD(FunctionCallbackInfo, getIsolate) {
     if (zend_parse_parameters_none() == FAILURE) {
         return;
     }
 
-    tmp = zend_read_property(this_ce, getThis(), ZEND_STRL("isolate"), 0, &rv);
-    ZVAL_COPY(return_value, tmp);
+    PHP_V8_FUNCTION_CALLBACK_INFO_FETCH_WITH_CHECK(getThis(), php_v8_callback_info);
+
+    ZVAL_COPY(return_value, &php_v8_callback_info->isolate);
 }
 
 static PHP_METHOD(FunctionCallbackInfo, getContext) {
-    zval rv;
-    zval *tmp;
-
     if (zend_parse_parameters_none() == FAILURE) {
         return;
     }
 
-    tmp = zend_read_property(this_ce, getThis(), ZEND_STRL("context"), 0, &rv);
-    ZVAL_COPY(return_value, tmp);
+    PHP_V8_FUNCTION_CALLBACK_INFO_FETCH_WITH_CHECK(getThis(), php_v8_callback_info);
+
+    ZVAL_COPY(return_value, &php_v8_callback_info->context);
 }
 
 static PHP_METHOD(FunctionCallbackInfo, this) {
-    zval rv;
-    zval *tmp;
-
     if (zend_parse_parameters_none() == FAILURE) {
         return;
     }
 
-    tmp = zend_read_property(this_ce, getThis(), ZEND_STRL("this"), 0, &rv);
-    ZVAL_COPY(return_value, tmp);
+    PHP_V8_FUNCTION_CALLBACK_INFO_FETCH_WITH_CHECK(getThis(), php_v8_callback_info);
+
+    ZVAL_COPY(return_value, php_v8_function_callback_info_get_this(php_v8_callback_info));
 }
 
 static PHP_METHOD(FunctionCallbackInfo, holder) {
-    zval rv;
-    zval *tmp;
-
     if (zend_parse_parameters_none() == FAILURE) {
         return;
     }
 
-    tmp = zend_read_property(this_ce, getThis(), ZEND_STRL("holder"), 0, &rv);
-    ZVAL_COPY(return_value, tmp);
+    PHP_V8_FUNCTION_CALLBACK_INFO_FETCH_WITH_CHECK(getThis(), php_v8_callback_info);
+
+    ZVAL_COPY(return_value, php_v8_function_callback_info_get_holder(php_v8_callback_info));
 }
 
 static PHP_METHOD(FunctionCallbackInfo, getReturnValue) {
-    zval rv;
-    zval *tmp;
-
     if (zend_parse_parameters_none() == FAILURE) {
         return;
     }
 
-    tmp = zend_read_property(this_ce, getThis(), ZEND_STRL("return_value"), 0, &rv);
-    ZVAL_COPY(return_value, tmp);
+    PHP_V8_FUNCTION_CALLBACK_INFO_FETCH_WITH_CHECK(getThis(), php_v8_callback_info);
+
+    ZVAL_COPY(return_value, &php_v8_callback_info->return_value);
 }
 
 static PHP_METHOD(FunctionCallbackInfo, length) {
-    zval rv;
-    zval *tmp;
-
     if (zend_parse_parameters_none() == FAILURE) {
         return;
     }
 
-    tmp = zend_read_property(this_ce, getThis(), ZEND_STRL("arguments"), 0, &rv);
+    PHP_V8_FUNCTION_CALLBACK_INFO_FETCH_WITH_CHECK(getThis(), php_v8_callback_info);
 
-    RETURN_LONG(zend_array_count(Z_ARRVAL_P(tmp)));
+    RETURN_LONG(php_v8_callback_info->length);
 }
 
 static PHP_METHOD(FunctionCallbackInfo, arguments) {
-    zval rv;
-    zval *tmp;
-
     if (zend_parse_parameters_none() == FAILURE) {
         return;
     }
 
-    tmp = zend_read_property(this_ce, getThis(), ZEND_STRL("arguments"), 0, &rv);
-    ZVAL_COPY(return_value, tmp);
+    PHP_V8_FUNCTION_CALLBACK_INFO_FETCH_WITH_CHECK(getThis(), php_v8_callback_info);
+
+    ZVAL_COPY(return_value, php_v8_function_callback_info_get_arguments(php_v8_callback_info));
 }
 
-static PHP_METHOD(FunctionCallbackInfo, newTarget) {
-    zval rv;
-    zval *tmp;
+static PHP_METHOD(FunctionCallbackInfo, argument) {
+    zend_long index;
+    zval *arg_zv;
 
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "l", &index) == FAILURE) {
+        return;
+    }
+
+    PHP_V8_FUNCTION_CALLBACK_INFO_FETCH_WITH_CHECK(getThis(), php_v8_callback_info);
+
+    bool in_range = index >= 0 && index < php_v8_callback_info->length;
+
+    if (!Z_ISUNDEF(php_v8_callback_info->arguments) && in_range) {
+        arg_zv = zend_hash_index_find(Z_ARRVAL(php_v8_callback_info->arguments), static_cast<zend_ulong>(index));
+        assert(NULL != arg_zv);
+
+        ZVAL_COPY(return_value, arg_zv);
+        return;
+    }
+
+    if (php_v8_callback_info->info) {
+        // out of range argument is undefined, just like in js
+        const v8::FunctionCallbackInfo<v8::Value> &args = *php_v8_callback_info->info;
+        v8::Local<v8::Value> local_arg = in_range ? args[static_cast<int>(index)] : v8::Local<v8::Value>(v8::Undefined(args.GetIsolate()));
+
+        php_v8_get_or_create_value(return_value, local_arg, php_v8_callback_info->php_v8_isolate);
+        return;
+    }
+
+    PHP_V8_ENTER_STORED_ISOLATE(php_v8_callback_info);
+
+    php_v8_get_or_create_value(return_value, v8::Undefined(isolate), php_v8_callback_info->php_v8_isolate);
+}
+
+static PHP_METHOD(FunctionCallbackInfo, newTarget) {
     if (zend_parse_parameters_none() == FAILURE) {
         return;
     }
 
-    tmp = zend_read_property(this_ce, getThis(), ZEND_STRL("new_target"), 0, &rv);
-    ZVAL_COPY(return_value, tmp);
+    PHP_V8_FUNCTION_CALLBACK_INFO_FETCH_WITH_CHECK(getThis(), php_v8_callback_info);
+
+    ZVAL_COPY(return_value, php_v8_function_callback_info_get_new_target(php_v8_callback_info));
 }
 
 static PHP_METHOD(FunctionCallbackInfo, isConstructCall) {
-    zval rv;
-    zval *tmp;
-
     if (zend_parse_parameters_none() == FAILURE) {
         return;
     }
 
-    tmp = zend_read_property(this_ce, getThis(), ZEND_STRL("is_constructor_call"), 0, &rv);
-    ZVAL_COPY(return_value, tmp);
+    PHP_V8_FUNCTION_CALLBACK_INFO_FETCH_WITH_CHECK(getThis(), php_v8_callback_info);
+
+    RETURN_BOOL(php_v8_callback_info->is_construct_call);
 }
 
 
@@ -217,6 +350,10 @@ ZEND_END_ARG_INFO()
 PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_arguments, ZEND_RETURN_VALUE, 0, IS_ARRAY, 0)
 ZEND_END_ARG_INFO()
 
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_argument, ZEND_RETURN_VALUE, 1, V8\\Value, 0)
+                ZEND_ARG_TYPE_INFO(0, index, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
 PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_newTarget, ZEND_RETURN_VALUE, 0, V8\\Value, 0)
 ZEND_END_ARG_INFO()
 
@@ -232,6 +369,7 @@ static const zend_function_entry php_v8_function_callback_info_methods[] = {
         PHP_V8_ME(FunctionCallbackInfo, getReturnValue, ZEND_ACC_PUBLIC)
         PHP_V8_ME(FunctionCallbackInfo, length,          ZEND_ACC_PUBLIC)
         PHP_V8_ME(FunctionCallbackInfo, arguments,       ZEND_ACC_PUBLIC)
+        PHP_V8_ME(FunctionCallbackInfo, argument,        ZEND_ACC_PUBLIC)
         PHP_V8_ME(FunctionCallbackInfo, newTarget,       ZEND_ACC_PUBLIC)
         PHP_V8_ME(FunctionCallbackInfo, isConstructCall, ZEND_ACC_PUBLIC)
         PHP_FE_END
@@ -244,14 +382,14 @@ PHP_MINIT_FUNCTION(php_v8_function_callback_info) {
     this_ce = zend_register_internal_class(&ce);
     zend_class_implements(this_ce, 1, php_v8_callback_info_interface_class_entry);
 
-    zend_declare_property_null(this_ce, ZEND_STRL("isolate"), ZEND_ACC_PRIVATE);
-    zend_declare_property_null(this_ce, ZEND_STRL("context"), ZEND_ACC_PRIVATE);
-    zend_declare_property_null(this_ce, ZEND_STRL("this"), ZEND_ACC_PRIVATE);
-    zend_declare_property_null(this_ce, ZEND_STRL("holder"), ZEND_ACC_PRIVATE);
-    zend_declare_property_null(this_ce, ZEND_STRL("return_value"), ZEND_ACC_PRIVATE);
-    zend_declare_property_null(this_ce, ZEND_STRL("arguments"),           ZEND_ACC_PRIVATE);
-    zend_declare_property_null(this_ce, ZEND_STRL("new_target"),          ZEND_ACC_PRIVATE);
-    zend_declare_property_null(this_ce, ZEND_STRL("is_constructor_call"), ZEND_ACC_PRIVATE);
+    this_ce->create_object = php_v8_function_callback_info_ctor;
+
+    memcpy(&php_v8_function_callback_info_object_handlers, zend_get_std_object_handlers(), sizeof(zend_object_handlers));
+
+    php_v8_function_callback_info_object_handlers.offset    = XtOffsetOf(php_v8_function_callback_info_t, std);
+    php_v8_function_callback_info_object_handlers.free_obj  = php_v8_function_callback_info_free;
+    php_v8_function_callback_info_object_handlers.get_gc    = php_v8_function_callback_info_gc;
+    php_v8_function_callback_info_object_handlers.clone_obj = NULL;
 
     return SUCCESS;
 }
@@ -13,7 +13,12 @@
 #ifndef PHP_V8_FUNCTION_CALLBACK_INFO_H
 #define PHP_V8_FUNCTION_CALLBACK_INFO_H
 
+typedef struct _php_v8_function_callback_info_t php_v8_function_callback_info_t;
+
 #include "php_v8_return_value.h"
+#include "php_v8_exceptions.h"
+#include "php_v8_context.h"
+#include "php_v8_isolate.h"
 #include <v8.h>
 
 extern "C" {
@@ -26,8 +31,52 @@ extern "C" {
 
 extern zend_class_entry* php_v8_function_callback_info_class_entry;
 
+inline php_v8_function_callback_info_t *php_v8_function_callback_info_fetch_object(zend_object *obj);
+
 extern php_v8_return_value_t * php_v8_callback_info_create_from_info(zval *return_value, const v8::FunctionCallbackInfo<v8::Value> &args);
 
+extern void php_v8_function_callback_info_release(zval *callback_info, php_v8_isolate_t *php_v8_isolate);
+
+#define PHP_V8_FUNCTION_CALLBACK_INFO_FETCH(zv) php_v8_function_callback_info_fetch_object(Z_OBJ_P(zv))
+#define PHP_V8_FUNCTION_CALLBACK_INFO_FETCH_INTO(pzval, into) php_v8_function_callback_info_t *(into) = PHP_V8_FUNCTION_CALLBACK_INFO_FETCH((pzval));
+
+#define PHP_V8_EMPTY_FUNCTION_CALLBACK_INFO_MSG "FunctionCallbackInfo" PHP_V8_EMPTY_HANDLER_MSG_PART
+#define PHP_V8_CHECK_EMPTY_FUNCTION_CALLBACK_INFO_HANDLER(val) PHP_V8_CHECK_EMPTY_HANDLER((val), PHP_V8_EMPTY_FUNCTION_CALLBACK_INFO_MSG)
+
+#define PHP_V8_FUNCTION_CALLBACK_INFO_FETCH_WITH_CHECK(pzval, into) \
+    PHP_V8_FUNCTION_CALLBACK_INFO_FETCH_INTO(pzval, into); \
+    PHP_V8_CHECK_EMPTY_FUNCTION_CALLBACK_INFO_HANDLER(into);
+
+
+struct _php_v8_function_callback_info_t {
+    php_v8_isolate_t *php_v8_isolate;
+    php_v8_context_t *php_v8_context;
+
+    /* Raw callback info, valid only while callback runs. this, holder, arguments and new target are wrapped from it
+     * on first access, whatever was not wrapped yet is wrapped when callback info outlives the call. */
+    const v8::FunctionCallbackInfo<v8::Value> *info;
+
+    int length;
+    bool is_construct_call;
+
+    /* Keep zvals adjacent, they are reported to gc as a single table */
+    zval isolate;
+    zval context;
+    zval return_value;
+    zval this_value;
+    zval holder;
+    zval arguments;
+    zval new_target;
+
+    zend_object std;
+};
+
+#define PHP_V8_FUNCTION_CALLBACK_INFO_GC_COUNT 7
+
+inline php_v8_function_callback_info_t *php_v8_function_callback_info_fetch_object(zend_object *obj) {
+    return (php_v8_function_callback_info_t *)((char *)obj - XtOffsetOf(php_v8_function_callback_info_t, std));
+}
+
 
 PHP_MINIT_FUNCTION (php_v8_function_callback_info);
 
@@ -135,16 +135,18 @@ static PHP_METHOD(FunctionTemplate, __construct) {
 
     zend_long length = 0;
     zend_long behavior = static_cast<zend_long>(v8::ConstructorBehavior::kAllow);
+    zend_long flags = PHP_V8_CALLBACK_FLAGS_NONE;
 
     v8::FunctionCallback callback = 0;
     v8::Local<v8::External> data;
     v8::Local<v8::Signature> signature;
 
-    if (zend_parse_parameters(ZEND_NUM_ARGS(), "o|f!o!ll", &php_v8_isolate_zv, &fci, &fci_cache, &php_v8_receiver_zv, &length, &behavior) == FAILURE) {
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "o|f!o!lll", &php_v8_isolate_zv, &fci, &fci_cache, &php_v8_receiver_zv, &length, &behavior, &flags) == FAILURE) {
         return;
     }
 
     behavior = behavior ? behavior & PHP_V8_CONSTRUCTOR_BEHAVIOR_FLAGS : behavior;
+    flags = flags ? flags & PHP_V8_CALLBACK_FLAGS : flags;
 
     PHP_V8_CHECK_FUNCTION_LENGTH_RANGE(length, "Length is out of range");
 
@@ -169,7 +171,7 @@ static PHP_METHOD(FunctionTemplate, __construct) {
 
         bucket->add(phpv8::CallbacksBucket::Index::Callback, fci, fci_cache);
 
-        callback = php_v8_callback_function;
+        callback = flags & PHP_V8_CALLBACK_FLAGS_DIRECT_RETURN ? php_v8_callback_function_direct : php_v8_callback_function;
     }
 
     v8::Local<v8::FunctionTemplate> local_template = v8::FunctionTemplate::New(isolate,
@@ -214,6 +216,19 @@ static PHP_METHOD(FunctionTemplate, setNativeDataProperty) {
 static PHP_METHOD(FunctionTemplate, setLazyDataProperty) {
     php_v8_function_template_SetLazyDataProperty(INTERNAL_FUNCTION_PARAM_PASSTHRU);
 }
+
+/* Non-standard, binds property to php value which is read and written natively, without calling php functions */
+static PHP_METHOD(FunctionTemplate, bindConstant) {
+    php_v8_function_template_Bind(phpv8::Binding::Kind::Constant, INTERNAL_FUNCTION_PARAM_PASSTHRU);
+}
+
+static PHP_METHOD(FunctionTemplate, bindProperty) {
+    php_v8_function_template_Bind(phpv8::Binding::Kind::Property, INTERNAL_FUNCTION_PARAM_PASSTHRU);
+}
+
+static PHP_METHOD(FunctionTemplate, bindArrayOffset) {
+    php_v8_function_template_Bind(phpv8::Binding::Kind::ArrayOffset, INTERNAL_FUNCTION_PARAM_PASSTHRU);
+}
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 static PHP_METHOD(FunctionTemplate, getFunction) {
@@ -459,6 +474,7 @@ PHP_V8_ZEND_BEGIN_ARG_WITH_CONSTRUCTOR_INFO_EX(arginfo___construct, 1)
                 ZEND_ARG_OBJ_INFO(0, receiver, V8\\FunctionTemplate, 1)
                 ZEND_ARG_TYPE_INFO(0, length, IS_LONG, 0)
                 ZEND_ARG_TYPE_INFO(0, behavior, IS_LONG, 0)
+                ZEND_ARG_TYPE_INFO(0, flags, IS_LONG, 0)
 ZEND_END_ARG_INFO()
 
 PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_getIsolate, ZEND_RETURN_VALUE, 0, V8\\Isolate, 0)
@@ -495,6 +511,26 @@ PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_VOID_INFO_EX(arginfo_setLazyDataProperty, 2)
                 ZEND_ARG_TYPE_INFO(0, attributes, IS_LONG, 0)
 ZEND_END_ARG_INFO()
 
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_VOID_INFO_EX(arginfo_bindConstant, 2)
+                ZEND_ARG_OBJ_INFO(0, name, V8\\NameValue, 0)
+                ZEND_ARG_INFO(0, value)
+                ZEND_ARG_TYPE_INFO(0, attributes, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_VOID_INFO_EX(arginfo_bindProperty, 2)
+                ZEND_ARG_OBJ_INFO(0, name, V8\\NameValue, 0)
+                ZEND_ARG_TYPE_INFO(0, object, IS_OBJECT, 0)
+                ZEND_ARG_TYPE_INFO(0, property, IS_STRING, 1)
+                ZEND_ARG_TYPE_INFO(0, attributes, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_VOID_INFO_EX(arginfo_bindArrayOffset, 2)
+                ZEND_ARG_OBJ_INFO(0, name, V8\\NameValue, 0)
+                ZEND_ARG_ARRAY_INFO(1, array, 0)
+                ZEND_ARG_INFO(0, offset)
+                ZEND_ARG_TYPE_INFO(0, attributes, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_getFunction, ZEND_RETURN_VALUE, 1, V8\\FunctionObject, 0)
@@ -557,6 +593,9 @@ static const zend_function_entry php_v8_function_template_methods[] = {
         PHP_V8_ME(FunctionTemplate, setAccessorProperty,   ZEND_ACC_PUBLIC)
         PHP_V8_ME(FunctionTemplate, setNativeDataProperty, ZEND_ACC_PUBLIC)
         PHP_V8_ME(FunctionTemplate, setLazyDataProperty,   ZEND_ACC_PUBLIC)
+        PHP_V8_ME(FunctionTemplate, bindConstant,          ZEND_ACC_PUBLIC)
+        PHP_V8_ME(FunctionTemplate, bindProperty,          ZEND_ACC_PUBLIC)
+        PHP_V8_ME(FunctionTemplate, bindArrayOffset,       ZEND_ACC_PUBLIC)
         PHP_V8_ME(FunctionTemplate, getFunction,           ZEND_ACC_PUBLIC)
         PHP_V8_ME(FunctionTemplate, setCallHandler,        ZEND_ACC_PUBLIC)
         PHP_V8_ME(FunctionTemplate, setLength,             ZEND_ACC_PUBLIC)
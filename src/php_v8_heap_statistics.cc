@@ -22,7 +22,7 @@ zend_class_entry *php_v8_heap_statistics_class_entry;
 #define this_ce php_v8_heap_statistics_class_entry
 
 
-void php_v8_heap_statistics_create_from_heap_statistics(zval *return_value, v8::HeapStatistics *hs) {
+void php_v8_heap_statistics_create_from_heap_statistics(zval *return_value, v8::HeapStatistics *hs, size_t array_buffer_allocated_size, size_t peak_array_buffer_allocated_size) {
     assert(NULL != hs);
 
     object_init_ex(return_value, this_ce);
@@ -40,6 +40,9 @@ void php_v8_heap_statistics_create_from_heap_statistics(zval *return_value, v8::
 
     zend_update_property_double(this_ce, return_value, ZEND_STRL("number_of_native_contexts"), hs->number_of_native_contexts());
     zend_update_property_double(this_ce, return_value, ZEND_STRL("number_of_detached_contexts"), hs->number_of_detached_contexts());
+
+    zend_update_property_double(this_ce, return_value, ZEND_STRL("array_buffer_allocated_size"), array_buffer_allocated_size);
+    zend_update_property_double(this_ce, return_value, ZEND_STRL("peak_array_buffer_allocated_size"), peak_array_buffer_allocated_size);
 }
 
 static PHP_METHOD(HeapStatistics, __construct) {
@@ -57,11 +60,15 @@ static PHP_METHOD(HeapStatistics, __construct) {
     double number_of_native_contexts = 0;
     double number_of_detached_contexts = 0;
 
-    if (zend_parse_parameters(ZEND_NUM_ARGS(), "|" "dddd" "dddd" "b" "dd",
+    double array_buffer_allocated_size = 0;
+    double peak_array_buffer_allocated_size = 0;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "|" "dddd" "dddd" "b" "dd" "dd",
                               &total_heap_size, &total_heap_size_executable, &total_physical_size, &total_available_size,
                               &used_heap_size, &heap_size_limit, &malloced_memory, &peak_malloced_memory,
                               &does_zap_garbage,
-                              &number_of_native_contexts, &number_of_detached_contexts) == FAILURE) {
+                              &number_of_native_contexts, &number_of_detached_contexts,
+                              &array_buffer_allocated_size, &peak_array_buffer_allocated_size) == FAILURE) {
         return;
     }
 
@@ -78,6 +85,9 @@ static PHP_METHOD(HeapStatistics, __construct) {
 
     zend_update_property_double(this_ce, getThis(), ZEND_STRL("number_of_native_contexts"), number_of_native_contexts);
     zend_update_property_double(this_ce, getThis(), ZEND_STRL("number_of_detached_contexts"), number_of_detached_contexts);
+
+    zend_update_property_double(this_ce, getThis(), ZEND_STRL("array_buffer_allocated_size"), array_buffer_allocated_size);
+    zend_update_property_double(this_ce, getThis(), ZEND_STRL("peak_array_buffer_allocated_size"), peak_array_buffer_allocated_size);
 }
 
 static PHP_METHOD(HeapStatistics, getTotalHeapSize) {
@@ -190,6 +200,26 @@ static PHP_METHOD(HeapStatistics, getNumberOfDetachedContexts) {
     RETVAL_ZVAL(zend_read_property(this_ce, getThis(), ZEND_STRL("number_of_detached_contexts"), 0, &rv), 1, 0);
 }
 
+static PHP_METHOD(HeapStatistics, getArrayBufferAllocatedSize) {
+    zval rv;
+
+    if (zend_parse_parameters_none() == FAILURE) {
+        return;
+    }
+
+    RETVAL_ZVAL(zend_read_property(this_ce, getThis(), ZEND_STRL("array_buffer_allocated_size"), 0, &rv), 1, 0);
+}
+
+static PHP_METHOD(HeapStatistics, getPeakArrayBufferAllocatedSize) {
+    zval rv;
+
+    if (zend_parse_parameters_none() == FAILURE) {
+        return;
+    }
+
+    RETVAL_ZVAL(zend_read_property(this_ce, getThis(), ZEND_STRL("peak_array_buffer_allocated_size"), 0, &rv), 1, 0);
+}
+
 
 PHP_V8_ZEND_BEGIN_ARG_WITH_CONSTRUCTOR_INFO_EX(arginfo___construct, 0)
                 ZEND_ARG_TYPE_INFO(0, total_heap_size, IS_DOUBLE, 0)
@@ -238,6 +268,12 @@ ZEND_END_ARG_INFO()
 PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_getNumberOfDetachedContexts, ZEND_RETURN_VALUE, 0, IS_DOUBLE, 0)
 ZEND_END_ARG_INFO()
 
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_getArrayBufferAllocatedSize, ZEND_RETURN_VALUE, 0, IS_DOUBLE, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_getPeakArrayBufferAllocatedSize, ZEND_RETURN_VALUE, 0, IS_DOUBLE, 0)
+ZEND_END_ARG_INFO()
+
 
 static const zend_function_entry php_v8_heap_statistics_methods[] = {
         PHP_V8_ME(HeapStatistics, __construct, ZEND_ACC_PUBLIC | ZEND_ACC_CTOR)
@@ -253,6 +289,8 @@ static const zend_function_entry php_v8_heap_statistics_methods[] = {
         PHP_V8_ME(HeapStatistics, doesZapGarbage, ZEND_ACC_PUBLIC)
         PHP_V8_ME(HeapStatistics, getNumberOfNativeContexts, ZEND_ACC_PUBLIC)
         PHP_V8_ME(HeapStatistics, getNumberOfDetachedContexts, ZEND_ACC_PUBLIC)
+        PHP_V8_ME(HeapStatistics, getArrayBufferAllocatedSize, ZEND_ACC_PUBLIC)
+        PHP_V8_ME(HeapStatistics, getPeakArrayBufferAllocatedSize, ZEND_ACC_PUBLIC)
 
         PHP_FE_END
 };
@@ -277,5 +315,8 @@ PHP_MINIT_FUNCTION (php_v8_heap_statistics) {
     zend_declare_property_double(this_ce, ZEND_STRL("number_of_native_contexts"), 0, ZEND_ACC_PRIVATE);
     zend_declare_property_double(this_ce, ZEND_STRL("number_of_detached_contexts"), 0, ZEND_ACC_PRIVATE);
 
+    zend_declare_property_double(this_ce, ZEND_STRL("array_buffer_allocated_size"), 0, ZEND_ACC_PRIVATE);
+    zend_declare_property_double(this_ce, ZEND_STRL("peak_array_buffer_allocated_size"), 0, ZEND_ACC_PRIVATE);
+
     return SUCCESS;
 }
@@ -25,7 +25,7 @@ extern "C" {
 
 extern zend_class_entry* php_v8_heap_statistics_class_entry;
 
-extern void php_v8_heap_statistics_create_from_heap_statistics(zval *return_value, v8::HeapStatistics *hs);
+extern void php_v8_heap_statistics_create_from_heap_statistics(zval *return_value, v8::HeapStatistics *hs, size_t array_buffer_allocated_size, size_t peak_array_buffer_allocated_size);
 
 
 PHP_MINIT_FUNCTION(php_v8_heap_statistics);
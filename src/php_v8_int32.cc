@@ -41,7 +41,7 @@ static PHP_METHOD(Int32, __construct) {
 
     PHP_V8_THROW_VALUE_EXCEPTION_WHEN_EMPTY(local_value, "Failed to create Int32 value");
 
-    php_v8_value->persistent->Reset(isolate, local_value);
+    php_v8_value->persistent.Reset(isolate, local_value);
 }
 
 
@@ -46,7 +46,7 @@ static PHP_METHOD(Integer, __construct) {
 
     PHP_V8_THROW_VALUE_EXCEPTION_WHEN_EMPTY(local_value, "Failed to create Integer value");
 
-    php_v8_value->persistent->Reset(isolate, local_value);
+    php_v8_value->persistent.Reset(isolate, local_value);
 }
 
 
@@ -15,6 +15,8 @@
 #endif
 
 #include "php_v8_isolate.h"
+#include "php_v8_isolate_pool.h"
+#include "php_v8_array_buffer_allocator.h"
 #include "php_v8_startup_data.h"
 #include "php_v8_heap_statistics.h"
 
@@ -94,6 +96,32 @@ namespace phpv8 {
     ExternalExceptionsStack::~ExternalExceptionsStack() {
         clear();
     }
+
+    void ObjectWrapperMap::add(int hash, php_v8_value_t *php_v8_value) {
+        wrappers.emplace(hash, php_v8_value);
+    }
+    void ObjectWrapperMap::remove(int hash, php_v8_value_t *php_v8_value) {
+        auto range = wrappers.equal_range(hash);
+
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second == php_v8_value) {
+                wrappers.erase(it);
+                return;
+            }
+        }
+    }
+    php_v8_value_t *ObjectWrapperMap::find(int hash, v8::Local<v8::Object> local_object) {
+        auto range = wrappers.equal_range(hash);
+
+        // identity hashes are not unique, so compare objects themselves
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second->persistent == local_object) {
+                return it->second;
+            }
+        }
+
+        return nullptr;
+    }
 }
 
 static HashTable * php_v8_isolate_gc(zval *object, zval **table, int *n) {
@@ -146,17 +174,21 @@ static void php_v8_isolate_free(zend_object *object) {
         delete php_v8_isolate->external_exceptions;
     }
 
-    if (php_v8_isolate->gc_data) {
-        efree(php_v8_isolate->gc_data);
+    if (php_v8_isolate->object_wrappers) {
+        delete php_v8_isolate->object_wrappers;
+        php_v8_isolate->object_wrappers = nullptr;
     }
 
-    if (php_v8_isolate->isolate && PHP_V8_ISOLATE_HAS_VALID_HANDLE(php_v8_isolate)) {
-        php_v8_isolate->key.Reset();
+    if (php_v8_isolate->gc_data) {
+        efree(php_v8_isolate->gc_data);
     }
 
-    php_v8_isolate->key.~Persistent();
+    zval_ptr_dtor(&php_v8_isolate->function_callback_info_pool);
+    zval_ptr_dtor(&php_v8_isolate->property_callback_info_pool);
 
-    php_v8_isolate_destroy(php_v8_isolate);
+    if (!php_v8_isolate_pool_recycle(php_v8_isolate)) {
+        php_v8_isolate_destroy(php_v8_isolate);
+    }
 
     zend_object_std_dtor(&php_v8_isolate->std);
 
@@ -190,14 +222,18 @@ static zend_object *php_v8_isolate_ctor(zend_class_entry *ce) {
     php_v8_init();
 
     php_v8_isolate->blob = nullptr;
+    php_v8_isolate->pool = nullptr;
     php_v8_isolate->create_params = new v8::Isolate::CreateParams();
-    php_v8_isolate->create_params->array_buffer_allocator = v8::ArrayBuffer::Allocator::NewDefaultAllocator();
+    php_v8_isolate->create_params->array_buffer_allocator = new phpv8::ArrayBufferAllocator();
 
     php_v8_isolate->weak_function_templates = new phpv8::PersistentCollection<v8::FunctionTemplate>();
     php_v8_isolate->weak_object_templates = new phpv8::PersistentCollection<v8::ObjectTemplate>();
     php_v8_isolate->weak_values = new phpv8::PersistentCollection<v8::Value>();
     php_v8_isolate->external_exceptions = new phpv8::ExternalExceptionsStack();
-    new(&php_v8_isolate->key) v8::Persistent<v8::Private>();
+    php_v8_isolate->object_wrappers = new phpv8::ObjectWrapperMap();
+
+    ZVAL_UNDEF(&php_v8_isolate->function_callback_info_pool);
+    ZVAL_UNDEF(&php_v8_isolate->property_callback_info_pool);
 
     php_v8_isolate->std.handlers = &php_v8_isolate_object_handlers;
 
@@ -229,13 +265,19 @@ static void php_v8_fatal_error_handler(const char *location, const char *message
 
 static PHP_METHOD(Isolate, __construct) {
     zval *snapshot_zv = NULL;
+    zend_long memory_limit_in_bytes = 0;
 
-    if (zend_parse_parameters(ZEND_NUM_ARGS(), "|o!", &snapshot_zv) == FAILURE) {
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "|o!l", &snapshot_zv, &memory_limit_in_bytes) == FAILURE) {
         return;
     }
 
     PHP_V8_ISOLATE_FETCH_INTO(getThis(), php_v8_isolate);
 
+    if (memory_limit_in_bytes < 0) {
+        PHP_V8_THROW_EXCEPTION("Memory limit should be a non-negative numeric value");
+        return;
+    }
+
     if (snapshot_zv != NULL) {
         PHP_V8_STARTUP_DATA_FETCH_INTO(snapshot_zv, php_v8_startup_data);
 
@@ -253,21 +295,22 @@ static PHP_METHOD(Isolate, __construct) {
         }
     }
 
+    php_v8_isolate_limits_configure(php_v8_isolate->create_params, static_cast<size_t>(memory_limit_in_bytes));
+
     php_v8_isolate->isolate = v8::Isolate::New(*php_v8_isolate->create_params);
-    PHP_V8_ISOLATE_STORE_REFERENCE(php_v8_isolate);
 
-    php_v8_isolate->isolate_handle = Z_OBJ_HANDLE_P(getThis());
+    php_v8_isolate_setup(getThis(), php_v8_isolate, static_cast<size_t>(memory_limit_in_bytes));
+}
 
-    php_v8_isolate->isolate->SetFatalErrorHandler(php_v8_fatal_error_handler);
-    php_v8_isolate->isolate->SetOOMErrorHandler(php_v8_isolate_oom_error_callback);
+void php_v8_isolate_setup(zval *object, php_v8_isolate_t *php_v8_isolate, size_t memory_limit_in_bytes) {
+    PHP_V8_ISOLATE_STORE_REFERENCE(php_v8_isolate);
 
-    PHP_V8_ENTER_ISOLATE(php_v8_isolate);
+    php_v8_isolate_limits_init(php_v8_isolate, memory_limit_in_bytes);
 
-    v8::MaybeLocal<v8::String> local_key_string = v8::String::NewFromUtf8(isolate, "php-v8::self", v8::NewStringType::kInternalized);
-    PHP_V8_THROW_EXCEPTION_WHEN_EMPTY(local_key_string, "Failed initialize Isolate");
+    php_v8_isolate->isolate_handle = Z_OBJ_HANDLE_P(object);
 
-    v8::Local<v8::Private> local_private_key = v8::Private::ForApi(isolate, local_key_string.ToLocalChecked());
-    php_v8_isolate->key.Reset(isolate, local_private_key);
+    php_v8_isolate->isolate->SetFatalErrorHandler(php_v8_fatal_error_handler);
+    php_v8_isolate->isolate->SetOOMErrorHandler(php_v8_isolate_oom_error_callback);
 }
 
 static PHP_METHOD(Isolate, within) {
@@ -346,6 +389,54 @@ static PHP_METHOD(Isolate, isTimeLimitHit) {
     RETVAL_BOOL(php_v8_isolate->limits.time_limit_hit);
 }
 
+static PHP_METHOD(Isolate, getTimeLimitOvershoot) {
+    if (zend_parse_parameters_none() == FAILURE) {
+        return;
+    }
+
+    PHP_V8_ISOLATE_FETCH_WITH_CHECK(getThis(), php_v8_isolate);
+
+    RETVAL_DOUBLE(php_v8_isolate->limits.time_limit_overshoot);
+}
+
+static PHP_METHOD(Isolate, setCpuTimeLimit) {
+    double cpu_time_limit_in_seconds;
+    zend_bool exclude_callbacks = '\0';
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "d|b", &cpu_time_limit_in_seconds, &exclude_callbacks) == FAILURE) {
+        return;
+    }
+
+    PHP_V8_ISOLATE_FETCH_WITH_CHECK(getThis(), php_v8_isolate);
+
+    if (cpu_time_limit_in_seconds < 0) {
+        PHP_V8_THROW_EXCEPTION("CPU time limit should be a non-negative float");
+        return;
+    }
+
+    php_v8_isolate_limits_set_cpu_time_limit(php_v8_isolate, cpu_time_limit_in_seconds, static_cast<bool>(exclude_callbacks));
+}
+
+static PHP_METHOD(Isolate, getCpuTimeLimit) {
+    if (zend_parse_parameters_none() == FAILURE) {
+        return;
+    }
+
+    PHP_V8_ISOLATE_FETCH_WITH_CHECK(getThis(), php_v8_isolate);
+
+    RETVAL_DOUBLE(php_v8_isolate->limits.cpu_time_limit);
+}
+
+static PHP_METHOD(Isolate, isCpuTimeLimitHit) {
+    if (zend_parse_parameters_none() == FAILURE) {
+        return;
+    }
+
+    PHP_V8_ISOLATE_FETCH_WITH_CHECK(getThis(), php_v8_isolate);
+
+    RETVAL_BOOL(php_v8_isolate->limits.cpu_time_limit_hit);
+}
+
 static PHP_METHOD(Isolate, setMemoryLimit) {
     long memory_limit_in_bytes;
 
@@ -410,7 +501,9 @@ static PHP_METHOD(Isolate, getHeapStatistics) {
 
     isolate->GetHeapStatistics(&hs);
 
-    php_v8_heap_statistics_create_from_heap_statistics(return_value, &hs);
+    phpv8::ArrayBufferAllocator *allocator = static_cast<phpv8::ArrayBufferAllocator *>(php_v8_isolate->create_params->array_buffer_allocator);
+
+    php_v8_heap_statistics_create_from_heap_statistics(return_value, &hs, allocator->allocatedSize(), allocator->peakAllocatedSize());
 }
 
 static PHP_METHOD(Isolate, inContext) {
@@ -610,6 +703,7 @@ static PHP_METHOD(Isolate, isInUse) {
 
 PHP_V8_ZEND_BEGIN_ARG_WITH_CONSTRUCTOR_INFO_EX(arginfo___construct, 0)
                 ZEND_ARG_OBJ_INFO(0, snapshot, V8\\StartupData, 1)
+                ZEND_ARG_TYPE_INFO(0, memory_limit_in_bytes, IS_LONG, 0)
 ZEND_END_ARG_INFO()
 
 PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_MIXED_INFO_EX(arginfo_within, 1)
@@ -626,6 +720,20 @@ ZEND_END_ARG_INFO()
 PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_isTimeLimitHit, ZEND_RETURN_VALUE, 0, _IS_BOOL, 0)
 ZEND_END_ARG_INFO()
 
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_getTimeLimitOvershoot, ZEND_RETURN_VALUE, 0, IS_DOUBLE, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_VOID_INFO_EX(arginfo_setCpuTimeLimit, 1)
+                ZEND_ARG_TYPE_INFO(0, cpu_time_limit_in_seconds, IS_DOUBLE, 0)
+                ZEND_ARG_TYPE_INFO(0, exclude_callbacks, _IS_BOOL, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_getCpuTimeLimit, ZEND_RETURN_VALUE, 0, IS_DOUBLE, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_isCpuTimeLimitHit, ZEND_RETURN_VALUE, 0, _IS_BOOL, 0)
+ZEND_END_ARG_INFO()
+
 PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_VOID_INFO_EX(arginfo_setMemoryLimit, 1)
                 ZEND_ARG_TYPE_INFO(0, memory_limit_in_bytes, IS_LONG, 0)
 ZEND_END_ARG_INFO()
@@ -693,6 +801,10 @@ static const zend_function_entry php_v8_isolate_methods[] = {
         PHP_V8_ME(Isolate, setTimeLimit,               ZEND_ACC_PUBLIC)
         PHP_V8_ME(Isolate, getTimeLimit,               ZEND_ACC_PUBLIC)
         PHP_V8_ME(Isolate, isTimeLimitHit,             ZEND_ACC_PUBLIC)
+        PHP_V8_ME(Isolate, getTimeLimitOvershoot,      ZEND_ACC_PUBLIC)
+        PHP_V8_ME(Isolate, setCpuTimeLimit,            ZEND_ACC_PUBLIC)
+        PHP_V8_ME(Isolate, getCpuTimeLimit,            ZEND_ACC_PUBLIC)
+        PHP_V8_ME(Isolate, isCpuTimeLimitHit,          ZEND_ACC_PUBLIC)
         PHP_V8_ME(Isolate, setMemoryLimit,             ZEND_ACC_PUBLIC)
         PHP_V8_ME(Isolate, getMemoryLimit,             ZEND_ACC_PUBLIC)
         PHP_V8_ME(Isolate, isMemoryLimitHit,           ZEND_ACC_PUBLIC)
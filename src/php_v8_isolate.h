@@ -14,6 +14,11 @@
 #define PHP_V8_ISOLATE_H
 
 typedef struct _php_v8_isolate_t php_v8_isolate_t;
+typedef struct _php_v8_value_t php_v8_value_t;
+
+namespace phpv8 {
+    class IsolatePool;
+}
 
 #include "php_v8_startup_data.h"
 #include "php_v8_isolate_limits.h"
@@ -21,6 +26,7 @@ typedef struct _php_v8_isolate_t php_v8_isolate_t;
 #include "php_v8_callbacks.h"
 #include <v8.h>
 #include <vector>
+#include <unordered_map>
 
 extern "C" {
 #include "php.h"
@@ -33,8 +39,8 @@ extern "C" {
 extern zend_class_entry *php_v8_isolate_class_entry;
 
 inline php_v8_isolate_t * php_v8_isolate_fetch_object(zend_object *obj);
-inline v8::Local<v8::Private> php_v8_isolate_get_key_local(php_v8_isolate_t *php_v8_isolate);
 extern void php_v8_isolate_external_exceptions_maybe_clear(php_v8_isolate_t *php_v8_isolate);
+extern void php_v8_isolate_setup(zval *object, php_v8_isolate_t *php_v8_isolate, size_t memory_limit_in_bytes);
 
 // TODO: remove or cleanup to use for debug reasons
 #define SX(x) #x
@@ -143,23 +149,45 @@ namespace phpv8 {
     private:
         std::vector<zval> exceptions;
     };
+
+    /**
+     * Maps js objects to their php wrappers by object identity hash.
+     *
+     * Unlike storing wrapper pointer in private symbol on object itself, identity hash doesn't change object's hidden
+     * class, so objects that cross php boundary stay on the same fast paths in js code. Map doesn't hold wrappers,
+     * they are removed from it when freed.
+     */
+    class ObjectWrapperMap {
+    public:
+        void add(int hash, php_v8_value_t *php_v8_value);
+        void remove(int hash, php_v8_value_t *php_v8_value);
+        php_v8_value_t *find(int hash, v8::Local<v8::Object> local_object);
+    private:
+        std::unordered_multimap<int, php_v8_value_t *> wrappers;
+    };
 }
 
 struct _php_v8_isolate_t {
     v8::Isolate *isolate;
     v8::Isolate::CreateParams *create_params;
     phpv8::StartupData *blob;
+    phpv8::IsolatePool *pool;
 
     phpv8::PersistentCollection<v8::FunctionTemplate> *weak_function_templates;
     phpv8::PersistentCollection<v8::ObjectTemplate> *weak_object_templates;
     phpv8::PersistentCollection<v8::Value> *weak_values;
     phpv8::ExternalExceptionsStack *external_exceptions;
-
-    v8::Persistent<v8::Private> key;
+    phpv8::ObjectWrapperMap *object_wrappers;
 
     uint32_t isolate_handle;
     php_v8_isolate_limits_t limits;
 
+    size_t external_strings_count;
+
+    // idle callback info objects reused between callback invocations
+    zval function_callback_info_pool;
+    zval property_callback_info_pool;
+
     zval *gc_data;
     int   gc_data_count;
 
@@ -170,10 +198,6 @@ inline php_v8_isolate_t *php_v8_isolate_fetch_object(zend_object *obj) {
     return (php_v8_isolate_t *) ((char *) obj - XtOffsetOf(php_v8_isolate_t, std));
 }
 
-inline v8::Local<v8::Private> php_v8_isolate_get_key_local(php_v8_isolate_t *php_v8_isolate) {
-    return v8::Local<v8::Private>::New(php_v8_isolate->isolate, php_v8_isolate->key);
-}
-
 PHP_MINIT_FUNCTION(php_v8_isolate);
 
 #endif //PHP_V8_ISOLATE_H
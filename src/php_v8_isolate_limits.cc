@@ -16,8 +16,10 @@
 
 #include "php_v8_isolate.h"
 #include "php_v8_isolate_limits.h"
+#include "php_v8_array_buffer_allocator.h"
 
-#define PHP_V8_TIME_SLEEP_MILLISECONDS 10
+#include <algorithm>
+#include <cmath>
 
 //#define PHP_V8_DEBUG_EXECUTION 1
 #define one_mb (1024.0 * 1024.0)
@@ -35,113 +37,391 @@
 static inline void php_v8_isolate_limits_update_time_point(php_v8_isolate_limits_t *limits) {
     php_v8_debug_execution("Updating time limits\n");
 
-    std::chrono::milliseconds duration(static_cast<int64_t>(limits->time_limit * 1000));
-    std::chrono::time_point<std::chrono::high_resolution_clock> from = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> duration(limits->time_limit);
+    std::chrono::time_point<std::chrono::steady_clock> from = std::chrono::steady_clock::now();
 
     php_v8_debug_execution("             now: %.3f\n", std::chrono::time_point_cast<std::chrono::milliseconds>(from).time_since_epoch().count()/1000.0);
     php_v8_debug_execution("  old time point: %.3f\n", std::chrono::time_point_cast<std::chrono::milliseconds>(limits->time_point).time_since_epoch().count()/1000.0);
 
-    limits->time_point = from + duration;
+    limits->time_point = from + std::chrono::duration_cast<std::chrono::steady_clock::duration>(duration);
     php_v8_debug_execution("  new time point: %.3f\n", std::chrono::time_point_cast<std::chrono::milliseconds>(limits->time_point).time_since_epoch().count()/1000.0);
 }
 
-static inline void php_v8_isolate_limits_maybe_terminate_thread(php_v8_isolate_limits_t *limits) {
-    if (!limits->active && limits->thread) {
-        limits->thread->join();
-        delete limits->thread;
-        limits->thread = NULL;
+static inline void php_v8_isolate_limits_current_thread_cpu_clock(php_v8_thread_cpu_clock_t *clock) {
+#ifdef __APPLE__
+    *clock = pthread_mach_thread_np(pthread_self());
+#else
+    pthread_getcpuclockid(pthread_self(), clock);
+#endif
+}
+
+static inline double php_v8_isolate_limits_thread_cpu_time(php_v8_thread_cpu_clock_t clock) {
+#ifdef __APPLE__
+    thread_basic_info_data_t info;
+    mach_msg_type_number_t count = THREAD_BASIC_INFO_COUNT;
+
+    if (thread_info(clock, THREAD_BASIC_INFO, (thread_info_t) &info, &count) != KERN_SUCCESS) {
+        return 0;
+    }
+
+    return info.user_time.seconds + info.user_time.microseconds / 1e6
+           + info.system_time.seconds + info.system_time.microseconds / 1e6;
+#else
+    struct timespec ts;
+
+    if (clock_gettime(clock, &ts) != 0) {
+        return 0;
+    }
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+#endif
+}
+
+static inline void php_v8_isolate_limits_update_cpu_time_start(php_v8_isolate_limits_t *limits) {
+    php_v8_debug_execution("Updating CPU time limits\n");
+
+    // CPU time is accounted for the thread that enters isolate, which is always current one
+    php_v8_isolate_limits_current_thread_cpu_clock(&limits->cpu_clock);
+
+    limits->cpu_time_start = php_v8_isolate_limits_thread_cpu_time(limits->cpu_clock);
+    limits->cpu_time_excluded = 0;
+
+    if (limits->callback_depth) {
+        limits->cpu_time_callback_start = limits->cpu_time_start;
     }
 }
 
+static inline double php_v8_isolate_limits_cpu_time_used(php_v8_isolate_limits_t *limits) {
+    double cpu_now = php_v8_isolate_limits_thread_cpu_time(limits->cpu_clock);
+    double cpu_used = cpu_now - limits->cpu_time_start - limits->cpu_time_excluded;
+
+    if (limits->cpu_time_exclude_callbacks && limits->callback_depth) {
+        cpu_used -= cpu_now - limits->cpu_time_callback_start;
+    }
+
+    return cpu_used;
+}
+
+static inline std::chrono::time_point<std::chrono::steady_clock> php_v8_isolate_limits_cpu_time_deadline(php_v8_isolate_limits_t *limits, double cpu_used) {
+    // thread can't consume CPU time faster than wall time goes, so it's the earliest moment limit may be hit
+    std::chrono::duration<double> remaining(std::max(0.0, limits->cpu_time_limit - cpu_used));
+
+    return std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(remaining);
+}
+
+static inline std::chrono::time_point<std::chrono::steady_clock> php_v8_isolate_limits_deadline(php_v8_isolate_limits_t *limits) {
+    std::chrono::time_point<std::chrono::steady_clock> deadline = std::chrono::time_point<std::chrono::steady_clock>::max();
+
+    if (limits->time_limit > 0) {
+        deadline = limits->time_point;
+    }
+
+    if (limits->cpu_time_limit > 0) {
+        deadline = std::min(deadline, php_v8_isolate_limits_cpu_time_deadline(limits, php_v8_isolate_limits_cpu_time_used(limits)));
+    }
+
+    return deadline;
+}
+
+static inline bool php_v8_isolate_limits_is_active(php_v8_isolate_limits_t *limits) {
+    return (limits->time_limit > 0 || limits->cpu_time_limit > 0 || limits->memory_limit > 0)
+           && !limits->time_limit_hit
+           && !limits->cpu_time_limit_hit
+           && !limits->memory_limit_hit;
+}
+
+static inline bool php_v8_isolate_limits_is_timed(php_v8_isolate_limits_t *limits) {
+    // memory limit is enforced by v8 itself through heap callbacks, only time-based limits need watchdog
+    return limits->active && (limits->time_limit > 0 || limits->cpu_time_limit > 0);
+}
+
+static inline size_t php_v8_isolate_limits_used_memory(php_v8_isolate_limits_t *limits, v8::HeapStatistics &hs) {
+    size_t used = hs.used_heap_size();
+
+    // ArrayBuffer backing stores live outside of v8 heap, but they are still memory used by isolate
+    if (limits->array_buffer_allocator) {
+        used += limits->array_buffer_allocator->allocatedSize();
+    }
+
+    return used;
+}
+
+static void php_v8_isolate_limits_terminate_on_memory_limit(php_v8_isolate_t *php_v8_isolate) {
+    php_v8_isolate_limits_t *limits = &php_v8_isolate->limits;
+
+    std::lock_guard<std::mutex> lock(*limits->mutex);
+
+    if (!limits->active) {
+        return;
+    }
+
+    php_v8_debug_execution("    terminating on memory limit: %.2fmb limit\n", mb(limits->memory_limit));
+
+    limits->active = false;
+    limits->memory_limit_hit = true;
+    php_v8_isolate->isolate->TerminateExecution();
+}
+
 static void php_v8_isolate_limits_interrupt_handler(v8::Isolate *isolate, void *data) {
+    // Interrupts can't be cancelled, so pending one may fire after wrapper that requested it is gone. Wrapper is
+    // looked up from isolate itself then, and none of them is there while pooled isolate is idle.
+    php_v8_isolate_t *php_v8_isolate = PHP_V8_ISOLATE_FETCH_REFERENCE(isolate);
+
+    if (!php_v8_isolate || !php_v8_isolate->limits.memory_limit_in_progress) {
+        return;
+    }
+
+    php_v8_isolate_limits_t *limits = &php_v8_isolate->limits;
+
+    v8::HeapStatistics hs;
+
+    // Young generation GC reported that we are over the limit, but old generation garbage is counted in used heap
+    // size too, so full GC tells whether limit is really hit. Without it we would either terminate on garbage or,
+    // where there is no near heap limit callback, wait for v8's own full GC which may come far beyond the limit.
+    php_v8_debug_execution("    requesting gc: %.2fmb limit\n", mb(limits->memory_limit));
+    isolate->LowMemoryNotification();
+
+    isolate->GetHeapStatistics(&hs);
+    limits->memory_heap_used = hs.used_heap_size();
+    php_v8_debug_execution("Memory usage after gc: %.2fmb used, %.2fmb limit\n", mb(php_v8_isolate_limits_used_memory(limits, hs)), mb(limits->memory_limit));
+
+    if (limits->memory_limit > 0 && php_v8_isolate_limits_used_memory(limits, hs) > limits->memory_limit) {
+        php_v8_isolate_limits_terminate_on_memory_limit(php_v8_isolate);
+    } else {
+        limits->memory_limit_gc_forced = true;
+    }
+
+    limits->memory_limit_in_progress = false;
+}
+
+static void php_v8_isolate_limits_request_full_gc(php_v8_isolate_t *php_v8_isolate) {
+    // full GC is not allowed from within GC callbacks, and only one request is pending at a time
+    php_v8_isolate->limits.memory_limit_in_progress = true;
+    php_v8_isolate->isolate->RequestInterrupt(php_v8_isolate_limits_interrupt_handler, nullptr);
+}
+
+static void php_v8_isolate_limits_gc_epilogue(v8::Isolate *isolate, v8::GCType type, v8::GCCallbackFlags flags, void *data) {
     php_v8_isolate_t *php_v8_isolate = static_cast<php_v8_isolate_t *>(data);
     php_v8_isolate_limits_t *limits = &php_v8_isolate->limits;
 
-    v8::Locker locker(isolate);
+    // GC callbacks are invoked on the thread that holds isolate, the same one that sets memory limit, so we don't need
+    // to lock for reading it
+    if (!limits->mutex || !limits->memory_limit) {
+        return;
+    }
+
     v8::HeapStatistics hs;
+    isolate->GetHeapStatistics(&hs);
 
-    bool send_low_mem_notification = false;
-    bool has_low_mem_notification_sent = false;
+    // sampled here so that ArrayBuffer allocations don't have to collect heap statistics on their own
+    limits->memory_heap_used = hs.used_heap_size();
 
-    std::lock_guard<std::mutex> lock(*limits->mutex);
+    if (!limits->active || limits->memory_limit_in_progress) {
+        return;
+    }
 
-    do {
-        if (send_low_mem_notification) {
-            isolate->LowMemoryNotification();
-            has_low_mem_notification_sent = true;
-        }
+    size_t used = php_v8_isolate_limits_used_memory(limits, hs);
 
-        isolate->GetHeapStatistics(&hs);
-        php_v8_debug_execution("Memory usage: %.2fmb used, %.2fmb limit\n", mb(hs.used_heap_size()), mb(limits->memory_limit));
-
-        if (limits->memory_limit > 0 && hs.used_heap_size() > limits->memory_limit) {
-            php_v8_debug_execution("  Memory limit reached: %.2fmb used, %.2fmb limit\n", mb(hs.used_heap_size()), mb(limits->memory_limit));
-            if (has_low_mem_notification_sent) {
-                php_v8_debug_execution("    terminating: %.2fmb used, %.2fmb limit\n", mb(hs.used_heap_size()), mb(limits->memory_limit));
-                isolate->TerminateExecution();
-                limits->active = false;
-                limits->memory_limit_hit = true;
-            } else {
-                php_v8_debug_execution("    requesting gc: %.2fmb used, %.2fmb limit\n", mb(hs.used_heap_size()), mb(limits->memory_limit));
-                // send low memory notification, maybe GC free some space for us so we'll be staying under the limits
-                send_low_mem_notification = true;
-            }
+    if (used <= limits->memory_limit) {
+        if (type == v8::kGCTypeMarkSweepCompact) {
+            // old generation was collected by v8 itself, so next limit crossing is worth full GC again
+            limits->memory_limit_gc_forced = false;
         }
 
-    } while(send_low_mem_notification != has_low_mem_notification_sent);
+        return;
+    }
 
-    limits->memory_limit_in_progress = false;
+    php_v8_debug_execution("Memory limit reached: %.2fmb used, %.2fmb limit\n", mb(used), mb(limits->memory_limit));
+
+    if (type == v8::kGCTypeMarkSweepCompact) {
+        php_v8_isolate_limits_terminate_on_memory_limit(php_v8_isolate);
+        return;
+    }
+
+    if (limits->memory_limit_gc_forced) {
+        // Forced full GC already found live objects within the limit and v8 hasn't collected old generation since
+        // then, so scavenges keep reporting the same old generation garbage. Limit is checked again on v8's own full
+        // GC or when v8 is near its heap limit, instead of forcing full GC on every scavenge.
+        return;
+    }
+
+    // old generation garbage might be still there, so let's check it once again after full GC
+    php_v8_isolate_limits_request_full_gc(php_v8_isolate);
 }
 
-void php_v8_isolate_limits_thread(php_v8_isolate_t *php_v8_isolate) {
+#if V8_MAJOR_VERSION > 6 || (V8_MAJOR_VERSION == 6 && V8_MINOR_VERSION >= 7)
+#define PHP_V8_HAVE_NEAR_HEAP_LIMIT_CALLBACK 1
+
+static size_t php_v8_isolate_limits_near_heap_limit(void *data, size_t current_heap_limit, size_t initial_heap_limit) {
+    php_v8_isolate_t *php_v8_isolate = static_cast<php_v8_isolate_t *>(data);
     php_v8_isolate_limits_t *limits = &php_v8_isolate->limits;
-    std::chrono::time_point<std::chrono::high_resolution_clock> now;
-    std::chrono::milliseconds duration(PHP_V8_TIME_SLEEP_MILLISECONDS);
 
-    while (true) {
-        limits->mutex->lock();
+    php_v8_debug_execution("Near heap limit: %.2fmb current, %.2fmb initial, %.2fmb limit\n", mb(current_heap_limit), mb(initial_heap_limit), mb(limits->memory_limit));
+
+    if (!limits->mutex || !limits->memory_limit) {
+        // let v8 handle OOM on its own
+        return current_heap_limit;
+    }
 
-        if (limits->active && limits->time_limit > 0) {
+    if (limits->memory_limit > current_heap_limit) {
+        // memory limit was raised after isolate was created, let heap grow up to it
+        return limits->memory_limit;
+    }
 
-            now = std::chrono::high_resolution_clock::now();
+    php_v8_isolate_limits_terminate_on_memory_limit(php_v8_isolate);
 
-            if (now > limits->time_point) {
-                php_v8_debug_execution("Time limit reached, terminating\n");
-                php_v8_debug_execution("         now: %.3f\n", std::chrono::time_point_cast<std::chrono::milliseconds>(now).time_since_epoch().count()/1000.0);
-                php_v8_debug_execution("  time point: %.3f\n", std::chrono::time_point_cast<std::chrono::milliseconds>(limits->time_point).time_since_epoch().count()/1000.0);
+    // give v8 some room to unwind execution after termination
+    return current_heap_limit * 2;
+}
+#endif
 
-                limits->time_limit_hit = true;
-                limits->active = false;
-                php_v8_isolate->isolate->TerminateExecution();
+static void php_v8_isolate_limits_check(php_v8_isolate_t *php_v8_isolate, std::chrono::time_point<std::chrono::steady_clock> &wake_up) {
+    php_v8_isolate_limits_t *limits = &php_v8_isolate->limits;
+    std::chrono::time_point<std::chrono::steady_clock> now;
+
+    // isolate is disarmed under the same lock, so execution is never terminated once it left js
+    std::lock_guard<std::mutex> lock(*limits->mutex);
+
+    if (!limits->armed) {
+        return;
+    }
+
+    if (limits->active && limits->time_limit > 0) {
+
+        now = std::chrono::steady_clock::now();
+
+        if (now >= limits->time_point) {
+            php_v8_debug_execution("Time limit reached, terminating\n");
+            php_v8_debug_execution("         now: %.3f\n", std::chrono::time_point_cast<std::chrono::milliseconds>(now).time_since_epoch().count()/1000.0);
+            php_v8_debug_execution("  time point: %.3f\n", std::chrono::time_point_cast<std::chrono::milliseconds>(limits->time_point).time_since_epoch().count()/1000.0);
+
+            limits->time_limit_hit = true;
+            limits->time_limit_overshoot = std::chrono::duration<double>(now - limits->time_point).count();
+            limits->active = false;
+            limits->armed = false;
+            php_v8_isolate->isolate->TerminateExecution();
+        } else if (limits->time_point < wake_up) {
+            wake_up = limits->time_point;
+        }
+    }
+
+    if (limits->active && limits->cpu_time_limit > 0) {
+        double cpu_used = php_v8_isolate_limits_cpu_time_used(limits);
+
+        if (cpu_used >= limits->cpu_time_limit) {
+            php_v8_debug_execution("CPU time limit reached, terminating: %.6f used, %.6f limit\n", cpu_used, limits->cpu_time_limit);
+
+            limits->cpu_time_limit_hit = true;
+            limits->active = false;
+            limits->armed = false;
+            php_v8_isolate->isolate->TerminateExecution();
+        } else {
+            wake_up = std::min(wake_up, php_v8_isolate_limits_cpu_time_deadline(limits, cpu_used));
+        }
+    }
+}
+
+static phpv8::IsolateLimitsWatchdog php_v8_isolate_limits_watchdog;
+
+namespace phpv8 {
+    void IsolateLimitsWatchdog::arm(php_v8_isolate_t *php_v8_isolate, std::chrono::time_point<std::chrono::steady_clock> deadline) {
+        php_v8_isolate_limits_t *limits = &php_v8_isolate->limits;
+
+        if (limits->watched) {
+            // Isolate is already scanned by watchdog, which will see it armed on its next wake up. It has to be woken
+            // earlier only when new deadline comes before that. While watchdog scans, its wake up is at max, so
+            // isolate armed after it was scanned is never missed.
+            if (deadline.time_since_epoch().count() < wake_up.load()) {
+                std::lock_guard<std::mutex> lock(mutex);
+                cv.notify_one();
             }
+
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+
+        php_v8_debug_execution("Add isolate to watchdog: %s\n", has(thread, "thread"));
+
+        limits->watched = true;
+        isolates.push_back(php_v8_isolate);
+
+        if (!thread) {
+            stopping = false;
+            thread = new std::thread(&IsolateLimitsWatchdog::run, this);
+        }
+
+        cv.notify_one();
+    }
+
+    void IsolateLimitsWatchdog::remove(php_v8_isolate_t *php_v8_isolate) {
+        php_v8_isolate_limits_t *limits = &php_v8_isolate->limits;
+
+        if (!limits->watched) {
+            return;
         }
 
-        if (limits->active && limits->memory_limit > 0 && !limits->memory_limit_in_progress) {
-            php_v8_debug_execution("Checking memory limit\n");
-            /*
-             * For memory limit check we need to call v8::Isolate::GetHeapStatistics() which is not thread-safe and
-             * thus needs v8::Locker on isolate, so we request isolate to interrupt execution and perform our checks
-             */
-            php_v8_isolate->isolate->RequestInterrupt(php_v8_isolate_limits_interrupt_handler, php_v8_isolate);
-            limits->memory_limit_in_progress = true;
+        // once we return from here watchdog thread is guaranteed to not touch given isolate anymore
+        std::lock_guard<std::mutex> lock(mutex);
+
+        php_v8_debug_execution("Remove isolate from watchdog\n");
+
+        limits->watched = false;
+
+        for (auto it = isolates.begin(); it != isolates.end(); ++it) {
+            if (*it == php_v8_isolate) {
+                isolates.erase(it);
+                break;
+            }
         }
+    }
 
-        limits->mutex->unlock();
+    void IsolateLimitsWatchdog::shutdown() {
+        std::unique_lock<std::mutex> lock(mutex);
 
-        if (!limits->active) {
-            php_v8_debug_execution("Exit timer loop: %s, %s\n", has(limits->mutex, "mutex"), has(limits->thread, "thread"));
-            php_v8_debug_execution("  active: %s, depth: %d, time limit hit: %d, memory limit hit: %d\n", is(limits->active), limits->depth, limits->time_limit_hit, limits->memory_limit_hit);
+        if (!thread) {
             return;
         }
 
-        std::this_thread::sleep_for(duration);
+        stopping = true;
+        cv.notify_one();
+        lock.unlock();
+
+        thread->join();
+
+        lock.lock();
+        delete thread;
+        thread = nullptr;
+    }
+
+    void IsolateLimitsWatchdog::run() {
+        std::unique_lock<std::mutex> lock(mutex);
+
+        while (!stopping) {
+            std::chrono::time_point<std::chrono::steady_clock> next = std::chrono::time_point<std::chrono::steady_clock>::max();
+
+            wake_up.store(next.time_since_epoch().count());
+
+            for (php_v8_isolate_t *php_v8_isolate : isolates) {
+                php_v8_isolate_limits_check(php_v8_isolate, next);
+            }
+
+            wake_up.store(next.time_since_epoch().count());
+
+            if (next == std::chrono::time_point<std::chrono::steady_clock>::max()) {
+                cv.wait(lock);
+            } else {
+                // sleep till the closest deadline unless some isolate is armed with earlier one
+                cv.wait_until(lock, next);
+            }
+        }
     }
 }
 
 void php_v8_isolate_limits_maybe_start_timer(php_v8_isolate_t *php_v8_isolate) {
     php_v8_isolate_limits_t *limits = &php_v8_isolate->limits;
 
-    php_v8_debug_execution("Maybe start timer: %d, %s, %s\n", limits->depth, has(limits->mutex, "mutex"), has(limits->thread, "thread"));
+    php_v8_debug_execution("Maybe start timer: %d, %s\n", limits->depth, has(limits->mutex, "mutex"));
 
     assert (limits->depth < UINT32_MAX);
 
@@ -150,14 +430,25 @@ void php_v8_isolate_limits_maybe_start_timer(php_v8_isolate_t *php_v8_isolate) {
         return;
     }
 
-    std::lock_guard<std::mutex> lock(*limits->mutex);
-    limits->depth++;
+    limits->mutex->lock();
+
+    bool arm = php_v8_isolate_limits_is_timed(limits) && !limits->depth;
+    std::chrono::time_point<std::chrono::steady_clock> deadline;
 
-    if (limits->active && !limits->thread) {
+    if (arm) {
         php_v8_isolate_limits_update_time_point(limits);
+        php_v8_isolate_limits_update_cpu_time_start(limits);
+
+        limits->armed = true;
+        deadline = php_v8_isolate_limits_deadline(limits);
+    }
 
+    limits->depth++;
+    limits->mutex->unlock();
+
+    if (arm) {
         php_v8_debug_execution("  start timer\n");
-        limits->thread = new std::thread(php_v8_isolate_limits_thread, php_v8_isolate);
+        php_v8_isolate_limits_watchdog.arm(php_v8_isolate, deadline);
     }
 }
 
@@ -167,7 +458,7 @@ void php_v8_isolate_limits_maybe_stop_timer(php_v8_isolate_t *php_v8_isolate) {
 
     assert (limits->depth > 0);
 
-    php_v8_debug_execution("Maybe stopping timer: %s, %s\n", has(limits->mutex, "mutex"), has(limits->thread, "thread"));
+    php_v8_debug_execution("Maybe stopping timer: %s\n", has(limits->mutex, "mutex"));
     php_v8_debug_execution("    active: %s, depth: %d, time limit hit: %d, memory limit hit: %d\n", is(limits->active), limits->depth, limits->time_limit_hit, limits->memory_limit_hit);
 
     if (!limits->mutex) {
@@ -175,22 +466,12 @@ void php_v8_isolate_limits_maybe_stop_timer(php_v8_isolate_t *php_v8_isolate) {
         return;
     }
 
-    limits->mutex->lock();
-    limits->depth--;
-
-    bool active = limits->active;
-
-    limits->active = limits->active && limits->depth;
-
-    limits->mutex->unlock();
+    std::lock_guard<std::mutex> lock(*limits->mutex);
 
-    if (!limits->active && limits->thread) {
-        limits->thread->join();
-        delete limits->thread;
-        limits->thread = NULL;
+    // watchdog keeps sleeping till its closest deadline and just skips disarmed isolate then
+    if (!--limits->depth) {
+        limits->armed = false;
     }
-
-    limits->active = active;
 }
 
 void php_v8_isolate_limits_free(php_v8_isolate_t *php_v8_isolate) {
@@ -198,13 +479,24 @@ void php_v8_isolate_limits_free(php_v8_isolate_t *php_v8_isolate) {
 
     limits->active = false;
 
-    if (limits->thread) {
-        limits->thread->join();
-        delete limits->thread;
+    php_v8_isolate_limits_watchdog.remove(php_v8_isolate);
+
+    if (php_v8_isolate->isolate) {
+        // isolate may outlive this object when it goes back to isolate pool
+        php_v8_isolate->isolate->RemoveGCEpilogueCallback(php_v8_isolate_limits_gc_epilogue, php_v8_isolate);
+#ifdef PHP_V8_HAVE_NEAR_HEAP_LIMIT_CALLBACK
+        php_v8_isolate->isolate->RemoveNearHeapLimitCallback(php_v8_isolate_limits_near_heap_limit, 0);
+#endif
+    }
+
+    if (limits->array_buffer_allocator) {
+        limits->array_buffer_allocator->unbind();
+        limits->array_buffer_allocator = NULL;
     }
 
     if (limits->mutex) {
         delete limits->mutex;
+        limits->mutex = NULL;
     }
 
     limits->time_point.~time_point();
@@ -213,11 +505,51 @@ void php_v8_isolate_limits_free(php_v8_isolate_t *php_v8_isolate) {
 void php_v8_isolate_limits_ctor(php_v8_isolate_t *php_v8_isolate) {
     PHP_V8_DECLARE_LIMITS(php_v8_isolate);
 
-    limits->thread = NULL;
+    limits->armed = false;
+    limits->watched = false;
     limits->mutex = NULL;
     limits->depth = 0;
+    limits->time_limit_overshoot = 0;
+    limits->memory_limit_gc_forced = false;
+    limits->memory_heap_used = 0;
+    limits->array_buffer_allocator = NULL;
+
+    new(&limits->time_point) std::chrono::time_point<std::chrono::steady_clock>();
+}
+
+void php_v8_isolate_limits_configure(v8::Isolate::CreateParams *create_params, size_t memory_limit_in_bytes) {
+    if (!memory_limit_in_bytes) {
+        return;
+    }
+
+#ifdef PHP_V8_HAVE_NEAR_HEAP_LIMIT_CALLBACK
+    size_t max_old_space_size_in_mb = static_cast<size_t>(ceil(memory_limit_in_bytes / one_mb));
+
+    // v8 heap limit is set to memory limit, so that v8 will invoke near heap limit callback as soon as it reached
+    create_params->constraints.set_max_old_space_size(static_cast<int>(max_old_space_size_in_mb));
+#else
+    // Without near heap limit callback reaching v8 heap limit is a fatal OOM, so heap is left unconstrained and limit
+    // is enforced by GC epilogue callback alone
+    (void) create_params;
+#endif
+}
 
-    new(&limits->time_point) std::chrono::time_point<std::chrono::high_resolution_clock>();
+void php_v8_isolate_limits_init(php_v8_isolate_t *php_v8_isolate, size_t memory_limit_in_bytes) {
+    PHP_V8_DECLARE_ISOLATE(php_v8_isolate);
+    PHP_V8_DECLARE_LIMITS(php_v8_isolate);
+
+    isolate->AddGCEpilogueCallback(php_v8_isolate_limits_gc_epilogue, php_v8_isolate);
+#ifdef PHP_V8_HAVE_NEAR_HEAP_LIMIT_CALLBACK
+    isolate->AddNearHeapLimitCallback(php_v8_isolate_limits_near_heap_limit, php_v8_isolate);
+#endif
+
+    // isolate create params always come with our own allocator, whether isolate is created directly or taken from pool
+    limits->array_buffer_allocator = static_cast<phpv8::ArrayBufferAllocator *>(php_v8_isolate->create_params->array_buffer_allocator);
+    limits->array_buffer_allocator->bind(php_v8_isolate);
+
+    if (memory_limit_in_bytes) {
+        php_v8_isolate_limits_set_memory_limit(php_v8_isolate, memory_limit_in_bytes);
+    }
 }
 
 void php_v8_isolate_limits_set_time_limit(php_v8_isolate_t *php_v8_isolate, double time_limit_in_seconds) {
@@ -242,22 +574,70 @@ void php_v8_isolate_limits_set_time_limit(php_v8_isolate_t *php_v8_isolate, doub
         php_v8_debug_execution(" trying to recover from time limit hit, active: %s\n", is(limits->active));
 
         isolate->CancelTerminateExecution();
-
-        php_v8_isolate_limits_maybe_terminate_thread(limits);
         limits->time_limit_hit = false;
+        limits->time_limit_overshoot = 0;
     }
 
-    limits->active = (limits->time_limit > 0 || limits->memory_limit > 0)
-                     && !limits->time_limit_hit
-                     && !limits->memory_limit_hit;
+    limits->active = php_v8_isolate_limits_is_active(limits);
+    limits->armed = php_v8_isolate_limits_is_timed(limits) && limits->depth;
 
-    if (limits->active && limits->depth && !limits->thread) {
+    bool arm = limits->armed;
+    std::chrono::time_point<std::chrono::steady_clock> deadline;
+
+    if (arm) {
+        deadline = php_v8_isolate_limits_deadline(limits);
+    }
+
+    limits->mutex->unlock();
+
+    if (arm) {
         php_v8_debug_execution("Restart timer: %d, %s, %s\n", limits->depth, has(limits->memory_limit_hit, "memory limit hit"), has(limits->time_limit_hit, "time limit hit"));
-        limits->thread = new std::thread(php_v8_isolate_limits_thread, php_v8_isolate);
+        php_v8_isolate_limits_watchdog.arm(php_v8_isolate, deadline);
+    }
+}
+
+void php_v8_isolate_limits_set_cpu_time_limit(php_v8_isolate_t *php_v8_isolate, double cpu_time_limit_in_seconds, bool exclude_callbacks) {
+    PHP_V8_DECLARE_ISOLATE(php_v8_isolate);
+    PHP_V8_DECLARE_LIMITS(php_v8_isolate);
+
+    assert(cpu_time_limit_in_seconds >= 0);
+
+    v8::Locker locker(isolate);
+
+    if (!limits->mutex) {
+        limits->mutex = new std::mutex();
+    }
+
+    limits->mutex->lock();
+
+    php_v8_debug_execution("Setting CPU time limits, new limit: %f, old limit: %f, cpu_time_limit_hit: %s\n", cpu_time_limit_in_seconds, limits->cpu_time_limit, is(limits->cpu_time_limit_hit));
+    limits->cpu_time_limit = cpu_time_limit_in_seconds;
+    limits->cpu_time_exclude_callbacks = exclude_callbacks;
+    php_v8_isolate_limits_update_cpu_time_start(limits);
+
+    if (limits->cpu_time_limit_hit) {
+        php_v8_debug_execution(" trying to recover from CPU time limit hit, active: %s\n", is(limits->active));
+
+        isolate->CancelTerminateExecution();
+        limits->cpu_time_limit_hit = false;
+    }
+
+    limits->active = php_v8_isolate_limits_is_active(limits);
+    limits->armed = php_v8_isolate_limits_is_timed(limits) && limits->depth;
+
+    bool arm = limits->armed;
+    std::chrono::time_point<std::chrono::steady_clock> deadline;
+
+    if (arm) {
+        deadline = php_v8_isolate_limits_deadline(limits);
     }
 
     limits->mutex->unlock();
-    php_v8_isolate_limits_maybe_terminate_thread(limits);
+
+    if (arm) {
+        php_v8_debug_execution("Restart timer: %d, %s, %s\n", limits->depth, has(limits->memory_limit_hit, "memory limit hit"), has(limits->cpu_time_limit_hit, "CPU time limit hit"));
+        php_v8_isolate_limits_watchdog.arm(php_v8_isolate, deadline);
+    }
 }
 
 void php_v8_isolate_limits_set_memory_limit(php_v8_isolate_t *php_v8_isolate, size_t memory_limit_in_bytes) {
@@ -274,25 +654,97 @@ void php_v8_isolate_limits_set_memory_limit(php_v8_isolate_t *php_v8_isolate, si
 
     php_v8_debug_execution("Updating memory limits, memory_limit_hit: %s\n", is(limits->memory_limit_hit));
     limits->memory_limit = memory_limit_in_bytes;
+    limits->memory_limit_gc_forced = false;
 
     if (limits->memory_limit_hit) {
         php_v8_debug_execution(" trying to recover from memory limit hit, active: %s\n", is(limits->active));
 
         isolate->CancelTerminateExecution();
-
-        php_v8_isolate_limits_maybe_terminate_thread(limits);
         limits->memory_limit_hit = false;
     }
 
-    limits->active = (limits->time_limit > 0 || limits->memory_limit > 0)
-                     && !limits->time_limit_hit
-                     && !limits->memory_limit_hit;
+    limits->active = php_v8_isolate_limits_is_active(limits);
+    limits->armed = php_v8_isolate_limits_is_timed(limits) && limits->depth;
 
-    if (limits->active && limits->depth && !limits->thread) {
-        php_v8_debug_execution("Restart timer: %d, %s, %s\n", limits->depth, has(limits->memory_limit_hit, "memory limit hit"), has(limits->time_limit_hit, "time limit hit"));
-        limits->thread = new std::thread(php_v8_isolate_limits_thread, php_v8_isolate);
+    bool arm = limits->armed;
+    std::chrono::time_point<std::chrono::steady_clock> deadline;
+
+    if (arm) {
+        deadline = php_v8_isolate_limits_deadline(limits);
     }
 
     limits->mutex->unlock();
-    php_v8_isolate_limits_maybe_terminate_thread(limits);
+
+    if (arm) {
+        php_v8_debug_execution("Restart timer: %d, %s, %s\n", limits->depth, has(limits->memory_limit_hit, "memory limit hit"), has(limits->time_limit_hit, "time limit hit"));
+        php_v8_isolate_limits_watchdog.arm(php_v8_isolate, deadline);
+    }
+
+    // Heap constraint derived from constructor limit can't be changed once isolate is created, so limit is checked
+    // against current usage the same way GC does it, while near heap limit callback lets heap grow up to raised limit
+    if (limits->memory_limit && limits->active && !limits->memory_limit_in_progress) {
+        v8::HeapStatistics hs;
+        isolate->GetHeapStatistics(&hs);
+        limits->memory_heap_used = hs.used_heap_size();
+
+        if (php_v8_isolate_limits_used_memory(limits, hs) > limits->memory_limit) {
+            php_v8_debug_execution("Memory limit reached on update: %.2fmb used, %.2fmb limit\n", mb(php_v8_isolate_limits_used_memory(limits, hs)), mb(limits->memory_limit));
+            php_v8_isolate_limits_request_full_gc(php_v8_isolate);
+        }
+    }
+}
+
+bool php_v8_isolate_limits_fits_array_buffer(php_v8_isolate_t *php_v8_isolate, size_t length) {
+    PHP_V8_DECLARE_LIMITS(php_v8_isolate);
+
+    // buffers are allocated on the thread that holds isolate, the same one that sets memory limit, so we don't need
+    // to lock for reading it
+    if (!limits->mutex || !limits->memory_limit || !limits->array_buffer_allocator) {
+        return true;
+    }
+
+    // heap usage is the one seen by the last GC, it only grows between GCs, so this never overestimates usage
+    size_t allocated = limits->array_buffer_allocator->allocatedSize() + limits->memory_heap_used;
+
+    if (length <= limits->memory_limit && allocated <= limits->memory_limit - length) {
+        return true;
+    }
+
+    php_v8_debug_execution("Memory limit reached on ArrayBuffer allocation: %.2fmb allocated with heap, %.2fmb requested, %.2fmb limit\n", mb(allocated), mb(length), mb(limits->memory_limit));
+
+    php_v8_isolate_limits_terminate_on_memory_limit(php_v8_isolate);
+
+    return false;
+}
+
+void php_v8_isolate_limits_shutdown() {
+    php_v8_isolate_limits_watchdog.shutdown();
+}
+
+void php_v8_isolate_limits_callback_enter(php_v8_isolate_t *php_v8_isolate) {
+    PHP_V8_DECLARE_LIMITS(php_v8_isolate);
+
+    if (!limits->mutex || !limits->cpu_time_exclude_callbacks) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(*limits->mutex);
+
+    if (!limits->callback_depth++) {
+        limits->cpu_time_callback_start = php_v8_isolate_limits_thread_cpu_time(limits->cpu_clock);
+    }
+}
+
+void php_v8_isolate_limits_callback_leave(php_v8_isolate_t *php_v8_isolate) {
+    PHP_V8_DECLARE_LIMITS(php_v8_isolate);
+
+    if (!limits->mutex || !limits->callback_depth) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(*limits->mutex);
+
+    if (!--limits->callback_depth) {
+        limits->cpu_time_excluded += php_v8_isolate_limits_thread_cpu_time(limits->cpu_clock) - limits->cpu_time_callback_start;
+    }
 }
@@ -15,23 +15,45 @@
 
 typedef struct _php_v8_isolate_limits_t php_v8_isolate_limits_t;
 
+namespace phpv8 {
+    class ArrayBufferAllocator;
+}
+
 #include "php_v8_exceptions.h"
 
 #include <v8.h>
 #include <atomic>
 #include <mutex>
+#include <condition_variable>
 #include <thread>
 #include <chrono>
+#include <vector>
+
+#ifdef __APPLE__
+#include <mach/mach.h>
+typedef mach_port_t php_v8_thread_cpu_clock_t;
+#else
+#include <pthread.h>
+#include <time.h>
+typedef clockid_t php_v8_thread_cpu_clock_t;
+#endif
 
-extern void php_v8_isolate_limits_thread(php_v8_isolate_t *php_v8_isolate);
 extern void php_v8_isolate_limits_maybe_start_timer(php_v8_isolate_t *php_v8_isolate);
 extern void php_v8_isolate_limits_maybe_stop_timer(php_v8_isolate_t *php_v8_isolate);
 extern void php_v8_isolate_limits_free(php_v8_isolate_t *php_v8_isolate);
 extern void php_v8_isolate_limits_ctor(php_v8_isolate_t *php_v8_isolate);
+extern void php_v8_isolate_limits_configure(v8::Isolate::CreateParams *create_params, size_t memory_limit_in_bytes);
+extern void php_v8_isolate_limits_init(php_v8_isolate_t *php_v8_isolate, size_t memory_limit_in_bytes);
 
 extern void php_v8_isolate_limits_set_time_limit(php_v8_isolate_t *php_v8_isolate, double time_limit_in_seconds);
+extern void php_v8_isolate_limits_set_cpu_time_limit(php_v8_isolate_t *php_v8_isolate, double cpu_time_limit_in_seconds, bool exclude_callbacks);
 extern void php_v8_isolate_limits_set_memory_limit(php_v8_isolate_t *php_v8_isolate, size_t memory_limit_in_bytes);
 extern void php_v8_isolate_limits_set_limits(php_v8_isolate_t *php_v8_isolate, double time_limit_in_seconds, size_t memory_limit_in_bytes);
+extern void php_v8_isolate_limits_shutdown();
+extern bool php_v8_isolate_limits_fits_array_buffer(php_v8_isolate_t *php_v8_isolate, size_t length);
+
+extern void php_v8_isolate_limits_callback_enter(php_v8_isolate_t *php_v8_isolate);
+extern void php_v8_isolate_limits_callback_leave(php_v8_isolate_t *php_v8_isolate);
 
 #define PHP_V8_DECLARE_ISOLATE_LOCAL_ALIAS(i) v8::Isolate *isolate = (i);
 
@@ -52,20 +74,64 @@ extern void php_v8_isolate_limits_set_limits(php_v8_isolate_t *php_v8_isolate, d
     php_v8_isolate_limits_maybe_start_timer((php_v8_context)->php_v8_isolate);
 
 
+namespace phpv8 {
+
+    /**
+     * Single watchdog thread shared by all isolates that have time limits set.
+     *
+     * Isolate is added to watchdog once, when it first enters JS execution with active limits, and stays there till
+     * it is freed. Entering and leaving JS just arms and disarms isolate under its own limits lock, which watchdog
+     * takes too when it checks isolate, so the shared lock is taken only when new deadline is closer than watchdog's
+     * next wake up. Watchdog sleeps till the closest deadline and doesn't wake up at all while there are no armed
+     * isolates.
+     */
+    class IsolateLimitsWatchdog {
+    public:
+        void arm(php_v8_isolate_t *php_v8_isolate, std::chrono::time_point<std::chrono::steady_clock> deadline);
+        void remove(php_v8_isolate_t *php_v8_isolate);
+        void shutdown();
+    private:
+        void run();
+
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::thread *thread = nullptr;
+        std::vector<php_v8_isolate_t *> isolates;
+        bool stopping = false;
+        // time since epoch of watchdog's next wake up, max while it sleeps without deadline or scans isolates
+        std::atomic<std::chrono::steady_clock::rep> wake_up{std::chrono::steady_clock::time_point::max().time_since_epoch().count()};
+    };
+}
+
 struct _php_v8_isolate_limits_t {
     std::atomic_bool active;
     uint32_t depth;
 
-    std::thread *thread;
+    bool armed;
+    bool watched;
     std::mutex *mutex;
 
-    std::chrono::time_point<std::chrono::high_resolution_clock> time_point;
+    std::chrono::time_point<std::chrono::steady_clock> time_point;
     double time_limit;
     bool time_limit_hit;
+    double time_limit_overshoot;
+
+    double cpu_time_limit;
+    bool cpu_time_limit_hit;
+    bool cpu_time_exclude_callbacks;
+    php_v8_thread_cpu_clock_t cpu_clock;
+    double cpu_time_start;
+    double cpu_time_excluded;
+    double cpu_time_callback_start;
+    uint32_t callback_depth;
 
     size_t memory_limit;
     bool memory_limit_hit;
     bool memory_limit_in_progress;
+    bool memory_limit_gc_forced;
+    size_t memory_heap_used;
+
+    phpv8::ArrayBufferAllocator *array_buffer_allocator;
 };
 
 
@@ -0,0 +1,510 @@
+/*
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "php_v8_isolate_pool.h"
+#include "php_v8_isolate.h"
+#include "php_v8_array_buffer_allocator.h"
+#include "php_v8_startup_data.h"
+#include "php_v8_exceptions.h"
+#include "php_v8_a.h"
+#include "php_v8.h"
+
+
+zend_class_entry *php_v8_isolate_pool_class_entry;
+#define this_ce php_v8_isolate_pool_class_entry
+
+static zend_object_handlers php_v8_isolate_pool_object_handlers;
+
+
+namespace phpv8 {
+    IsolatePool::~IsolatePool() {
+        clear();
+
+        // at this point all isolates handed out from pool should be already destroyed
+        for (auto const &retired_snapshot : retired) {
+            pefree((void *) retired_snapshot->data, 1);
+            delete retired_snapshot;
+        }
+
+        if (snapshot) {
+            pefree((void *) snapshot->data, 1);
+            delete snapshot;
+        }
+    }
+
+    IsolatePool::Entry IsolatePool::acquire() {
+        Entry entry;
+
+        in_use++;
+
+        if (!idle.empty()) {
+            hits++;
+            entry = idle.back();
+            idle.pop_back();
+
+            return entry;
+        }
+
+        misses++;
+
+        return create();
+    }
+
+    IsolatePool::Entry IsolatePool::create() {
+        Entry entry;
+
+        creations++;
+
+        entry.create_params = new v8::Isolate::CreateParams();
+        entry.create_params->array_buffer_allocator = new phpv8::ArrayBufferAllocator();
+        entry.create_params->snapshot_blob = snapshot;
+
+        entry.isolate = v8::Isolate::New(*entry.create_params);
+
+        return entry;
+    }
+
+    void IsolatePool::warmUp(size_t count) {
+        while (idle.size() < count) {
+            idle.push_back(create());
+        }
+    }
+
+    void IsolatePool::recycle(Entry entry) {
+        if (!keep(entry)) {
+            dispose(entry);
+        }
+
+        release();
+    }
+
+    void IsolatePool::discard(Entry entry) {
+        // isolate is disposed by its owner, so we can't free retired snapshots here as it may still use one of them
+        assert(in_use > 0);
+        in_use--;
+        discards++;
+    }
+
+    bool IsolatePool::keep(Entry entry) {
+        v8::Isolate *isolate = entry.isolate;
+
+        if (isolate->IsInUse() || isolate->IsDead() || entry.create_params->snapshot_blob != snapshot || idle.size() >= max_idle) {
+            // isolate is still entered, was created from snapshot that has been replaced since then or pool is full
+            discards++;
+            return false;
+        }
+
+        {
+            v8::Locker locker(isolate);
+            v8::Isolate::Scope isolate_scope(isolate);
+
+            if (isolate->IsExecutionTerminating()) {
+                isolate->CancelTerminateExecution();
+            }
+
+            if (max_heap_size) {
+                v8::HeapStatistics hs;
+                isolate->GetHeapStatistics(&hs);
+
+                if (hs.used_heap_size() > max_heap_size) {
+                    // contexts from previous usage may be still alive, so let's try to get rid of them first
+                    isolate->LowMemoryNotification();
+                    isolate->GetHeapStatistics(&hs);
+                }
+
+                if (hs.used_heap_size() > max_heap_size) {
+                    evictions++;
+                    return false;
+                }
+            }
+
+            isolate->SetData(0, nullptr);
+        }
+
+        idle.push_back(entry);
+
+        return true;
+    }
+
+    void IsolatePool::release() {
+        assert(in_use > 0);
+        in_use--;
+
+        if (in_use || retired.empty()) {
+            return;
+        }
+
+        for (auto const &retired_snapshot : retired) {
+            pefree((void *) retired_snapshot->data, 1);
+            delete retired_snapshot;
+        }
+
+        retired.clear();
+    }
+
+    void IsolatePool::clear() {
+        for (auto const &entry : idle) {
+            dispose(entry);
+        }
+
+        idle.clear();
+    }
+
+    void IsolatePool::setMaxIdle(size_t max) {
+        max_idle = max;
+
+        while (idle.size() > max_idle) {
+            dispose(idle.back());
+            idle.pop_back();
+        }
+    }
+
+    void IsolatePool::dispose(Entry entry) {
+        entry.isolate->Dispose();
+
+        delete entry.create_params->array_buffer_allocator;
+        delete entry.create_params;
+    }
+
+    bool IsolatePool::hasSameSnapshot(v8::StartupData *data) {
+        if (!snapshot) {
+            return data == nullptr;
+        }
+
+        return data
+               && snapshot->raw_size == data->raw_size
+               && memcmp(snapshot->data, data->data, static_cast<size_t>(data->raw_size)) == 0;
+    }
+
+    void IsolatePool::setSnapshot(v8::StartupData *data) {
+        // idle isolates were created from other snapshot, so they are not usable anymore
+        clear();
+
+        if (snapshot) {
+            if (in_use) {
+                // isolates that are still in use need their snapshot blob alive
+                retired.push_back(snapshot);
+            } else {
+                pefree((void *) snapshot->data, 1);
+                delete snapshot;
+            }
+
+            snapshot = nullptr;
+        }
+
+        if (data) {
+            char *blob = (char *) pemalloc(static_cast<size_t>(data->raw_size), 1);
+            memcpy(blob, data->data, static_cast<size_t>(data->raw_size));
+
+            snapshot = new v8::StartupData();
+            snapshot->data = blob;
+            snapshot->raw_size = data->raw_size;
+        }
+    }
+}
+
+bool php_v8_isolate_pool_recycle(php_v8_isolate_t *php_v8_isolate) {
+    if (!php_v8_isolate->pool || !php_v8_isolate->isolate) {
+        return false;
+    }
+
+    phpv8::IsolatePool::Entry entry = {php_v8_isolate->isolate, php_v8_isolate->create_params};
+
+    if (CG(unclean_shutdown)) {
+        // isolate may be left entered or in inconsistent state, so we let its owner destroy it
+        php_v8_isolate->pool->discard(entry);
+        return false;
+    }
+
+    if (php_v8_isolate->limits.memory_limit_in_progress) {
+        // memory limit check interrupt is still pending and there is no way to cancel it, so isolate is not reused
+        php_v8_isolate->pool->discard(entry);
+        return false;
+    }
+
+    if (php_v8_isolate->external_strings_count) {
+        {
+            // pooled isolates are shared between threads in ZTS builds, so isolate has to be locked the same way
+            // pool does it in IsolatePool::keep()
+            v8::Locker locker(php_v8_isolate->isolate);
+            v8::Isolate::Scope isolate_scope(php_v8_isolate->isolate);
+
+            // external strings are released only when js strings they back are collected
+            php_v8_isolate->isolate->LowMemoryNotification();
+        }
+
+        if (php_v8_isolate->external_strings_count) {
+            // external strings point to request memory, so isolate that still has them should die with the request
+            php_v8_isolate->pool->discard(entry);
+            return false;
+        }
+    }
+
+    // pool takes ownership over isolate and either keeps it idle or disposes it
+    php_v8_isolate->pool->recycle(entry);
+
+    php_v8_isolate->isolate = nullptr;
+    php_v8_isolate->create_params = nullptr;
+
+    return true;
+}
+
+void php_v8_isolate_pool_shutdown() {
+    phpv8::IsolatePools *pools = PHP_V8_G(isolate_pools);
+
+    if (!pools) {
+        return;
+    }
+
+    for (auto const &item : *pools) {
+        delete item.second;
+    }
+
+    delete pools;
+
+    PHP_V8_G(isolate_pools) = nullptr;
+}
+
+static phpv8::IsolatePool *php_v8_isolate_pool_get_or_create(zend_string *name) {
+    if (!PHP_V8_G(isolate_pools)) {
+        PHP_V8_G(isolate_pools) = new phpv8::IsolatePools();
+    }
+
+    phpv8::IsolatePools *pools = PHP_V8_G(isolate_pools);
+    std::string key(ZSTR_VAL(name), ZSTR_LEN(name));
+
+    auto it = pools->find(key);
+
+    if (it != pools->end()) {
+        return it->second;
+    }
+
+    phpv8::IsolatePool *pool = new phpv8::IsolatePool(key);
+    (*pools)[key] = pool;
+
+    return pool;
+}
+
+
+static void php_v8_isolate_pool_free(zend_object *object) {
+    php_v8_isolate_pool_t *php_v8_isolate_pool = php_v8_isolate_pool_fetch_object(object);
+
+    // pool itself is persistent and outlives this object
+    php_v8_isolate_pool->pool = nullptr;
+
+    zend_object_std_dtor(&php_v8_isolate_pool->std);
+}
+
+static zend_object *php_v8_isolate_pool_ctor(zend_class_entry *ce) {
+    php_v8_isolate_pool_t *php_v8_isolate_pool;
+
+    php_v8_isolate_pool = (php_v8_isolate_pool_t *) ecalloc(1, sizeof(php_v8_isolate_pool_t) + zend_object_properties_size(ce));
+
+    zend_object_std_init(&php_v8_isolate_pool->std, ce);
+    object_properties_init(&php_v8_isolate_pool->std, ce);
+
+    php_v8_init();
+
+    php_v8_isolate_pool->std.handlers = &php_v8_isolate_pool_object_handlers;
+
+    return &php_v8_isolate_pool->std;
+}
+
+
+static PHP_METHOD(IsolatePool, __construct) {
+    zend_string *name = NULL;
+    zval *snapshot_zv = NULL;
+    zend_long max_idle = PHP_V8_ISOLATE_POOL_DEFAULT_MAX_IDLE;
+    zend_long max_heap_size = 0;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "S|o!ll", &name, &snapshot_zv, &max_idle, &max_heap_size) == FAILURE) {
+        return;
+    }
+
+    if (max_idle < 0) {
+        PHP_V8_THROW_VALUE_EXCEPTION("Max idle isolates number should be a non-negative numeric value");
+        return;
+    }
+
+    if (max_heap_size < 0) {
+        PHP_V8_THROW_VALUE_EXCEPTION("Max heap size should be a non-negative numeric value");
+        return;
+    }
+
+    PHP_V8_ISOLATE_POOL_FETCH_INTO(getThis(), php_v8_isolate_pool);
+
+    phpv8::IsolatePool *pool = php_v8_isolate_pool_get_or_create(name);
+
+    pool->setMaxIdle(static_cast<size_t>(max_idle));
+    pool->max_heap_size = static_cast<size_t>(max_heap_size);
+
+    if (snapshot_zv != NULL) {
+        PHP_V8_STARTUP_DATA_FETCH_INTO(snapshot_zv, php_v8_startup_data);
+
+        if (php_v8_startup_data->blob && php_v8_startup_data->blob->hasData() && !php_v8_startup_data->blob->rejected()) {
+
+            script_compiler_tag runtime = php_v8_startup_data_get_current_tag();
+            script_compiler_tag version = php_v8_startup_data->blob->version();
+
+            if (runtime.magic == version.magic && runtime.tag == version.tag) {
+                if (!pool->hasSameSnapshot(php_v8_startup_data->blob->data())) {
+                    pool->setSnapshot(php_v8_startup_data->blob->data());
+                }
+            } else {
+                php_v8_startup_data->blob->reject();
+            }
+        }
+    }
+
+    php_v8_isolate_pool->pool = pool;
+}
+
+static PHP_METHOD(IsolatePool, getName) {
+    if (zend_parse_parameters_none() == FAILURE) {
+        return;
+    }
+
+    PHP_V8_ISOLATE_POOL_FETCH_WITH_CHECK(getThis(), php_v8_isolate_pool);
+
+    RETURN_STRINGL(php_v8_isolate_pool->pool->name.c_str(), php_v8_isolate_pool->pool->name.length());
+}
+
+static PHP_METHOD(IsolatePool, acquire) {
+    if (zend_parse_parameters_none() == FAILURE) {
+        return;
+    }
+
+    PHP_V8_ISOLATE_POOL_FETCH_WITH_CHECK(getThis(), php_v8_isolate_pool);
+
+    object_init_ex(return_value, php_v8_isolate_class_entry);
+    PHP_V8_ISOLATE_FETCH_INTO(return_value, php_v8_isolate);
+
+    phpv8::IsolatePool::Entry entry = php_v8_isolate_pool->pool->acquire();
+
+    // isolate comes with its own create params which have to live as long as isolate does
+    delete php_v8_isolate->create_params->array_buffer_allocator;
+    delete php_v8_isolate->create_params;
+
+    php_v8_isolate->create_params = entry.create_params;
+    php_v8_isolate->isolate = entry.isolate;
+    php_v8_isolate->pool = php_v8_isolate_pool->pool;
+
+    php_v8_isolate_setup(return_value, php_v8_isolate, 0);
+}
+
+static PHP_METHOD(IsolatePool, warmUp) {
+    zend_long count;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "l", &count) == FAILURE) {
+        return;
+    }
+
+    if (count < 0) {
+        PHP_V8_THROW_VALUE_EXCEPTION("Isolates count should be a non-negative numeric value");
+        return;
+    }
+
+    PHP_V8_ISOLATE_POOL_FETCH_WITH_CHECK(getThis(), php_v8_isolate_pool);
+
+    size_t warm = static_cast<size_t>(count);
+
+    if (warm > php_v8_isolate_pool->pool->maxIdle()) {
+        warm = php_v8_isolate_pool->pool->maxIdle();
+    }
+
+    php_v8_isolate_pool->pool->warmUp(warm);
+}
+
+static PHP_METHOD(IsolatePool, clear) {
+    if (zend_parse_parameters_none() == FAILURE) {
+        return;
+    }
+
+    PHP_V8_ISOLATE_POOL_FETCH_WITH_CHECK(getThis(), php_v8_isolate_pool);
+
+    php_v8_isolate_pool->pool->clear();
+}
+
+static PHP_METHOD(IsolatePool, getStats) {
+    if (zend_parse_parameters_none() == FAILURE) {
+        return;
+    }
+
+    PHP_V8_ISOLATE_POOL_FETCH_WITH_CHECK(getThis(), php_v8_isolate_pool);
+    phpv8::IsolatePool *pool = php_v8_isolate_pool->pool;
+
+    array_init_size(return_value, 7);
+
+    add_assoc_long(return_value, "hits", pool->hits);
+    add_assoc_long(return_value, "misses", pool->misses);
+    add_assoc_long(return_value, "creations", pool->creations);
+    add_assoc_long(return_value, "evictions", pool->evictions);
+    add_assoc_long(return_value, "discards", pool->discards);
+    add_assoc_long(return_value, "idle", static_cast<zend_long>(pool->idleCount()));
+    add_assoc_long(return_value, "in_use", static_cast<zend_long>(pool->inUseCount()));
+}
+
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_CONSTRUCTOR_INFO_EX(arginfo___construct, 1)
+                ZEND_ARG_TYPE_INFO(0, name, IS_STRING, 0)
+                ZEND_ARG_OBJ_INFO(0, snapshot, V8\\StartupData, 1)
+                ZEND_ARG_TYPE_INFO(0, max_idle, IS_LONG, 0)
+                ZEND_ARG_TYPE_INFO(0, max_heap_size, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_getName, ZEND_RETURN_VALUE, 0, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_acquire, ZEND_RETURN_VALUE, 0, V8\\Isolate, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_VOID_INFO_EX(arginfo_warmUp, 1)
+                ZEND_ARG_TYPE_INFO(0, count, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_VOID_INFO_EX(arginfo_clear, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_getStats, ZEND_RETURN_VALUE, 0, IS_ARRAY, 0)
+ZEND_END_ARG_INFO()
+
+
+static const zend_function_entry php_v8_isolate_pool_methods[] = {
+        PHP_V8_ME(IsolatePool, __construct, ZEND_ACC_PUBLIC | ZEND_ACC_CTOR)
+        PHP_V8_ME(IsolatePool, getName,     ZEND_ACC_PUBLIC)
+        PHP_V8_ME(IsolatePool, acquire,     ZEND_ACC_PUBLIC)
+        PHP_V8_ME(IsolatePool, warmUp,      ZEND_ACC_PUBLIC)
+        PHP_V8_ME(IsolatePool, clear,       ZEND_ACC_PUBLIC)
+        PHP_V8_ME(IsolatePool, getStats,    ZEND_ACC_PUBLIC)
+
+        PHP_FE_END
+};
+
+
+PHP_MINIT_FUNCTION (php_v8_isolate_pool) {
+    zend_class_entry ce;
+    INIT_NS_CLASS_ENTRY(ce, PHP_V8_NS, "IsolatePool", php_v8_isolate_pool_methods);
+    this_ce = zend_register_internal_class(&ce);
+    this_ce->create_object = php_v8_isolate_pool_ctor;
+
+    memcpy(&php_v8_isolate_pool_object_handlers, zend_get_std_object_handlers(), sizeof(zend_object_handlers));
+
+    php_v8_isolate_pool_object_handlers.offset    = XtOffsetOf(php_v8_isolate_pool_t, std);
+    php_v8_isolate_pool_object_handlers.free_obj  = php_v8_isolate_pool_free;
+    php_v8_isolate_pool_object_handlers.clone_obj = NULL;
+
+    return SUCCESS;
+}
@@ -0,0 +1,135 @@
+/*
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+#ifndef PHP_V8_ISOLATE_POOL_H
+#define PHP_V8_ISOLATE_POOL_H
+
+typedef struct _php_v8_isolate_pool_t php_v8_isolate_pool_t;
+
+namespace phpv8 {
+    class IsolatePool;
+}
+
+#include "php_v8_isolate.h"
+#include "php_v8_exceptions.h"
+#include "php_v8.h"
+#include <v8.h>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "php.h"
+
+#ifdef ZTS
+#include "TSRM.h"
+#endif
+}
+
+extern zend_class_entry *php_v8_isolate_pool_class_entry;
+
+inline php_v8_isolate_pool_t *php_v8_isolate_pool_fetch_object(zend_object *obj);
+
+extern bool php_v8_isolate_pool_recycle(php_v8_isolate_t *php_v8_isolate);
+extern void php_v8_isolate_pool_shutdown();
+
+#define PHP_V8_ISOLATE_POOL_FETCH(zv) php_v8_isolate_pool_fetch_object(Z_OBJ_P(zv))
+#define PHP_V8_ISOLATE_POOL_FETCH_INTO(pzval, into) php_v8_isolate_pool_t *(into) = PHP_V8_ISOLATE_POOL_FETCH((pzval))
+
+#define PHP_V8_EMPTY_ISOLATE_POOL_MSG "IsolatePool" PHP_V8_EMPTY_HANDLER_MSG_PART
+#define PHP_V8_CHECK_EMPTY_ISOLATE_POOL_HANDLER(val) if (NULL == (val)->pool) { PHP_V8_THROW_EXCEPTION(PHP_V8_EMPTY_ISOLATE_POOL_MSG); return; }
+
+#define PHP_V8_ISOLATE_POOL_FETCH_WITH_CHECK(pzval, into) \
+    PHP_V8_ISOLATE_POOL_FETCH_INTO(pzval, into); \
+    PHP_V8_CHECK_EMPTY_ISOLATE_POOL_HANDLER(into);
+
+#define PHP_V8_ISOLATE_POOL_DEFAULT_MAX_IDLE 4
+
+
+namespace phpv8 {
+
+    /**
+     * Isolates that outlive request which created them, so that next requests in the same worker may skip
+     * v8::Isolate::New() (and snapshot deserialization).
+     *
+     * Pool owns idle isolates together with their create params and persistent copy of snapshot blob they were
+     * created from. Isolate is handed back to pool when V8\Isolate object that uses it is destroyed, all per-object
+     * state (limits, external exceptions, weak values, etc.) lives in that object, so it is reset for free.
+     */
+    class IsolatePool {
+    public:
+        struct Entry {
+            v8::Isolate *isolate;
+            v8::Isolate::CreateParams *create_params;
+        };
+
+        IsolatePool(std::string name) : name(name) {}
+        ~IsolatePool();
+
+        Entry acquire();
+        void recycle(Entry entry);
+        void discard(Entry entry);
+        void warmUp(size_t count);
+        void clear();
+        void setMaxIdle(size_t max);
+
+        void setSnapshot(v8::StartupData *data);
+        bool hasSameSnapshot(v8::StartupData *data);
+
+        const std::string name;
+
+        size_t max_heap_size = 0;
+
+        zend_long hits = 0;
+        zend_long misses = 0;
+        zend_long creations = 0;
+        zend_long evictions = 0;
+        zend_long discards = 0;
+
+        inline size_t maxIdle() {
+            return max_idle;
+        }
+
+        inline size_t idleCount() {
+            return idle.size();
+        }
+
+        inline size_t inUseCount() {
+            return in_use;
+        }
+    private:
+        Entry create();
+        bool keep(Entry entry);
+        void release();
+        void dispose(Entry entry);
+
+        v8::StartupData *snapshot = nullptr;
+        std::vector<v8::StartupData *> retired;
+        std::vector<Entry> idle;
+        size_t max_idle = PHP_V8_ISOLATE_POOL_DEFAULT_MAX_IDLE;
+        size_t in_use = 0;
+    };
+}
+
+
+struct _php_v8_isolate_pool_t {
+    phpv8::IsolatePool *pool;
+
+    zend_object std;
+};
+
+inline php_v8_isolate_pool_t *php_v8_isolate_pool_fetch_object(zend_object *obj) {
+    return (php_v8_isolate_pool_t *) ((char *) obj - XtOffsetOf(php_v8_isolate_pool_t, std));
+}
+
+PHP_MINIT_FUNCTION(php_v8_isolate_pool);
+
+#endif //PHP_V8_ISOLATE_POOL_H
@@ -15,6 +15,7 @@
 #endif
 
 #include "php_v8_json.h"
+#include "php_v8_string.h"
 #include "php_v8_value.h"
 #include "php_v8_context.h"
 #include "php_v8.h"
@@ -87,11 +88,7 @@ static PHP_METHOD(JSON, stringify) {
     PHP_V8_MAYBE_CATCH(php_v8_context, try_catch);
     PHP_V8_THROW_EXCEPTION_WHEN_EMPTY(maybe_local_string, "Failed to stringify");
 
-    v8::String::Utf8Value str(isolate, maybe_local_string.ToLocalChecked());
-
-    PHP_V8_CONVERT_UTF8VALUE_TO_STRING_WITH_CHECK(str, cstr);
-
-    RETVAL_STRINGL(cstr, str.length());
+    RETVAL_STR(php_v8_string_to_zend_string(maybe_local_string.ToLocalChecked()));
 }
 
 
@@ -40,7 +40,7 @@ static PHP_METHOD(Map, __construct) {
 
     php_v8_object_store_self_ptr(php_v8_value, local_map);
 
-    php_v8_value->persistent->Reset(isolate, local_map);
+    php_v8_value->persistent.Reset(isolate, local_map);
 }
 
 static PHP_METHOD(Map, size) {
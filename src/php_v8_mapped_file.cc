@@ -0,0 +1,76 @@
+/*
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "php_v8_mapped_file.h"
+
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+
+namespace phpv8 {
+    MappedFile *MappedFile::open(const char *path) {
+        int fd = ::open(path, O_RDONLY);
+
+        if (fd < 0) {
+            return nullptr;
+        }
+
+        struct stat st = {};
+
+        if (fstat(fd, &st) != 0) {
+            int error = errno;
+            close(fd);
+            errno = error;
+            return nullptr;
+        }
+
+        if (!S_ISREG(st.st_mode)) {
+            close(fd);
+            errno = EINVAL;
+            return nullptr;
+        }
+
+        size_t size = static_cast<size_t>(st.st_size);
+
+        if (!size) {
+            // mmap() refuses zero-length mappings, while empty file is still a valid (though useless) one
+            close(fd);
+            return new MappedFile(nullptr, 0);
+        }
+
+        void *data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        int error = errno;
+
+        // mapping keeps file referenced on its own
+        close(fd);
+
+        if (data == MAP_FAILED) {
+            errno = error;
+            return nullptr;
+        }
+
+        return new MappedFile(static_cast<const char *>(data), size);
+    }
+
+    MappedFile::~MappedFile() {
+        if (_data) {
+            munmap(const_cast<char *>(_data), _size);
+        }
+    }
+}
@@ -0,0 +1,50 @@
+/*
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+#ifndef PHP_V8_MAPPED_FILE_H
+#define PHP_V8_MAPPED_FILE_H
+
+#include <cstddef>
+
+namespace phpv8 {
+
+    /**
+     * Read-only private memory mapping of the whole file.
+     *
+     * Pages are loaded lazily and shared between processes through the page cache, so handing mapped data to v8
+     * directly saves both reading file into request memory and copying it.
+     */
+    class MappedFile {
+    public:
+        /**
+         * Map file at given path. Returns nullptr and leaves errno set on failure.
+         */
+        static MappedFile *open(const char *path);
+
+        ~MappedFile();
+
+        inline const char *data() const {
+            return _data;
+        }
+
+        inline size_t size() const {
+            return _size;
+        }
+    private:
+        MappedFile(const char *data, size_t size) : _data(data), _size(size) {}
+
+        const char *_data;
+        size_t _size;
+    };
+}
+
+#endif //PHP_V8_MAPPED_FILE_H
@@ -31,7 +31,7 @@ static PHP_METHOD(NullValue, __construct) {
 
     PHP_V8_VALUE_CONSTRUCT(getThis(), php_v8_isolate_zv, php_v8_isolate, php_v8_value);
 
-    php_v8_value->persistent->Reset(isolate, v8::Null(isolate));
+    php_v8_value->persistent.Reset(isolate, v8::Null(isolate));
 }
 
 static PHP_METHOD(NullValue, value) {
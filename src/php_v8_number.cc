@@ -38,7 +38,7 @@ static PHP_METHOD(Number, __construct) {
 
     PHP_V8_THROW_VALUE_EXCEPTION_WHEN_EMPTY(number_tpl, "Failed to create Number value");
 
-    php_v8_value->persistent->Reset(isolate, number_tpl);
+    php_v8_value->persistent.Reset(isolate, number_tpl);
 }
 
 
@@ -42,7 +42,7 @@ static PHP_METHOD(NumberObject, __construct) {
 
     php_v8_object_store_self_ptr(php_v8_value, local_number_obj);
 
-    php_v8_value->persistent->Reset(isolate, local_number_obj);
+    php_v8_value->persistent.Reset(isolate, local_number_obj);
 }
 
 static PHP_METHOD(NumberObject, valueOf) {
@@ -22,6 +22,7 @@
 #include "php_v8_uint32.h"
 #include "php_v8_name.h"
 #include "php_v8_value.h"
+#include "php_v8_value_converter.h"
 #include "php_v8_context.h"
 #include "php_v8_ext_mem_interface.h"
 #include "php_v8_enums.h"
@@ -33,67 +34,77 @@ zend_class_entry *php_v8_object_class_entry;
 
 
 
-bool php_v8_object_delete_self_ptr(php_v8_value_t *php_v8_value, v8::Local<v8::Object> local_object) {
-    PHP_V8_ENTER_STORED_ISOLATE(php_v8_value);
-    PHP_V8_CONTEXT_ENTER(local_object->CreationContext());
-
-    v8::Local<v8::Private> key = php_v8_isolate_get_key_local(php_v8_value->php_v8_isolate);
-    assert(!key.IsEmpty());
-
-    v8::Maybe<bool> maybe_res = local_object->DeletePrivate(local_object->CreationContext(), key);
+void php_v8_object_delete_self_ptr(php_v8_value_t *php_v8_value) {
+    assert(php_v8_value->identity_hash);
 
-    // TODO: in obj free handle we may want not to throw any exceptions
-    if (maybe_res.IsNothing()) {
-        PHP_V8_THROW_EXCEPTION("Internal error: Failed to delete hidden persistent");
-        return false;
+    if (php_v8_value->php_v8_isolate->object_wrappers) {
+        php_v8_value->php_v8_isolate->object_wrappers->remove(php_v8_value->identity_hash, php_v8_value);
     }
 
-    assert(maybe_res.FromJust());
-    return maybe_res.FromMaybe(false);
+    php_v8_value->identity_hash = 0;
 }
 
 bool php_v8_object_store_self_ptr(php_v8_value_t *php_v8_value, v8::Local<v8::Object> local_object)
 {
     assert(NULL != v8::Isolate::GetCurrent());
-    assert(v8::Isolate::GetCurrent()->InContext());
 
-    v8::Local<v8::Private> key = php_v8_isolate_get_key_local(php_v8_value->php_v8_isolate);
-    assert(!key.IsEmpty());
+    php_v8_value->identity_hash = local_object->GetIdentityHash();
+    php_v8_value->php_v8_isolate->object_wrappers->add(php_v8_value->identity_hash, php_v8_value);
+
+    return true;
+}
+
+php_v8_value_t * php_v8_object_get_self_ptr(php_v8_isolate_t *php_v8_isolate, v8::Local<v8::Object> local_object)
+{
+    assert(NULL != v8::Isolate::GetCurrent());
+
+    return php_v8_isolate->object_wrappers->find(local_object->GetIdentityHash(), local_object);
+}
 
-    v8::Local<v8::External> this_embedded = v8::External::New(php_v8_value->php_v8_isolate->isolate, php_v8_value);
 
-    v8::Maybe<bool> maybe_res = local_object->SetPrivate(local_object->CreationContext(), key, this_embedded);
+static v8::MaybeLocal<v8::Value> php_v8_object_php_key_to_local(v8::Isolate *isolate, zend_string *key, zend_ulong index) {
+    if (!key) {
+        char buf[MAX_LENGTH_OF_LONG + 1];
+        char *res = zend_print_long_to_buf(buf + sizeof(buf) - 1, static_cast<zend_long>(index));
 
-    if (maybe_res.IsNothing()) {
-        PHP_V8_THROW_EXCEPTION("Internal error: Failed to delete hidden persistent");
-        return false;
+        return v8::String::NewFromUtf8(isolate, res, v8::NewStringType::kInternalized, static_cast<int>(buf + sizeof(buf) - 1 - res));
     }
 
-    assert(maybe_res.FromJust());
+    if (ZSTR_LEN(key) > v8::String::kMaxLength) {
+        return v8::MaybeLocal<v8::Value>();
+    }
 
-    return maybe_res.FromMaybe(false);
+    return v8::String::NewFromUtf8(isolate, ZSTR_VAL(key), v8::NewStringType::kInternalized, static_cast<int>(ZSTR_LEN(key)));
 }
 
-php_v8_value_t * php_v8_object_get_self_ptr(php_v8_isolate_t *php_v8_isolate, v8::Local<v8::Object> local_object)
-{
-    assert(NULL != v8::Isolate::GetCurrent());
-    assert(v8::Isolate::GetCurrent()->InContext());
+static v8::Maybe<bool> php_v8_object_set_by_php_key(v8::Isolate *isolate, v8::Local<v8::Context> context, v8::Local<v8::Object> local_obj,
+                                                    zend_string *key, zend_ulong index, v8::Local<v8::Value> local_value) {
+    if (!key && index < UINT32_MAX) {
+        return local_obj->Set(context, static_cast<uint32_t>(index), local_value);
+    }
+
+    v8::Local<v8::Value> local_key;
 
-    v8::Local<v8::Private> key = php_v8_isolate_get_key_local(php_v8_isolate);
-    assert(!key.IsEmpty());
+    if (!php_v8_object_php_key_to_local(isolate, key, index).ToLocal(&local_key)) {
+        return v8::Nothing<bool>();
+    }
 
-    v8::MaybeLocal<v8::Value> maybe_local_value = local_object->GetPrivate(local_object->CreationContext(), key);
+    return local_obj->Set(context, local_key, local_value);
+}
 
-    if (maybe_local_value.IsEmpty()) {
-        return NULL;
+static v8::MaybeLocal<v8::Value> php_v8_object_get_by_php_key(v8::Isolate *isolate, v8::Local<v8::Context> context, v8::Local<v8::Object> local_obj,
+                                                              zend_string *key, zend_ulong index) {
+    if (!key && index < UINT32_MAX) {
+        return local_obj->Get(context, static_cast<uint32_t>(index));
     }
 
-    v8::Local<v8::Value> local_value = maybe_local_value.ToLocalChecked();
+    v8::Local<v8::Value> local_key;
 
-    // for some reason this check fails, but value IS external
-    //assert(local_value->IsExternal());
+    if (!php_v8_object_php_key_to_local(isolate, key, index).ToLocal(&local_key)) {
+        return v8::MaybeLocal<v8::Value>();
+    }
 
-    return static_cast<php_v8_value_t *>(local_value.As<v8::External>()->Value());
+    return local_obj->Get(context, local_key);
 }
 
 
@@ -113,7 +124,7 @@ static PHP_METHOD(Object, __construct) {
 
     php_v8_object_store_self_ptr(php_v8_value, local_object);
 
-    php_v8_value->persistent->Reset(isolate, local_object);
+    php_v8_value->persistent.Reset(isolate, local_object);
 }
 
 static PHP_METHOD(Object, getContext) {
@@ -164,6 +175,69 @@ static PHP_METHOD(Object, set) {
     RETURN_BOOL(maybe_res.FromJust());
 }
 
+static PHP_METHOD(Object, setMany) {
+    zval *php_v8_context_zv;
+    HashTable *properties;
+
+    zend_string *key;
+    zend_ulong index;
+    zval *value_zv;
+
+    bool all_set = true;
+    bool failed = false;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "oh", &php_v8_context_zv, &properties) == FAILURE) {
+        return;
+    }
+
+    PHP_V8_VALUE_FETCH_WITH_CHECK(getThis(), php_v8_value);
+    PHP_V8_CONTEXT_FETCH_WITH_CHECK(php_v8_context_zv, php_v8_context);
+
+    PHP_V8_DATA_ISOLATES_CHECK(php_v8_value, php_v8_context);
+
+    PHP_V8_ENTER_STORED_ISOLATE(php_v8_context);
+    PHP_V8_ENTER_CONTEXT(php_v8_context);
+
+    v8::Local<v8::Object> local_obj = php_v8_value_get_local_as<v8::Object>(php_v8_value);
+
+    phpv8::ValueConverter converter(php_v8_context->php_v8_isolate, context, PHP_V8_VALUE_CONVERTER_DEFAULT_MAX_DEPTH);
+
+    PHP_V8_TRY_CATCH(isolate);
+    PHP_V8_INIT_ISOLATE_LIMITS_ON_OBJECT_VALUE(php_v8_value);
+
+    ZEND_HASH_FOREACH_KEY_VAL_IND(properties, index, key, value_zv) {
+        v8::HandleScope handle_scope(isolate);
+        v8::Local<v8::Value> local_value;
+
+        if (!converter.fromPhp(value_zv).ToLocal(&local_value)) {
+            failed = true;
+            break;
+        }
+
+        v8::Maybe<bool> maybe_res = php_v8_object_set_by_php_key(isolate, context, local_obj, key, index, local_value);
+
+        // php accessor or interceptor may throw without making js set fail, so stop before calling more of them
+        if (maybe_res.IsNothing() || EG(exception)) {
+            failed = true;
+            break;
+        }
+
+        all_set = all_set && maybe_res.FromJust();
+    } ZEND_HASH_FOREACH_END();
+
+    PHP_V8_MAYBE_CATCH(php_v8_context, try_catch);
+
+    if (failed) {
+        if (!EG(exception)) {
+            PHP_V8_THROW_EXCEPTION("Failed to set");
+        }
+
+        return;
+    }
+
+    RETURN_BOOL(all_set);
+}
+
 static PHP_METHOD(Object, createDataProperty) {
     zval *php_v8_context_zv;
     zval *php_v8_key_or_index_zv;
@@ -277,7 +351,84 @@ static PHP_METHOD(Object, get) {
 
     v8::Local<v8::Value> local_value =  maybe_local.ToLocalChecked();
 
-    php_v8_get_or_create_value(return_value, local_value, php_v8_value->php_v8_isolate);
+    php_v8_get_or_unwrap_value(return_value, local_value, php_v8_context);
+}
+
+static PHP_METHOD(Object, getMany) {
+    zval *php_v8_context_zv;
+    HashTable *keys;
+    zend_bool scalars = 0;
+
+    zval *key_zv;
+
+    bool failed = false;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "oh|b", &php_v8_context_zv, &keys, &scalars) == FAILURE) {
+        return;
+    }
+
+    PHP_V8_VALUE_FETCH_WITH_CHECK(getThis(), php_v8_value);
+    PHP_V8_CONTEXT_FETCH_WITH_CHECK(php_v8_context_zv, php_v8_context);
+
+    PHP_V8_DATA_ISOLATES_CHECK(php_v8_value, php_v8_context);
+
+    PHP_V8_ENTER_STORED_ISOLATE(php_v8_context);
+    PHP_V8_ENTER_CONTEXT(php_v8_context);
+
+    v8::Local<v8::Object> local_obj = php_v8_value_get_local_as<v8::Object>(php_v8_value);
+
+    array_init_size(return_value, zend_hash_num_elements(keys));
+
+    PHP_V8_TRY_CATCH(isolate);
+    PHP_V8_INIT_ISOLATE_LIMITS_ON_OBJECT_VALUE(php_v8_value);
+
+    ZEND_HASH_FOREACH_VAL_IND(keys, key_zv) {
+        v8::HandleScope handle_scope(isolate);
+        v8::Local<v8::Value> local_value;
+
+        zend_string *key = NULL;
+        zend_ulong index = 0;
+        zval value_zv;
+
+        ZVAL_DEREF(key_zv);
+
+        if (Z_TYPE_P(key_zv) == IS_STRING) {
+            key = Z_STR_P(key_zv);
+
+            // numeric string keys are integer keys in php arrays, so are they in js
+            if (ZEND_HANDLE_NUMERIC_STR(ZSTR_VAL(key), ZSTR_LEN(key), index)) {
+                key = NULL;
+            }
+        } else if (Z_TYPE_P(key_zv) == IS_LONG) {
+            index = static_cast<zend_ulong>(Z_LVAL_P(key_zv));
+        } else {
+            zend_throw_exception_ex(php_v8_value_exception_class_entry, 0, "Property key should be either string or integer, %s given", zend_zval_type_name(key_zv));
+            failed = true;
+            break;
+        }
+
+        // same as for setting, php callback may leave exception pending while js get still succeeds
+        if (!php_v8_object_get_by_php_key(isolate, context, local_obj, key, index).ToLocal(&local_value) || EG(exception)) {
+            failed = true;
+            break;
+        }
+
+        if (!scalars || !phpv8::ValueConverter::toPhpScalar(local_value, &value_zv)) {
+            php_v8_get_or_create_value(&value_zv, local_value, php_v8_value->php_v8_isolate);
+        }
+
+        if (key) {
+            zend_hash_update(Z_ARRVAL_P(return_value), key, &value_zv);
+        } else {
+            zend_hash_index_update(Z_ARRVAL_P(return_value), index, &value_zv);
+        }
+    } ZEND_HASH_FOREACH_END();
+
+    PHP_V8_MAYBE_CATCH(php_v8_context, try_catch);
+
+    if (failed && !EG(exception)) {
+        PHP_V8_THROW_EXCEPTION("Failed to get");
+    }
 }
 
 static PHP_METHOD(Object, getPropertyAttributes) {
@@ -458,7 +609,7 @@ static PHP_METHOD(Object, setAccessor) {
     v8::Local<v8::External> data;
 
 
-    phpv8::CallbacksBucket *bucket = php_v8_value->persistent_data->bucket("accessor_", local_name->IsSymbol(), name);
+    phpv8::CallbacksBucket *bucket = php_v8_value_get_persistent_data(php_v8_value)->bucket("accessor_", local_name->IsSymbol(), name);
     data = v8::External::New(isolate, bucket);
 
     bucket->add(phpv8::CallbacksBucket::Index::Getter, getter_fci, getter_fci_cache);
@@ -571,7 +722,7 @@ static PHP_METHOD(Object, setNativeDataProperty) {
     v8::AccessorNameSetterCallback setter = 0;
     v8::Local<v8::External> data;
 
-    phpv8::CallbacksBucket *bucket = php_v8_value->persistent_data->bucket("native_data_property_", local_name->IsSymbol(), name);
+    phpv8::CallbacksBucket *bucket = php_v8_value_get_persistent_data(php_v8_value)->bucket("native_data_property_", local_name->IsSymbol(), name);
     data = v8::External::New(isolate, bucket);
 
     bucket->add(phpv8::CallbacksBucket::Index::Getter, getter_fci, getter_fci_cache);
@@ -633,7 +784,7 @@ static PHP_METHOD(Object, setLazyDataProperty) {
     v8::AccessorNameGetterCallback getter;
     v8::Local<v8::External> data;
 
-    phpv8::CallbacksBucket *bucket = php_v8_value->persistent_data->bucket("lazy_data_property_", local_name->IsSymbol(), name);
+    phpv8::CallbacksBucket *bucket = php_v8_value_get_persistent_data(php_v8_value)->bucket("lazy_data_property_", local_name->IsSymbol(), name);
     data = v8::External::New(isolate, bucket);
 
     bucket->add(phpv8::CallbacksBucket::Index::Getter, getter_fci, getter_fci_cache);
@@ -1244,8 +1395,7 @@ static PHP_METHOD(Object, callAsFunction) {
     zval *php_v8_recv_zv;
     zval* arguments_zv = NULL;
 
-    int argc = 0;
-    v8::Local<v8::Value> *argv = NULL;
+    phpv8::CallArguments<v8::Value> arguments;
 
     if (zend_parse_parameters(ZEND_NUM_ARGS(), "oo|a", &php_v8_context_zv, &php_v8_recv_zv, &arguments_zv) == FAILURE) {
         return;
@@ -1262,7 +1412,7 @@ static PHP_METHOD(Object, callAsFunction) {
     PHP_V8_ENTER_STORED_ISOLATE(php_v8_context);
     PHP_V8_ENTER_CONTEXT(php_v8_context);
 
-    if (!php_v8_function_unpack_args(arguments_zv, 3, isolate, &argc, &argv)) {
+    if (!php_v8_function_unpack_args(arguments_zv, 3, isolate, arguments)) {
         return;
     }
 
@@ -1272,11 +1422,7 @@ static PHP_METHOD(Object, callAsFunction) {
     PHP_V8_TRY_CATCH(isolate);
     PHP_V8_INIT_ISOLATE_LIMITS_ON_CONTEXT(php_v8_context);
 
-    v8::MaybeLocal<v8::Value> maybe_local_res = local_object->CallAsFunction(context, local_recv, argc, argv);
-
-    if (argv) {
-        efree(argv);
-    }
+    v8::MaybeLocal<v8::Value> maybe_local_res = local_object->CallAsFunction(context, local_recv, arguments.argc(), arguments.argv());
 
     PHP_V8_MAYBE_CATCH(php_v8_context, try_catch);
     PHP_V8_THROW_VALUE_EXCEPTION_WHEN_EMPTY(maybe_local_res, "Failed to call");
@@ -1290,8 +1436,7 @@ static PHP_METHOD(Object, callAsConstructor) {
     zval *php_v8_context_zv;
     zval* arguments_zv = NULL;
 
-    int argc = 0;
-    v8::Local<v8::Value> *argv = NULL;
+    phpv8::CallArguments<v8::Value> arguments;
 
     if (zend_parse_parameters(ZEND_NUM_ARGS(), "o|a", &php_v8_context_zv, &arguments_zv) == FAILURE) {
         return;
@@ -1305,7 +1450,7 @@ static PHP_METHOD(Object, callAsConstructor) {
     PHP_V8_ENTER_STORED_ISOLATE(php_v8_context);
     PHP_V8_ENTER_CONTEXT(php_v8_context);
 
-    if (!php_v8_function_unpack_args(arguments_zv, 2, isolate, &argc, &argv)) {
+    if (!php_v8_function_unpack_args(arguments_zv, 2, isolate, arguments)) {
         return;
     }
 
@@ -1314,11 +1459,7 @@ static PHP_METHOD(Object, callAsConstructor) {
     PHP_V8_TRY_CATCH(isolate);
     PHP_V8_INIT_ISOLATE_LIMITS_ON_CONTEXT(php_v8_context);
 
-    v8::MaybeLocal<v8::Value> maybe_local_res = local_object->CallAsConstructor(context, argc, argv);
-
-    if (argv) {
-        efree(argv);
-    }
+    v8::MaybeLocal<v8::Value> maybe_local_res = local_object->CallAsConstructor(context, arguments.argc(), arguments.argv());
 
     PHP_V8_MAYBE_CATCH(php_v8_context, try_catch);
     PHP_V8_THROW_VALUE_EXCEPTION_WHEN_EMPTY(maybe_local_res,  "Failed to call");
@@ -1352,6 +1493,11 @@ PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_VOID_INFO_EX(arginfo_set, 3)
                 ZEND_ARG_OBJ_INFO(0, value, V8\\Value, 0)
 ZEND_END_ARG_INFO()
 
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_setMany, ZEND_RETURN_VALUE, 2, _IS_BOOL, 0)
+                ZEND_ARG_OBJ_INFO(0, context, V8\\Context, 0)
+                ZEND_ARG_TYPE_INFO(0, properties, IS_ARRAY, 0)
+ZEND_END_ARG_INFO()
+
 PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_createDataProperty, ZEND_RETURN_VALUE, 3, _IS_BOOL, 0)
                 ZEND_ARG_OBJ_INFO(0, context, V8\\Context, 0)
                 ZEND_ARG_OBJ_INFO(0, key, V8\\NameValue, 0)
@@ -1365,11 +1511,17 @@ PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_defineOwnProperty, ZEND_R
                 ZEND_ARG_INFO(0, attributes)
 ZEND_END_ARG_INFO()
 
-PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_get, ZEND_RETURN_VALUE, 2, V8\\Value, 0)
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_MIXED_INFO_EX(arginfo_get, 2)
                 ZEND_ARG_OBJ_INFO(0, context, V8\\Context, 0)
                 ZEND_ARG_OBJ_INFO(0, key, V8\\Value, 0)
 ZEND_END_ARG_INFO()
 
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_getMany, ZEND_RETURN_VALUE, 2, IS_ARRAY, 0)
+                ZEND_ARG_OBJ_INFO(0, context, V8\\Context, 0)
+                ZEND_ARG_TYPE_INFO(0, keys, IS_ARRAY, 0)
+                ZEND_ARG_TYPE_INFO(0, scalars, _IS_BOOL, 0)
+ZEND_END_ARG_INFO()
+
 PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_getPropertyAttributes, ZEND_RETURN_VALUE, 2, IS_LONG, 0)
                 ZEND_ARG_OBJ_INFO(0, context, V8\\Context, 0)
                 ZEND_ARG_OBJ_INFO(0, key, V8\\StringValue, 0)
@@ -1546,9 +1698,11 @@ static const zend_function_entry php_v8_object_methods[] = {
         PHP_V8_ME(Object, __construct,                  ZEND_ACC_PUBLIC | ZEND_ACC_CTOR)
         PHP_V8_ME(Object, getContext,                   ZEND_ACC_PUBLIC)
         PHP_V8_ME(Object, set,                          ZEND_ACC_PUBLIC)
+        PHP_V8_ME(Object, setMany,                      ZEND_ACC_PUBLIC)
         PHP_V8_ME(Object, createDataProperty,           ZEND_ACC_PUBLIC)
         PHP_V8_ME(Object, defineOwnProperty,            ZEND_ACC_PUBLIC)
         PHP_V8_ME(Object, get,                          ZEND_ACC_PUBLIC)
+        PHP_V8_ME(Object, getMany,                      ZEND_ACC_PUBLIC)
         PHP_V8_ME(Object, getPropertyAttributes,        ZEND_ACC_PUBLIC)
         PHP_V8_ME(Object, getOwnPropertyDescriptor,     ZEND_ACC_PUBLIC)
         PHP_V8_ME(Object, has,                          ZEND_ACC_PUBLIC)
@@ -28,7 +28,7 @@ extern "C" {
 extern zend_class_entry* php_v8_object_class_entry;
 
 
-extern bool php_v8_object_delete_self_ptr(php_v8_value_t *php_v8_value, v8::Local<v8::Object> local_object);
+extern void php_v8_object_delete_self_ptr(php_v8_value_t *php_v8_value);
 extern bool php_v8_object_store_self_ptr(php_v8_value_t *php_v8_value, v8::Local<v8::Object> local_object);
 extern php_v8_value_t * php_v8_object_get_self_ptr(php_v8_isolate_t *php_v8_isolate, v8::Local<v8::Object> local_object);
 
@@ -181,6 +181,19 @@ static PHP_METHOD(ObjectTemplate, setLazyDataProperty) {
     php_v8_object_template_SetLazyDataProperty(INTERNAL_FUNCTION_PARAM_PASSTHRU);
 }
 
+/* Non-standard, binds property to php value which is read and written natively, without calling php functions */
+static PHP_METHOD(ObjectTemplate, bindConstant) {
+    php_v8_object_template_Bind(phpv8::Binding::Kind::Constant, INTERNAL_FUNCTION_PARAM_PASSTHRU);
+}
+
+static PHP_METHOD(ObjectTemplate, bindProperty) {
+    php_v8_object_template_Bind(phpv8::Binding::Kind::Property, INTERNAL_FUNCTION_PARAM_PASSTHRU);
+}
+
+static PHP_METHOD(ObjectTemplate, bindArrayOffset) {
+    php_v8_object_template_Bind(phpv8::Binding::Kind::ArrayOffset, INTERNAL_FUNCTION_PARAM_PASSTHRU);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
@@ -216,6 +229,7 @@ static PHP_METHOD(ObjectTemplate, setAccessor) {
 
     zend_long attributes = 0;
     zend_long settings = 0;
+    zend_long flags = PHP_V8_CALLBACK_FLAGS_NONE;
     v8::Local<v8::AccessorSignature> signature;
 
     zend_fcall_info getter_fci = empty_fcall_info;
@@ -224,13 +238,14 @@ static PHP_METHOD(ObjectTemplate, setAccessor) {
     zend_fcall_info setter_fci = empty_fcall_info;
     zend_fcall_info_cache setter_fci_cache = empty_fcall_info_cache;
 
-    if (zend_parse_parameters(ZEND_NUM_ARGS(), "of|f!llo!",
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "of|f!llo!l",
                               &php_v8_name_zv,
                               &getter_fci, &getter_fci_cache,
                               &setter_fci, &setter_fci_cache,
                               &settings,
                               &attributes,
-                              &php_v8_receiver_zv
+                              &php_v8_receiver_zv,
+                              &flags
     ) == FAILURE) {
         return;
     }
@@ -246,6 +261,7 @@ static PHP_METHOD(ObjectTemplate, setAccessor) {
 
     attributes = attributes ? attributes & PHP_V8_PROPERTY_ATTRIBUTE_FLAGS : attributes;
     settings = settings ? settings & PHP_V8_ACCESS_CONTROL_FLAGS : settings;
+    flags = flags ? flags & PHP_V8_CALLBACK_FLAGS : flags;
 
     v8::Local<v8::Name> local_name = php_v8_value_get_local_as<v8::Name>(php_v8_name);
 
@@ -260,7 +276,7 @@ static PHP_METHOD(ObjectTemplate, setAccessor) {
     data = v8::External::New(isolate, bucket);
 
     bucket->add(phpv8::CallbacksBucket::Index::Getter, getter_fci, getter_fci_cache);
-    getter = php_v8_callback_accessor_name_getter;
+    getter = flags & PHP_V8_CALLBACK_FLAGS_DIRECT_RETURN ? php_v8_callback_accessor_name_getter_direct : php_v8_callback_accessor_name_getter;
 
     if (setter_fci.size) {
         bucket->add(phpv8::CallbacksBucket::Index::Setter, setter_fci, setter_fci_cache);
@@ -402,6 +418,39 @@ static PHP_METHOD(ObjectTemplate, setImmutableProto) {
     local_obj_tpl->SetImmutableProto();
 }
 
+static PHP_METHOD(ObjectTemplate, internalFieldCount) {
+    if (zend_parse_parameters_none() == FAILURE) {
+        return;
+    }
+
+    PHP_V8_FETCH_OBJECT_TEMPLATE_WITH_CHECK(getThis(), php_v8_object_template);
+    PHP_V8_ENTER_STORED_ISOLATE(php_v8_object_template);
+
+    v8::Local<v8::ObjectTemplate> local_obj_tpl = php_v8_object_template_get_local(php_v8_object_template);
+
+    RETURN_LONG(static_cast<zend_long>(local_obj_tpl->InternalFieldCount()));
+}
+
+static PHP_METHOD(ObjectTemplate, setInternalFieldCount) {
+    zend_long value;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "l", &value) == FAILURE) {
+        return;
+    }
+
+    PHP_V8_FETCH_OBJECT_TEMPLATE_WITH_CHECK(getThis(), php_v8_object_template);
+    PHP_V8_ENTER_STORED_ISOLATE(php_v8_object_template);
+
+    if (value < 0 || value > INT_MAX) {
+        PHP_V8_THROW_VALUE_EXCEPTION("Internal field count is out of range");
+        return;
+    }
+
+    v8::Local<v8::ObjectTemplate> local_obj_tpl = php_v8_object_template_get_local(php_v8_object_template);
+
+    local_obj_tpl->SetInternalFieldCount(static_cast<int>(value));
+}
+
 
 /* Non-standard, implementations of AdjustableExternalMemoryInterface::AdjustExternalAllocatedMemory */
 static PHP_METHOD(ObjectTemplate, adjustExternalAllocatedMemory) {
@@ -453,6 +502,26 @@ PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_VOID_INFO_EX(arginfo_setLazyDataProperty, 2)
                 ZEND_ARG_TYPE_INFO(0, attributes, IS_LONG, 0)
 ZEND_END_ARG_INFO()
 
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_VOID_INFO_EX(arginfo_bindConstant, 2)
+                ZEND_ARG_OBJ_INFO(0, name, V8\\NameValue, 0)
+                ZEND_ARG_INFO(0, value)
+                ZEND_ARG_TYPE_INFO(0, attributes, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_VOID_INFO_EX(arginfo_bindProperty, 2)
+                ZEND_ARG_OBJ_INFO(0, name, V8\\NameValue, 0)
+                ZEND_ARG_TYPE_INFO(0, object, IS_OBJECT, 0)
+                ZEND_ARG_TYPE_INFO(0, property, IS_STRING, 1)
+                ZEND_ARG_TYPE_INFO(0, attributes, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_VOID_INFO_EX(arginfo_bindArrayOffset, 2)
+                ZEND_ARG_OBJ_INFO(0, name, V8\\NameValue, 0)
+                ZEND_ARG_ARRAY_INFO(1, array, 0)
+                ZEND_ARG_INFO(0, offset)
+                ZEND_ARG_TYPE_INFO(0, attributes, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_newInstance, ZEND_RETURN_VALUE, 1, V8\\ObjectValue, 0)
@@ -466,6 +535,7 @@ PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_VOID_INFO_EX(arginfo_setAccessor, 2)
                 ZEND_ARG_TYPE_INFO(0, settings, IS_LONG, 0)
                 ZEND_ARG_TYPE_INFO(0, attributes, IS_LONG, 0)
                 ZEND_ARG_OBJ_INFO(0, receiver, V8\\FunctionTemplate, 1)
+                ZEND_ARG_TYPE_INFO(0, flags, IS_LONG, 0)
 ZEND_END_ARG_INFO()
 
 PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_VOID_INFO_EX(arginfo_setHandlerForNamedProperty, 1)
@@ -486,6 +556,13 @@ ZEND_END_ARG_INFO()
 PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_VOID_INFO_EX(arginfo_setImmutableProto, 0)
 ZEND_END_ARG_INFO()
 
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_internalFieldCount, ZEND_RETURN_VALUE, 0, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_VOID_INFO_EX(arginfo_setInternalFieldCount, 1)
+                ZEND_ARG_TYPE_INFO(0, value, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
 PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_adjustExternalAllocatedMemory, ZEND_RETURN_VALUE, 1, IS_LONG, 0)
                 ZEND_ARG_TYPE_INFO(0, change_in_bytes, IS_LONG, 0)
 ZEND_END_ARG_INFO()
@@ -502,6 +579,9 @@ static const zend_function_entry php_v8_object_template_methods[] = {
         PHP_V8_ME(ObjectTemplate, setAccessorProperty,           ZEND_ACC_PUBLIC)
         PHP_V8_ME(ObjectTemplate, setNativeDataProperty,         ZEND_ACC_PUBLIC)
         PHP_V8_ME(ObjectTemplate, setLazyDataProperty,           ZEND_ACC_PUBLIC)
+        PHP_V8_ME(ObjectTemplate, bindConstant,                  ZEND_ACC_PUBLIC)
+        PHP_V8_ME(ObjectTemplate, bindProperty,                  ZEND_ACC_PUBLIC)
+        PHP_V8_ME(ObjectTemplate, bindArrayOffset,               ZEND_ACC_PUBLIC)
         PHP_V8_ME(ObjectTemplate, newInstance,                   ZEND_ACC_PUBLIC)
         PHP_V8_ME(ObjectTemplate, setAccessor,                   ZEND_ACC_PUBLIC)
         PHP_V8_ME(ObjectTemplate, setHandlerForNamedProperty,    ZEND_ACC_PUBLIC)
@@ -509,6 +589,8 @@ static const zend_function_entry php_v8_object_template_methods[] = {
         PHP_V8_ME(ObjectTemplate, setCallAsFunctionHandler,      ZEND_ACC_PUBLIC)
         PHP_V8_ME(ObjectTemplate, isImmutableProto,              ZEND_ACC_PUBLIC)
         PHP_V8_ME(ObjectTemplate, setImmutableProto,             ZEND_ACC_PUBLIC)
+        PHP_V8_ME(ObjectTemplate, internalFieldCount,            ZEND_ACC_PUBLIC)
+        PHP_V8_ME(ObjectTemplate, setInternalFieldCount,         ZEND_ACC_PUBLIC)
         PHP_V8_ME(ObjectTemplate, adjustExternalAllocatedMemory, ZEND_ACC_PUBLIC)
         PHP_V8_ME(ObjectTemplate, getExternalAllocatedMemory,    ZEND_ACC_PUBLIC)
 
@@ -0,0 +1,305 @@
+/*
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "php_v8_prepared_call.h"
+#include "php_v8_function.h"
+#include "php_v8_value.h"
+#include "php_v8.h"
+
+zend_class_entry* php_v8_prepared_call_class_entry;
+#define this_ce php_v8_prepared_call_class_entry
+
+static zend_object_handlers php_v8_prepared_call_object_handlers;
+
+
+static void php_v8_prepared_call_free(zend_object *object)
+{
+    php_v8_prepared_call_t *php_v8_prepared_call = php_v8_prepared_call_fetch_object(object);
+
+    if (PHP_V8_IS_UP_AND_RUNNING() && PHP_V8_ISOLATE_HAS_VALID_HANDLE(php_v8_prepared_call)) {
+        php_v8_prepared_call->function.Reset();
+        php_v8_prepared_call->receiver.Reset();
+    }
+
+    zend_object_std_dtor(&php_v8_prepared_call->std);
+}
+
+static zend_object * php_v8_prepared_call_ctor(zend_class_entry *ce)
+{
+    php_v8_prepared_call_t *php_v8_prepared_call;
+
+    php_v8_prepared_call = (php_v8_prepared_call_t *) ecalloc(1, sizeof(php_v8_prepared_call_t) + zend_object_properties_size(ce));
+
+    zend_object_std_init(&php_v8_prepared_call->std, ce);
+    object_properties_init(&php_v8_prepared_call->std, ce);
+
+    php_v8_prepared_call->std.handlers = &php_v8_prepared_call_object_handlers;
+
+    return &php_v8_prepared_call->std;
+}
+
+static PHP_METHOD(PreparedCall, __construct)
+{
+    zval rv;
+    zval *php_v8_context_zv;
+    zval *php_v8_function_zv;
+    zval *php_v8_recv_zv;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "ooo", &php_v8_context_zv, &php_v8_function_zv, &php_v8_recv_zv) == FAILURE) {
+        return;
+    }
+
+    PHP_V8_FETCH_PREPARED_CALL_INTO(getThis(), php_v8_prepared_call);
+    PHP_V8_CONTEXT_FETCH_WITH_CHECK(php_v8_context_zv, php_v8_context);
+    PHP_V8_VALUE_FETCH_WITH_CHECK(php_v8_function_zv, php_v8_function);
+    PHP_V8_VALUE_FETCH_WITH_CHECK(php_v8_recv_zv, php_v8_value_recv);
+
+    PHP_V8_DATA_ISOLATES_CHECK(php_v8_context, php_v8_function);
+    PHP_V8_DATA_ISOLATES_CHECK(php_v8_context, php_v8_value_recv);
+
+    PHP_V8_STORE_POINTER_TO_ISOLATE(php_v8_prepared_call, php_v8_context->php_v8_isolate);
+    PHP_V8_STORE_POINTER_TO_CONTEXT(php_v8_prepared_call, php_v8_context);
+
+    PHP_V8_PREPARED_CALL_STORE_ISOLATE(getThis(), PHP_V8_CONTEXT_READ_ISOLATE(php_v8_context_zv));
+    PHP_V8_PREPARED_CALL_STORE_CONTEXT(getThis(), php_v8_context_zv);
+    PHP_V8_PREPARED_CALL_STORE_FUNCTION(getThis(), php_v8_function_zv);
+    PHP_V8_PREPARED_CALL_STORE_RECEIVER(getThis(), php_v8_recv_zv);
+
+    PHP_V8_ENTER_STORED_ISOLATE(php_v8_prepared_call);
+
+    php_v8_prepared_call->function.Reset(isolate, php_v8_value_get_local_as<v8::Function>(php_v8_function));
+    php_v8_prepared_call->receiver.Reset(isolate, php_v8_value_get_local(php_v8_value_recv));
+}
+
+static PHP_METHOD(PreparedCall, getIsolate)
+{
+    zval rv;
+
+    if (zend_parse_parameters_none() == FAILURE) {
+        return;
+    }
+
+    PHP_V8_FETCH_PREPARED_CALL_WITH_CHECK(getThis(), php_v8_prepared_call);
+
+    RETVAL_ZVAL(PHP_V8_PREPARED_CALL_READ_ISOLATE(getThis()), 1, 0);
+}
+
+static PHP_METHOD(PreparedCall, getContext)
+{
+    zval rv;
+
+    if (zend_parse_parameters_none() == FAILURE) {
+        return;
+    }
+
+    PHP_V8_FETCH_PREPARED_CALL_WITH_CHECK(getThis(), php_v8_prepared_call);
+
+    RETVAL_ZVAL(PHP_V8_PREPARED_CALL_READ_CONTEXT(getThis()), 1, 0);
+}
+
+static PHP_METHOD(PreparedCall, getFunction)
+{
+    zval rv;
+
+    if (zend_parse_parameters_none() == FAILURE) {
+        return;
+    }
+
+    PHP_V8_FETCH_PREPARED_CALL_WITH_CHECK(getThis(), php_v8_prepared_call);
+
+    RETVAL_ZVAL(PHP_V8_PREPARED_CALL_READ_FUNCTION(getThis()), 1, 0);
+}
+
+static PHP_METHOD(PreparedCall, getReceiver)
+{
+    zval rv;
+
+    if (zend_parse_parameters_none() == FAILURE) {
+        return;
+    }
+
+    PHP_V8_FETCH_PREPARED_CALL_WITH_CHECK(getThis(), php_v8_prepared_call);
+
+    RETVAL_ZVAL(PHP_V8_PREPARED_CALL_READ_RECEIVER(getThis()), 1, 0);
+}
+
+static PHP_METHOD(PreparedCall, invoke)
+{
+    zval *args = NULL;
+    int args_count = 0;
+
+    phpv8::CallArguments<v8::Value> arguments;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "*", &args, &args_count) == FAILURE) {
+        return;
+    }
+
+    PHP_V8_FETCH_PREPARED_CALL_WITH_CHECK(getThis(), php_v8_prepared_call);
+    php_v8_context_t *php_v8_context = php_v8_prepared_call->php_v8_context;
+
+    PHP_V8_ENTER_STORED_ISOLATE(php_v8_prepared_call);
+    PHP_V8_ENTER_CONTEXT(php_v8_context);
+
+    if (!php_v8_function_unpack_variadic_args(args, args_count, 1, php_v8_context, context, arguments)) {
+        return;
+    }
+
+    v8::Local<v8::Function> local_function = v8::Local<v8::Function>::New(isolate, php_v8_prepared_call->function);
+    v8::Local<v8::Value> local_recv = v8::Local<v8::Value>::New(isolate, php_v8_prepared_call->receiver);
+
+    PHP_V8_TRY_CATCH(isolate);
+    PHP_V8_INIT_ISOLATE_LIMITS_ON_CONTEXT(php_v8_context);
+
+    v8::MaybeLocal<v8::Value> maybe_local_res = local_function->Call(context, local_recv, arguments.argc(), arguments.argv());
+
+    PHP_V8_MAYBE_CATCH(php_v8_context, try_catch);
+    PHP_V8_THROW_VALUE_EXCEPTION_WHEN_EMPTY(maybe_local_res, "Failed to call");
+
+    v8::Local<v8::Value> local_res = maybe_local_res.ToLocalChecked();
+
+    php_v8_get_or_unwrap_value(return_value, local_res, php_v8_context);
+}
+
+static PHP_METHOD(PreparedCall, invokeBatch)
+{
+    zval *arg_lists_zv;
+    zval *arguments_zv;
+    zval result_zv;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "a", &arg_lists_zv) == FAILURE) {
+        return;
+    }
+
+    PHP_V8_FETCH_PREPARED_CALL_WITH_CHECK(getThis(), php_v8_prepared_call);
+    php_v8_context_t *php_v8_context = php_v8_prepared_call->php_v8_context;
+
+    PHP_V8_ENTER_STORED_ISOLATE(php_v8_prepared_call);
+    PHP_V8_ENTER_CONTEXT(php_v8_context);
+
+    v8::Local<v8::Function> local_function = v8::Local<v8::Function>::New(isolate, php_v8_prepared_call->function);
+    v8::Local<v8::Value> local_recv = v8::Local<v8::Value>::New(isolate, php_v8_prepared_call->receiver);
+
+    array_init_size(return_value, zend_hash_num_elements(Z_ARRVAL_P(arg_lists_zv)));
+
+    PHP_V8_TRY_CATCH(isolate);
+    PHP_V8_INIT_ISOLATE_LIMITS_ON_CONTEXT(php_v8_context);
+
+    bool failed = false;
+    int i = 0;
+
+    // All calls share isolate and context scopes as well as limits timer, only arguments and result are scoped per call
+    ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(arg_lists_zv), arguments_zv) {
+        v8::HandleScope call_scope(isolate);
+        phpv8::CallArguments<v8::Value> arguments;
+
+        ZVAL_DEREF(arguments_zv);
+
+        if (Z_TYPE_P(arguments_zv) != IS_ARRAY) {
+            zend_throw_error(zend_ce_type_error,
+                             "Argument 1 passed to %s::%s() must be an array of arrays, %s given at %d offset",
+                             ZSTR_VAL(this_ce->name), get_active_function_name(), zend_zval_type_name(arguments_zv), i);
+            failed = true;
+            break;
+        }
+
+        if (!php_v8_function_unpack_mixed_args(arguments_zv, 1, php_v8_context, context, arguments)) {
+            failed = true;
+            break;
+        }
+
+        v8::MaybeLocal<v8::Value> maybe_local_res = local_function->Call(context, local_recv, arguments.argc(), arguments.argv());
+
+        // php callback may throw without making js call fail, and any further call would then run with exception pending
+        if (maybe_local_res.IsEmpty() || EG(exception)) {
+            failed = true;
+            break;
+        }
+
+        php_v8_get_or_unwrap_value(&result_zv, maybe_local_res.ToLocalChecked(), php_v8_context);
+        add_next_index_zval(return_value, &result_zv);
+
+        i++;
+    } ZEND_HASH_FOREACH_END();
+
+    PHP_V8_MAYBE_CATCH(php_v8_context, try_catch);
+
+    if (failed && !EG(exception)) {
+        PHP_V8_THROW_VALUE_EXCEPTION("Failed to call");
+    }
+}
+
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_CONSTRUCTOR_INFO_EX(arginfo___construct, 3)
+                ZEND_ARG_OBJ_INFO(0, context, V8\\Context, 0)
+                ZEND_ARG_OBJ_INFO(0, function, V8\\FunctionObject, 0)
+                ZEND_ARG_OBJ_INFO(0, recv, V8\\Value, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_getIsolate, ZEND_RETURN_VALUE, 0, V8\\Isolate, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_getContext, ZEND_RETURN_VALUE, 0, V8\\Context, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_getFunction, ZEND_RETURN_VALUE, 0, V8\\FunctionObject, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_getReceiver, ZEND_RETURN_VALUE, 0, V8\\Value, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_MIXED_INFO_EX(arginfo_invoke, 0)
+                ZEND_ARG_VARIADIC_INFO(0, arguments)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_invokeBatch, ZEND_RETURN_VALUE, 1, IS_ARRAY, 0)
+                ZEND_ARG_ARRAY_INFO(0, arg_lists, 0)
+ZEND_END_ARG_INFO()
+
+
+static const zend_function_entry php_v8_prepared_call_methods[] = {
+    PHP_V8_ME(PreparedCall, __construct, ZEND_ACC_PUBLIC | ZEND_ACC_CTOR)
+    PHP_V8_ME(PreparedCall, getIsolate,  ZEND_ACC_PUBLIC)
+    PHP_V8_ME(PreparedCall, getContext,  ZEND_ACC_PUBLIC)
+    PHP_V8_ME(PreparedCall, getFunction, ZEND_ACC_PUBLIC)
+    PHP_V8_ME(PreparedCall, getReceiver, ZEND_ACC_PUBLIC)
+    PHP_V8_ME(PreparedCall, invoke,      ZEND_ACC_PUBLIC)
+    PHP_V8_ME(PreparedCall, invokeBatch, ZEND_ACC_PUBLIC)
+
+    PHP_FE_END
+};
+
+
+PHP_MINIT_FUNCTION(php_v8_prepared_call)
+{
+    zend_class_entry ce;
+
+    INIT_NS_CLASS_ENTRY(ce, PHP_V8_NS, "PreparedCall", php_v8_prepared_call_methods);
+    this_ce = zend_register_internal_class(&ce);
+    this_ce->create_object = php_v8_prepared_call_ctor;
+
+    zend_declare_property_null(this_ce, ZEND_STRL("isolate"), ZEND_ACC_PRIVATE);
+    zend_declare_property_null(this_ce, ZEND_STRL("context"), ZEND_ACC_PRIVATE);
+    zend_declare_property_null(this_ce, ZEND_STRL("function"), ZEND_ACC_PRIVATE);
+    zend_declare_property_null(this_ce, ZEND_STRL("receiver"), ZEND_ACC_PRIVATE);
+
+    memcpy(&php_v8_prepared_call_object_handlers, zend_get_std_object_handlers(), sizeof(zend_object_handlers));
+
+    php_v8_prepared_call_object_handlers.offset    = XtOffsetOf(php_v8_prepared_call_t, std);
+    php_v8_prepared_call_object_handlers.free_obj  = php_v8_prepared_call_free;
+    php_v8_prepared_call_object_handlers.clone_obj = NULL;
+
+    return SUCCESS;
+}
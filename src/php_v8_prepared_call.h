@@ -0,0 +1,77 @@
+/*
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+#ifndef PHP_V8_PREPARED_CALL_H
+#define PHP_V8_PREPARED_CALL_H
+
+typedef struct _php_v8_prepared_call_t php_v8_prepared_call_t;
+
+#include "php_v8_exceptions.h"
+#include "php_v8_context.h"
+#include "php_v8_isolate.h"
+#include <v8.h>
+
+extern "C" {
+#include "php.h"
+
+#ifdef ZTS
+#include "TSRM.h"
+#endif
+}
+
+extern zend_class_entry *php_v8_prepared_call_class_entry;
+
+inline php_v8_prepared_call_t * php_v8_prepared_call_fetch_object(zend_object *obj);
+
+#define PHP_V8_FETCH_PREPARED_CALL(zv) php_v8_prepared_call_fetch_object(Z_OBJ_P(zv))
+#define PHP_V8_FETCH_PREPARED_CALL_INTO(pzval, into) php_v8_prepared_call_t *(into) = PHP_V8_FETCH_PREPARED_CALL((pzval))
+
+#define PHP_V8_EMPTY_PREPARED_CALL_MSG "PreparedCall" PHP_V8_EMPTY_HANDLER_MSG_PART
+#define PHP_V8_CHECK_EMPTY_PREPARED_CALL_HANDLER(val) PHP_V8_CHECK_EMPTY_HANDLER((val), PHP_V8_EMPTY_PREPARED_CALL_MSG)
+
+#define PHP_V8_FETCH_PREPARED_CALL_WITH_CHECK(pzval, into) \
+    PHP_V8_FETCH_PREPARED_CALL_INTO(pzval, into); \
+    PHP_V8_CHECK_EMPTY_PREPARED_CALL_HANDLER(into);
+
+
+#define PHP_V8_PREPARED_CALL_STORE_ISOLATE(to_zval, isolate_zv) zend_update_property(php_v8_prepared_call_class_entry, (to_zval), ZEND_STRL("isolate"), (isolate_zv));
+#define PHP_V8_PREPARED_CALL_READ_ISOLATE(from_zval) zend_read_property(php_v8_prepared_call_class_entry, (from_zval), ZEND_STRL("isolate"), 0, &rv)
+
+#define PHP_V8_PREPARED_CALL_STORE_CONTEXT(to_zval, context_zv) zend_update_property(php_v8_prepared_call_class_entry, (to_zval), ZEND_STRL("context"), (context_zv));
+#define PHP_V8_PREPARED_CALL_READ_CONTEXT(from_zval) zend_read_property(php_v8_prepared_call_class_entry, (from_zval), ZEND_STRL("context"), 0, &rv)
+
+#define PHP_V8_PREPARED_CALL_STORE_FUNCTION(to_zval, function_zv) zend_update_property(php_v8_prepared_call_class_entry, (to_zval), ZEND_STRL("function"), (function_zv));
+#define PHP_V8_PREPARED_CALL_READ_FUNCTION(from_zval) zend_read_property(php_v8_prepared_call_class_entry, (from_zval), ZEND_STRL("function"), 0, &rv)
+
+#define PHP_V8_PREPARED_CALL_STORE_RECEIVER(to_zval, receiver_zv) zend_update_property(php_v8_prepared_call_class_entry, (to_zval), ZEND_STRL("receiver"), (receiver_zv));
+#define PHP_V8_PREPARED_CALL_READ_RECEIVER(from_zval) zend_read_property(php_v8_prepared_call_class_entry, (from_zval), ZEND_STRL("receiver"), 0, &rv)
+
+
+struct _php_v8_prepared_call_t {
+    php_v8_isolate_t *php_v8_isolate;
+    php_v8_context_t *php_v8_context;
+
+    uint32_t isolate_handle;
+
+    v8::Persistent<v8::Function> function;
+    v8::Persistent<v8::Value> receiver;
+
+    zend_object std;
+};
+
+inline php_v8_prepared_call_t * php_v8_prepared_call_fetch_object(zend_object *obj) {
+    return (php_v8_prepared_call_t *)((char *)obj - XtOffsetOf(php_v8_prepared_call_t, std));
+}
+
+PHP_MINIT_FUNCTION(php_v8_prepared_call);
+
+#endif //PHP_V8_PREPARED_CALL_H
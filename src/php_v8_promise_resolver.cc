@@ -44,7 +44,7 @@ static PHP_METHOD(Resolver, __construct) {
     v8::Local<v8::Promise::Resolver> local_resolver = maybe_local_resolver.ToLocalChecked();
     php_v8_object_store_self_ptr(php_v8_value, local_resolver);
 
-    php_v8_value->persistent->Reset(isolate, local_resolver);
+    php_v8_value->persistent.Reset(isolate, local_resolver);
 }
 
 static PHP_METHOD(Resolver, resolve) {
@@ -64,7 +64,15 @@ php_v8_return_value_t *php_v8_callback_info_create_from_info_meta(zval *return_v
     php_v8_isolate_t *php_v8_isolate = PHP_V8_ISOLATE_FETCH_REFERENCE(isolate);
     php_v8_context_t *php_v8_context = php_v8_context_get_reference(context);
 
-    object_init_ex(return_value, this_ce);
+    if (php_v8_callback_info_acquire(&php_v8_isolate->property_callback_info_pool, return_value)) {
+        php_v8_return_value = php_v8_return_value_reset(zend_read_property(this_ce, return_value, ZEND_STRL("return_value"), 1, &tmp), php_v8_context, PHP_V8_RETVAL_ACCEPTS_ANY);
+    } else {
+        object_init_ex(return_value, this_ce);
+
+        php_v8_return_value = php_v8_return_value_create_from_return_value(&tmp, php_v8_context, PHP_V8_RETVAL_ACCEPTS_ANY);
+        zend_update_property(this_ce, return_value, ZEND_STRL("return_value"), &tmp);
+        Z_DELREF(tmp);
+    }
 
     // common to both callback structures:
     // isolate
@@ -81,10 +89,6 @@ php_v8_return_value_t *php_v8_callback_info_create_from_info_meta(zval *return_v
     php_v8_get_or_create_value(&tmp, args.Holder(), php_v8_isolate);
     zend_update_property(php_v8_property_callback_info_class_entry, return_value, ZEND_STRL("holder"), &tmp);
     Z_DELREF(tmp);
-    // return value
-    php_v8_return_value = php_v8_return_value_create_from_return_value(&tmp, php_v8_context, PHP_V8_RETVAL_ACCEPTS_ANY);
-    zend_update_property(php_v8_property_callback_info_class_entry, return_value, ZEND_STRL("return_value"), &tmp);
-    Z_DELREF(tmp);
 
     // specific to property callback structure:
     // should_throw_on_error
@@ -93,6 +97,17 @@ php_v8_return_value_t *php_v8_callback_info_create_from_info_meta(zval *return_v
     return php_v8_return_value;
 }
 
+void php_v8_property_callback_info_release(zval *callback_info, php_v8_isolate_t *php_v8_isolate) {
+    zval *pool = &php_v8_isolate->property_callback_info_pool;
+
+    if (!php_v8_callback_info_is_reusable(pool, callback_info, this_ce)) {
+        zval_ptr_dtor(callback_info);
+        return;
+    }
+
+    php_v8_callback_info_store(pool, callback_info, this_ce);
+}
+
 
 static PHP_METHOD(PropertyCallbackInfo, getIsolate) {
     zval rv;
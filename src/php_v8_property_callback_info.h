@@ -32,6 +32,7 @@ extern php_v8_return_value_t *php_v8_callback_info_create_from_info(zval *return
 extern php_v8_return_value_t *php_v8_callback_info_create_from_info(zval *return_value, const v8::PropertyCallbackInfo<v8::Boolean> &info);
 extern php_v8_return_value_t *php_v8_callback_info_create_from_info(zval *return_value, const v8::PropertyCallbackInfo<void> &info);
 
+extern void php_v8_property_callback_info_release(zval *callback_info, php_v8_isolate_t *php_v8_isolate);
 
 PHP_MINIT_FUNCTION (php_v8_property_callback_info);
 
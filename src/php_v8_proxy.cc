@@ -54,7 +54,7 @@ static PHP_METHOD(Proxy, __construct) {
 
     php_v8_object_store_self_ptr(php_v8_value, local_Proxy);
 
-    php_v8_value->persistent->Reset(isolate, local_Proxy);
+    php_v8_value->persistent.Reset(isolate, local_Proxy);
 }
 
 
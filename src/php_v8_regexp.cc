@@ -52,7 +52,7 @@ static PHP_METHOD(RegExp, __construct) {
 
     php_v8_object_store_self_ptr(php_v8_value, local_regexp);
 
-    php_v8_value->persistent->Reset(isolate, local_regexp);
+    php_v8_value->persistent.Reset(isolate, local_regexp);
 }
 
 
@@ -50,9 +50,14 @@ static zend_object *php_v8_return_value_ctor(zend_class_entry *ce) {
 
 
 php_v8_return_value_t * php_v8_return_value_create_from_return_value(zval *return_value, php_v8_context_t *php_v8_context, int accepts) {
+    object_init_ex(return_value, this_ce);
+
+    return php_v8_return_value_reset(return_value, php_v8_context, accepts);
+}
+
+php_v8_return_value_t * php_v8_return_value_reset(zval *return_value, php_v8_context_t *php_v8_context, int accepts) {
     zval isolate_zv;
     zval context_zv;
-    object_init_ex(return_value, this_ce);
 
     PHP_V8_RETURN_VALUE_FETCH_INTO(return_value, php_v8_return_value);
 
@@ -70,6 +75,11 @@ php_v8_return_value_t * php_v8_return_value_create_from_return_value(zval *retur
     return php_v8_return_value;
 }
 
+void php_v8_return_value_clear(zval *return_value) {
+    zend_update_property_null(this_ce, return_value, ZEND_STRL("isolate"));
+    zend_update_property_null(this_ce, return_value, ZEND_STRL("context"));
+}
+
 
 static inline v8::Local<v8::Value> php_v8_return_value_get(php_v8_return_value_t *php_v8_return_value) {
     assert(PHP_V8_RETVAL_ACCEPTS_INVALID != php_v8_return_value->accepts);
@@ -32,6 +32,8 @@ extern zend_class_entry *php_v8_return_value_class_entry;
 
 inline php_v8_return_value_t *php_v8_return_value_fetch_object(zend_object *obj);
 extern php_v8_return_value_t * php_v8_return_value_create_from_return_value(zval *return_value, php_v8_context_t *php_v8_context, int accepts);
+extern php_v8_return_value_t * php_v8_return_value_reset(zval *return_value, php_v8_context_t *php_v8_context, int accepts);
+extern void php_v8_return_value_clear(zval *return_value);
 inline void php_v8_return_value_mark_expired(php_v8_return_value_t *php_v8_return_value);
 
 
@@ -15,6 +15,7 @@
 #endif
 
 #include "php_v8_script.h"
+#include "php_v8_code_cache.h"
 #include "php_v8_script_origin.h"
 #include "php_v8_unbound_script.h"
 #include "php_v8_string.h"
@@ -55,6 +56,10 @@ static void php_v8_script_free(zend_object *object)
         delete php_v8_script->persistent;
     }
 
+    if (php_v8_script->pending_code_cache) {
+        delete php_v8_script->pending_code_cache;
+    }
+
     zend_object_std_dtor(&php_v8_script->std);
 }
 
@@ -182,7 +187,15 @@ static PHP_METHOD(Script, run)
 
     v8::Local<v8::Value> local_result = result.ToLocalChecked();
 
-    php_v8_get_or_create_value(return_value, local_result, php_v8_script->php_v8_isolate);
+    php_v8_get_or_unwrap_value(return_value, local_result, php_v8_context);
+
+    if (php_v8_script->pending_code_cache) {
+        phpv8::PendingCodeCache *pending_code_cache = php_v8_script->pending_code_cache;
+        php_v8_script->pending_code_cache = nullptr;
+
+        pending_code_cache->produce(local_script->GetUnboundScript());
+        delete pending_code_cache;
+    }
 }
 
 static PHP_METHOD(Script, getUnboundScript)
@@ -215,7 +228,7 @@ ZEND_END_ARG_INFO()
 PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_getContext, ZEND_RETURN_VALUE, 0, V8\\Context, 0)
 ZEND_END_ARG_INFO()
 
-PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_run, ZEND_RETURN_VALUE, 1, V8\\Value, 0)
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_MIXED_INFO_EX(arginfo_run, 1)
                 ZEND_ARG_OBJ_INFO(0, context, V8\\Context, 0)
 ZEND_END_ARG_INFO()
 
@@ -15,6 +15,10 @@
 
 typedef struct _php_v8_script_t php_v8_script_t;
 
+namespace phpv8 {
+    class PendingCodeCache;
+}
+
 #include "php_v8_exception_manager.h"
 #include "php_v8_context.h"
 #include "php_v8_isolate.h"
@@ -58,6 +62,7 @@ struct _php_v8_script_t {
   uint32_t isolate_handle;
 
   v8::Persistent<v8::Script> *persistent;
+  phpv8::PendingCodeCache *pending_code_cache;
 
   zend_object std;
 };
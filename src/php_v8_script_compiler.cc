@@ -16,6 +16,7 @@
 
 #include "php_v8_script_compiler.h"
 #include "php_v8_cached_data.h"
+#include "php_v8_code_cache.h"
 #include "php_v8_script.h"
 #include "php_v8_script_origin.h"
 #include "php_v8_unbound_script.h"
@@ -61,6 +62,15 @@ static v8::ScriptCompiler::Source * php_v8_build_source(zval *source_string_zv,
     return source;
 }
 
+static zval *php_v8_script_compiler_code_cache_store(zval *cached_data_zv, zend_long options) {
+    // explicitly given cached data or compile options take precedence over code cache
+    if (!ZVAL_IS_NULL(cached_data_zv) || options != static_cast<zend_long>(v8::ScriptCompiler::CompileOptions::kNoCompileOptions)) {
+        return NULL;
+    }
+
+    return php_v8_code_cache_get_store();
+}
+
 static PHP_METHOD(ScriptCompiler, getCachedDataVersionTag)
 {
     if (zend_parse_parameters_none() == FAILURE) {
@@ -103,9 +113,24 @@ static PHP_METHOD(ScriptCompiler, compileUnboundScript)
         PHP_V8_FETCH_CACHED_DATA_WITH_CHECK(cached_data_zv, php_v8_cached_data);
     }
 
+    zval *code_cache_store_zv = php_v8_script_compiler_code_cache_store(cached_data_zv, options);
+
     PHP_V8_ENTER_STORED_ISOLATE(php_v8_context);
     PHP_V8_ENTER_CONTEXT(php_v8_context);
 
+    phpv8::CodeCacheLookup code_cache;
+
+    if (code_cache_store_zv) {
+        if (!code_cache.lookup(code_cache_store_zv, isolate, php_v8_value_get_local_as<v8::String>(php_v8_source_string), origin_zv)) {
+            return;
+        }
+
+        if (code_cache.hit()) {
+            cached_data_zv = code_cache.cachedData();
+            options = static_cast<zend_long>(v8::ScriptCompiler::CompileOptions::kConsumeCodeCache);
+        }
+    }
+
     v8::ScriptCompiler::Source * source = php_v8_build_source(source_string_zv, origin_zv, cached_data_zv, isolate);
 
     if (source->GetResourceOptions().IsModule()) {
@@ -128,8 +153,23 @@ static PHP_METHOD(ScriptCompiler, compileUnboundScript)
 
     v8::Local<v8::UnboundScript> local_unbound_script = maybe_unbound_script.ToLocalChecked();
 
-    php_v8_update_source_cached_data(php_v8_source_zv, source);
     php_v8_create_unbound_script(return_value, php_v8_context->php_v8_isolate, local_unbound_script);
+
+    if (!code_cache_store_zv) {
+        php_v8_update_source_cached_data(php_v8_source_zv, source);
+        return;
+    }
+
+    if (code_cache.hit() && !code_cache.rejected()) {
+        return;
+    }
+
+    if (code_cache.hit() && !code_cache.evict()) {
+        return;
+    }
+
+    // there is no way to know when unbound script gets executed, so produce cache right away
+    php_v8_code_cache_produce(code_cache.storeZval(), code_cache.cacheKey(), local_unbound_script, php_v8_value_get_local_as<v8::String>(php_v8_source_string));
 }
 
 static PHP_METHOD(ScriptCompiler, compile)
@@ -161,9 +201,24 @@ static PHP_METHOD(ScriptCompiler, compile)
         PHP_V8_FETCH_CACHED_DATA_WITH_CHECK(cached_data_zv, php_v8_cached_data);
     }
 
+    zval *code_cache_store_zv = php_v8_script_compiler_code_cache_store(cached_data_zv, options);
+
     PHP_V8_ENTER_STORED_ISOLATE(php_v8_context);
     PHP_V8_ENTER_CONTEXT(php_v8_context);
 
+    phpv8::CodeCacheLookup code_cache;
+
+    if (code_cache_store_zv) {
+        if (!code_cache.lookup(code_cache_store_zv, isolate, php_v8_value_get_local_as<v8::String>(php_v8_source_string), origin_zv)) {
+            return;
+        }
+
+        if (code_cache.hit()) {
+            cached_data_zv = code_cache.cachedData();
+            options = static_cast<zend_long>(v8::ScriptCompiler::CompileOptions::kConsumeCodeCache);
+        }
+    }
+
     v8::ScriptCompiler::Source * source = php_v8_build_source(source_string_zv, origin_zv, cached_data_zv, isolate);
 
     if (source->GetResourceOptions().IsModule()) {
@@ -186,8 +241,23 @@ static PHP_METHOD(ScriptCompiler, compile)
 
     v8::Local<v8::Script> local_script = maybe_script.ToLocalChecked();
 
-    php_v8_update_source_cached_data(php_v8_source_zv, source);
-    php_v8_create_script(return_value, local_script, php_v8_context);
+    php_v8_script_t *php_v8_script = php_v8_create_script(return_value, local_script, php_v8_context);
+
+    if (!code_cache_store_zv) {
+        php_v8_update_source_cached_data(php_v8_source_zv, source);
+        return;
+    }
+
+    if (code_cache.hit() && !code_cache.rejected()) {
+        return;
+    }
+
+    if (code_cache.hit() && !code_cache.evict()) {
+        return;
+    }
+
+    // produce cache after first run, so that it covers lazily compiled functions too
+    php_v8_script->pending_code_cache = new phpv8::PendingCodeCache(code_cache.storeZval(), code_cache.cacheKey(), source_string_zv);
 }
 
 static PHP_METHOD(ScriptCompiler, compileFunctionInContext)
@@ -301,6 +371,32 @@ static PHP_METHOD(ScriptCompiler, createCodeCache)
     php_v8_create_cached_data(return_value, cached_data);
 }
 
+static PHP_METHOD(ScriptCompiler, setCodeCacheStore)
+{
+    zval *store_zv = NULL;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "O!", &store_zv, php_v8_code_cache_store_interface_class_entry) == FAILURE) {
+        return;
+    }
+
+    php_v8_code_cache_set_store(store_zv);
+}
+
+static PHP_METHOD(ScriptCompiler, getCodeCacheStore)
+{
+    if (zend_parse_parameters_none() == FAILURE) {
+        return;
+    }
+
+    zval *store_zv = php_v8_code_cache_get_store();
+
+    if (!store_zv) {
+        RETURN_NULL();
+    }
+
+    RETVAL_ZVAL(store_zv, 1, 0);
+}
+
 
 PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_getCachedDataVersionTag, ZEND_RETURN_VALUE, 0, IS_DOUBLE, 0)
 ZEND_END_ARG_INFO()
@@ -329,6 +425,13 @@ PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_createCodeCache, ZEND_RETU
                 ZEND_ARG_OBJ_INFO(0, source_string, V8\\StringValue, 0)
 ZEND_END_ARG_INFO()
 
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_VOID_INFO_EX(arginfo_setCodeCacheStore, 1)
+                ZEND_ARG_OBJ_INFO(0, store, V8\\ScriptCompiler\\CodeCacheStoreInterface, 1)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_getCodeCacheStore, ZEND_RETURN_VALUE, 0, V8\\ScriptCompiler\\CodeCacheStoreInterface, 1)
+ZEND_END_ARG_INFO()
+
 
 static const zend_function_entry php_v8_script_compiler_methods[] = {
     PHP_V8_ME(ScriptCompiler, getCachedDataVersionTag,  ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
@@ -336,6 +439,8 @@ static const zend_function_entry php_v8_script_compiler_methods[] = {
     PHP_V8_ME(ScriptCompiler, compile,                  ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
     PHP_V8_ME(ScriptCompiler, compileFunctionInContext, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
     PHP_V8_ME(ScriptCompiler, createCodeCache,          ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+    PHP_V8_ME(ScriptCompiler, setCodeCacheStore,        ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+    PHP_V8_ME(ScriptCompiler, getCodeCacheStore,        ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
 
     PHP_FE_END
 };
@@ -0,0 +1,182 @@
+/*
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "php_v8_serializer.h"
+#include "php_v8_exceptions.h"
+#include "php_v8_value.h"
+#include "php_v8_context.h"
+#include "php_v8.h"
+
+zend_class_entry *php_v8_serializer_class_entry;
+#define this_ce php_v8_serializer_class_entry
+
+#define PHP_V8_SERIALIZER_BUFFER_TO_STRING(buffer) \
+    reinterpret_cast<zend_string *>(static_cast<char *>(buffer) - _ZSTR_HEADER_SIZE)
+
+
+namespace phpv8 {
+    void SerializerDelegate::ThrowDataCloneError(v8::Local<v8::String> message) {
+        v8::Isolate *isolate = php_v8_isolate->isolate;
+
+        isolate->ThrowException(v8::Exception::Error(message));
+    }
+
+    v8::Maybe<bool> SerializerDelegate::WriteHostObject(v8::Isolate *isolate, v8::Local<v8::Object> object) {
+        if (!fci) {
+            return v8::ValueSerializer::Delegate::WriteHostObject(isolate, object);
+        }
+
+        zval args[1];
+        zval retval;
+
+        php_v8_get_or_create_value(&args[0], object, php_v8_isolate);
+
+        ZVAL_UNDEF(&retval);
+
+        fci->params = args;
+        fci->param_count = 1;
+        fci->retval = &retval;
+
+        php_v8_isolate_limits_callback_enter(php_v8_isolate);
+        zend_call_function(fci, fci_cache);
+        php_v8_isolate_limits_callback_leave(php_v8_isolate);
+
+        zval_ptr_dtor(&args[0]);
+
+        if (!EG(exception) && Z_TYPE(retval) != IS_STRING) {
+            zend_throw_exception_ex(php_v8_value_exception_class_entry, 0, "Host object writer should return string, %s given", zend_zval_type_name(&retval));
+        }
+
+        if (!EG(exception) && Z_STRLEN(retval) > UINT32_MAX) {
+            PHP_V8_THROW_VALUE_EXCEPTION("Host object data is too large");
+        }
+
+        if (EG(exception)) {
+            // php exception is what caller gets, js one only stops serialization
+            zval_ptr_dtor(&retval);
+            isolate->ThrowException(v8::Exception::Error(v8::String::NewFromUtf8(isolate, "Host object serialization failed", v8::NewStringType::kNormal).ToLocalChecked()));
+
+            return v8::Nothing<bool>();
+        }
+
+        serializer->WriteUint32(static_cast<uint32_t>(Z_STRLEN(retval)));
+        serializer->WriteRawBytes(Z_STRVAL(retval), Z_STRLEN(retval));
+
+        zval_ptr_dtor(&retval);
+
+        return v8::Just(true);
+    }
+
+    void *SerializerDelegate::ReallocateBufferMemory(void *old_buffer, size_t size, size_t *actual_size) {
+        zend_string *str;
+
+        if (old_buffer) {
+            str = zend_string_extend(PHP_V8_SERIALIZER_BUFFER_TO_STRING(old_buffer), size, 0);
+        } else {
+            str = zend_string_alloc(size, 0);
+        }
+
+        // zend string always has one more byte for trailing zero, so it is not counted here
+        *actual_size = size;
+
+        return ZSTR_VAL(str);
+    }
+
+    void SerializerDelegate::FreeBufferMemory(void *buffer) {
+        zend_string_free(PHP_V8_SERIALIZER_BUFFER_TO_STRING(buffer));
+    }
+
+    zend_string *SerializerDelegate::release(std::pair<uint8_t *, size_t> buffer) {
+        if (!buffer.first) {
+            return ZSTR_EMPTY_ALLOC();
+        }
+
+        zend_string *str = PHP_V8_SERIALIZER_BUFFER_TO_STRING(buffer.first);
+
+        ZSTR_LEN(str) = buffer.second;
+        ZSTR_VAL(str)[buffer.second] = '\0';
+
+        return str;
+    }
+}
+
+
+static PHP_METHOD(Serializer, serialize) {
+    zval *php_v8_context_zv;
+    zval *php_v8_value_zv;
+
+    zend_fcall_info fci = empty_fcall_info;
+    zend_fcall_info_cache fci_cache = empty_fcall_info_cache;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "oo|f!", &php_v8_context_zv, &php_v8_value_zv, &fci, &fci_cache) == FAILURE) {
+        return;
+    }
+
+    PHP_V8_CONTEXT_FETCH_WITH_CHECK(php_v8_context_zv, php_v8_context);
+    PHP_V8_VALUE_FETCH_WITH_CHECK(php_v8_value_zv, php_v8_value);
+
+    PHP_V8_DATA_ISOLATES_CHECK(php_v8_context, php_v8_value);
+
+    PHP_V8_ENTER_STORED_ISOLATE(php_v8_context);
+    PHP_V8_ENTER_CONTEXT(php_v8_context);
+
+    v8::Local<v8::Value> local_value = php_v8_value_get_local(php_v8_value);
+
+    phpv8::SerializerDelegate delegate(php_v8_context->php_v8_isolate, fci.size ? &fci : nullptr, fci.size ? &fci_cache : nullptr);
+    v8::ValueSerializer serializer(isolate, &delegate);
+
+    delegate.serializer = &serializer;
+
+    PHP_V8_TRY_CATCH(isolate);
+    PHP_V8_INIT_ISOLATE_LIMITS_ON_CONTEXT(php_v8_context);
+
+    serializer.WriteHeader();
+    v8::Maybe<bool> maybe_written = serializer.WriteValue(context, local_value);
+
+    if (EG(exception)) {
+        // exception thrown from host object writer
+        php_v8_isolate_limits_maybe_stop_timer(php_v8_context->php_v8_isolate);
+        return;
+    }
+
+    PHP_V8_MAYBE_CATCH(php_v8_context, try_catch);
+    PHP_V8_THROW_EXCEPTION_WHEN_NOTHING(maybe_written, "Failed to serialize");
+
+    RETVAL_STR(delegate.release(serializer.Release()));
+}
+
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_serialize, ZEND_RETURN_VALUE, 2, IS_STRING, 0)
+                ZEND_ARG_OBJ_INFO(0, context, V8\\Context, 0)
+                ZEND_ARG_OBJ_INFO(0, value, V8\\Value, 0)
+                ZEND_ARG_CALLABLE_INFO(0, host_object_writer, 1)
+ZEND_END_ARG_INFO()
+
+
+static const zend_function_entry php_v8_serializer_methods[] = {
+        PHP_V8_ME(Serializer, serialize, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+
+        PHP_FE_END
+};
+
+
+PHP_MINIT_FUNCTION(php_v8_serializer) {
+    zend_class_entry ce;
+    INIT_NS_CLASS_ENTRY(ce, PHP_V8_NS, "Serializer", php_v8_serializer_methods);
+    this_ce = zend_register_internal_class(&ce);
+
+    return SUCCESS;
+}
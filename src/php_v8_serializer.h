@@ -0,0 +1,65 @@
+/*
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+#ifndef PHP_V8_SERIALIZER_H
+#define PHP_V8_SERIALIZER_H
+
+namespace phpv8 {
+    class SerializerDelegate;
+}
+
+#include "php_v8_isolate.h"
+#include <v8.h>
+
+extern "C" {
+#include "php.h"
+
+#ifdef ZTS
+#include "TSRM.h"
+#endif
+}
+
+extern zend_class_entry* php_v8_serializer_class_entry;
+
+
+namespace phpv8 {
+
+    /**
+     * Serializer delegate that writes data straight into zend string, so that serialized value is returned to php
+     * without copying, and that hands host objects over to php callback.
+     *
+     * Host object is written as its data length followed by data returned from callback.
+     */
+    class SerializerDelegate : public v8::ValueSerializer::Delegate {
+    public:
+        SerializerDelegate(php_v8_isolate_t *php_v8_isolate, zend_fcall_info *fci, zend_fcall_info_cache *fci_cache)
+                : php_v8_isolate(php_v8_isolate), fci(fci), fci_cache(fci_cache) {}
+
+        void ThrowDataCloneError(v8::Local<v8::String> message) override;
+        v8::Maybe<bool> WriteHostObject(v8::Isolate *isolate, v8::Local<v8::Object> object) override;
+        void *ReallocateBufferMemory(void *old_buffer, size_t size, size_t *actual_size) override;
+        void FreeBufferMemory(void *buffer) override;
+
+        zend_string *release(std::pair<uint8_t *, size_t> buffer);
+
+        v8::ValueSerializer *serializer = nullptr;
+    private:
+        php_v8_isolate_t *php_v8_isolate;
+        zend_fcall_info *fci;
+        zend_fcall_info_cache *fci_cache;
+    };
+}
+
+
+PHP_MINIT_FUNCTION(php_v8_serializer);
+
+#endif //PHP_V8_SERIALIZER_H
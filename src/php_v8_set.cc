@@ -40,7 +40,7 @@ static PHP_METHOD(Set, __construct) {
 
     php_v8_object_store_self_ptr(php_v8_value, local_set);
 
-    php_v8_value->persistent->Reset(isolate, local_set);
+    php_v8_value->persistent.Reset(isolate, local_set);
 }
 
 static PHP_METHOD(Set, size) {
@@ -21,6 +21,9 @@
 #include "php_v8.h"
 #include "zend_smart_str.h"
 
+#include <cerrno>
+#include <cstring>
+
 
 zend_class_entry *php_v8_startup_data_class_entry;
 #define this_ce php_v8_startup_data_class_entry
@@ -48,11 +51,45 @@ void php_v8_startup_data_create(zval *return_value, v8::StartupData *blob) {
     php_v8_startup_data->blob = new phpv8::StartupData(blob, version);
 }
 
+phpv8::StartupData *php_v8_startup_data_make_persistent(phpv8::StartupData *blob) {
+    v8::StartupData *data = new v8::StartupData();
+
+    char *raw = (char *) pemalloc(static_cast<size_t>(blob->data()->raw_size), 1);
+    memcpy(raw, blob->data()->data, static_cast<size_t>(blob->data()->raw_size));
+
+    data->data     = raw;
+    data->raw_size = blob->data()->raw_size;
+
+    return new phpv8::StartupData(data, blob->version(), true);
+}
+
+static inline void php_v8_startup_data_release(phpv8::StartupData *blob) {
+    if (blob->release()) {
+        delete blob;
+    }
+}
+
+void php_v8_startup_data_shutdown() {
+    phpv8::PersistentStartupDataStore *store = PHP_V8_G(persistent_startup_data);
+
+    if (!store) {
+        return;
+    }
+
+    for (auto const &item : *store) {
+        php_v8_startup_data_release(item.second);
+    }
+
+    delete store;
+
+    PHP_V8_G(persistent_startup_data) = nullptr;
+}
+
 static void php_v8_startup_data_free(zend_object *object) {
     php_v8_startup_data_t *php_v8_startup_data = php_v8_startup_data_fetch_object(object);
 
-    if (php_v8_startup_data->blob && php_v8_startup_data->blob->release()) {
-        delete php_v8_startup_data->blob;
+    if (php_v8_startup_data->blob) {
+        php_v8_startup_data_release(php_v8_startup_data->blob);
     }
     php_v8_startup_data->blob = nullptr;
 
@@ -143,6 +180,168 @@ static PHP_METHOD(StartupData, isRejected) {
     RETURN_BOOL(false);
 }
 
+static PHP_METHOD(StartupData, fromFile) {
+    char *path = NULL;
+    size_t path_len = 0;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "p", &path, &path_len) == FAILURE) {
+        return;
+    }
+
+    if (php_check_open_basedir(path)) {
+        PHP_V8_THROW_EXCEPTION("Unable to map startup blob file (open_basedir restriction in effect)");
+        return;
+    }
+
+    phpv8::MappedFile *mapping = phpv8::MappedFile::open(path);
+
+    if (!mapping) {
+        zend_throw_exception_ex(php_v8_generic_exception_class_entry, 0, "Unable to map startup blob file '%s': %s", path, strerror(errno));
+        return;
+    }
+
+    if (mapping->size() > INT_MAX + sizeof(script_compiler_tag)) {
+        delete mapping;
+        PHP_V8_THROW_EXCEPTION("Invalid startup blob (too large)");
+        return;
+    }
+
+    if (mapping->size() < sizeof(script_compiler_tag)) {
+        delete mapping;
+        PHP_V8_THROW_EXCEPTION("Invalid startup blob (too small)");
+        return;
+    }
+
+    php_v8_init();
+
+    // only first page is touched here, the rest is left to v8 to fault in on deserialization
+    script_compiler_tag version = {};
+    memcpy(&version, mapping->data(), sizeof(script_compiler_tag));
+
+    script_compiler_tag runtime = php_v8_startup_data_get_current_tag();
+
+    if (runtime.magic != version.magic || runtime.tag != version.tag) {
+        delete mapping;
+        PHP_V8_THROW_EXCEPTION("Invalid startup blob (created by different v8 or php-v8 version)");
+        return;
+    }
+
+    object_init_ex(return_value, this_ce);
+    PHP_V8_STARTUP_DATA_FETCH_INTO(return_value, php_v8_startup_data);
+
+    php_v8_startup_data->blob = new phpv8::StartupData(mapping, version);
+}
+
+static PHP_METHOD(StartupData, persist) {
+    zend_string *name = NULL;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "S", &name) == FAILURE) {
+        return;
+    }
+
+    PHP_V8_STARTUP_DATA_FETCH_INTO(getThis(), php_v8_startup_data);
+
+    if (!php_v8_startup_data->blob || !php_v8_startup_data->blob->hasData()) {
+        PHP_V8_THROW_EXCEPTION("Unable to persist empty startup data");
+        return;
+    }
+
+    if (!php_v8_startup_data->blob->persistent()) {
+        // from now on this object uses persistent copy too, so it doesn't hold request memory twice
+        phpv8::StartupData *persistent = php_v8_startup_data_make_persistent(php_v8_startup_data->blob);
+
+        php_v8_startup_data_release(php_v8_startup_data->blob);
+        php_v8_startup_data->blob = persistent;
+    }
+
+    if (!PHP_V8_G(persistent_startup_data)) {
+        PHP_V8_G(persistent_startup_data) = new phpv8::PersistentStartupDataStore();
+    }
+
+    phpv8::PersistentStartupDataStore *store = PHP_V8_G(persistent_startup_data);
+    std::string key(ZSTR_VAL(name), ZSTR_LEN(name));
+
+    auto it = store->find(key);
+
+    if (it != store->end()) {
+        if (it->second == php_v8_startup_data->blob) {
+            return;
+        }
+
+        php_v8_startup_data_release(it->second);
+    }
+
+    php_v8_startup_data->blob->acquire();
+    (*store)[key] = php_v8_startup_data->blob;
+}
+
+static PHP_METHOD(StartupData, fetchPersisted) {
+    zend_string *name = NULL;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "S", &name) == FAILURE) {
+        return;
+    }
+
+    phpv8::PersistentStartupDataStore *store = PHP_V8_G(persistent_startup_data);
+
+    if (!store) {
+        RETURN_NULL();
+    }
+
+    auto it = store->find(std::string(ZSTR_VAL(name), ZSTR_LEN(name)));
+
+    if (it == store->end()) {
+        RETURN_NULL();
+    }
+
+    phpv8::StartupData *blob = it->second;
+
+    php_v8_init();
+
+    script_compiler_tag runtime = php_v8_startup_data_get_current_tag();
+    script_compiler_tag version = blob->version();
+
+    if (runtime.magic != version.magic || runtime.tag != version.tag || blob->rejected()) {
+        // blob was created by other v8 (or php-v8) version, so it is useless now
+        store->erase(it);
+        php_v8_startup_data_release(blob);
+
+        RETURN_NULL();
+    }
+
+    object_init_ex(return_value, this_ce);
+    PHP_V8_STARTUP_DATA_FETCH_INTO(return_value, php_v8_startup_data);
+
+    blob->acquire();
+    php_v8_startup_data->blob = blob;
+}
+
+static PHP_METHOD(StartupData, forgetPersisted) {
+    zend_string *name = NULL;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "S", &name) == FAILURE) {
+        return;
+    }
+
+    phpv8::PersistentStartupDataStore *store = PHP_V8_G(persistent_startup_data);
+
+    if (!store) {
+        RETURN_FALSE;
+    }
+
+    auto it = store->find(std::string(ZSTR_VAL(name), ZSTR_LEN(name)));
+
+    if (it == store->end()) {
+        RETURN_FALSE;
+    }
+
+    // objects and isolates that use this blob keep it alive as long as they need it
+    php_v8_startup_data_release(it->second);
+    store->erase(it);
+
+    RETURN_TRUE;
+}
+
 static PHP_METHOD(StartupData, createFromSource) {
     zend_string *blob = NULL;
 
@@ -205,6 +404,22 @@ ZEND_END_ARG_INFO()
 PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_isRejected, ZEND_RETURN_VALUE, 0, _IS_BOOL, 0)
 ZEND_END_ARG_INFO()
 
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_fromFile, ZEND_RETURN_VALUE, 1, V8\\StartupData, 0)
+                ZEND_ARG_TYPE_INFO(0, path, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_VOID_INFO_EX(arginfo_persist, 1)
+                ZEND_ARG_TYPE_INFO(0, name, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_fetchPersisted, ZEND_RETURN_VALUE, 1, V8\\StartupData, 1)
+                ZEND_ARG_TYPE_INFO(0, name, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_forgetPersisted, ZEND_RETURN_VALUE, 1, _IS_BOOL, 0)
+                ZEND_ARG_TYPE_INFO(0, name, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
 PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_createFromSource, ZEND_RETURN_VALUE, 1, V8\\StartupData, 0)
                 ZEND_ARG_TYPE_INFO(0, source, IS_STRING, 0)
 ZEND_END_ARG_INFO()
@@ -219,6 +434,10 @@ static const zend_function_entry php_v8_startup_data_methods[] = {
         PHP_V8_ME(StartupData, __construct,            ZEND_ACC_PUBLIC | ZEND_ACC_CTOR)
         PHP_V8_ME(StartupData, getData,                ZEND_ACC_PUBLIC)
         PHP_V8_ME(StartupData, isRejected,             ZEND_ACC_PUBLIC)
+        PHP_V8_ME(StartupData, fromFile,               ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+        PHP_V8_ME(StartupData, persist,                ZEND_ACC_PUBLIC)
+        PHP_V8_ME(StartupData, fetchPersisted,         ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+        PHP_V8_ME(StartupData, forgetPersisted,        ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
         PHP_V8_ME(StartupData, createFromSource,       ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
         PHP_V8_ME(StartupData, warmUpSnapshotDataBlob, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
 
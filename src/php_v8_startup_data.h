@@ -21,6 +21,7 @@ namespace phpv8 {
 }
 
 #include "php_v8_exceptions.h"
+#include "php_v8_mapped_file.h"
 #include <v8.h>
 
 extern "C" {
@@ -35,6 +36,8 @@ extern zend_class_entry* php_v8_startup_data_class_entry;
 
 inline php_v8_startup_data_t * php_v8_startup_data_fetch_object(zend_object *obj);
 extern script_compiler_tag php_v8_startup_data_get_current_tag();
+extern phpv8::StartupData *php_v8_startup_data_make_persistent(phpv8::StartupData *blob);
+extern void php_v8_startup_data_shutdown();
 
 #define PHP_V8_STARTUP_DATA_FETCH(zv) php_v8_startup_data_fetch_object(Z_OBJ_P(zv))
 #define PHP_V8_STARTUP_DATA_FETCH_INTO(pzval, into) php_v8_startup_data_t *(into) = PHP_V8_STARTUP_DATA_FETCH((pzval))
@@ -49,7 +52,17 @@ struct _script_compiler_tag {
 namespace phpv8 {
     class StartupData {
     public:
-        StartupData(v8::StartupData *data, script_compiler_tag version) : _data(data), in_use(1), _version(version), _rejected(false) {}
+        StartupData(v8::StartupData *data, script_compiler_tag version, bool persistent = false)
+                : _data(data), in_use(1), _version(version), _rejected(false), _persistent(persistent), _mapping(nullptr) {}
+
+        /**
+         * Blob that points right into mapped file (right after tag header), mapping is owned by this object
+         */
+        StartupData(MappedFile *mapping, script_compiler_tag version)
+                : _data(new v8::StartupData()), in_use(1), _version(version), _rejected(false), _persistent(true), _mapping(mapping) {
+            _data->data     = mapping->data() + sizeof(script_compiler_tag);
+            _data->raw_size = static_cast<int>(mapping->size() - sizeof(script_compiler_tag));
+        }
 
         inline v8::StartupData *acquire() {
             assert(in_use < UINT32_MAX);
@@ -82,9 +95,17 @@ namespace phpv8 {
             return _version;
         }
 
+        bool persistent() {
+            return _persistent;
+        }
+
         ~StartupData() {
             if (_data) {
-                efree((void*)_data->data);
+                if (_mapping) {
+                    delete _mapping;
+                } else {
+                    pefree((void*)_data->data, _persistent);
+                }
                 _data->data = nullptr;
                 _data->raw_size = 0;
                 delete _data;
@@ -97,6 +118,8 @@ namespace phpv8 {
         uint32_t in_use;
         script_compiler_tag _version;
         bool _rejected;
+        bool _persistent;
+        MappedFile *_mapping;
     };
 }
 
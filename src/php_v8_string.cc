@@ -23,6 +23,126 @@ zend_class_entry* php_v8_string_class_entry;
 #define this_ce php_v8_string_class_entry
 
 
+namespace phpv8 {
+    /**
+     * Exposes zend_string bytes to v8 without copying, string is kept alive until v8 disposes the resource.
+     *
+     * Resources are disposed by v8 GC or on isolate disposal at the latest, both happen while request memory is
+     * still there (pooled isolates with live resources are not recycled), so holding request-bound string is safe.
+     */
+    class ExternalOneByteStringResource : public v8::String::ExternalOneByteStringResource {
+    public:
+        ExternalOneByteStringResource(php_v8_isolate_t *php_v8_isolate, zend_string *string)
+                : php_v8_isolate(php_v8_isolate), string(zend_string_copy(string)) {
+            php_v8_isolate->external_strings_count++;
+            php_v8_isolate->isolate->AdjustAmountOfExternalAllocatedMemory(static_cast<int64_t>(ZSTR_LEN(string)));
+        }
+
+        ~ExternalOneByteStringResource() override {
+            php_v8_isolate->isolate->AdjustAmountOfExternalAllocatedMemory(-static_cast<int64_t>(ZSTR_LEN(string)));
+            php_v8_isolate->external_strings_count--;
+
+            zend_string_release(string);
+        }
+
+        const char *data() const override {
+            return ZSTR_VAL(string);
+        }
+
+        size_t length() const override {
+            return ZSTR_LEN(string);
+        }
+    private:
+        php_v8_isolate_t *php_v8_isolate;
+        zend_string *string;
+    };
+}
+
+static bool php_v8_string_is_ascii(const char *data, size_t length) {
+    const unsigned char *c = (const unsigned char *) data;
+    const unsigned char *end = c + length;
+
+    // word at a time, as strings worth externalizing are large ones
+    for (; c + sizeof(uint64_t) <= end; c += sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, c, sizeof(uint64_t));
+
+        if (word & UINT64_C(0x8080808080808080)) {
+            return false;
+        }
+    }
+
+    for (; c < end; c++) {
+        if (*c & 0x80) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static zend_string *php_v8_string_latin1_to_utf8(zend_string *latin1) {
+    size_t extra = 0;
+
+    for (size_t i = 0; i < ZSTR_LEN(latin1); i++) {
+        extra += ((unsigned char) ZSTR_VAL(latin1)[i]) >> 7;
+    }
+
+    size_t length = ZSTR_LEN(latin1);
+    zend_string *utf8 = zend_string_extend(latin1, length + extra, 0);
+
+    unsigned char *src = (unsigned char *) ZSTR_VAL(utf8) + length;
+    unsigned char *dst = (unsigned char *) ZSTR_VAL(utf8) + length + extra;
+
+    // expand in place from the tail, so that nothing is overwritten before it is read
+    while (src != dst) {
+        unsigned char c = *--src;
+
+        if (c < 0x80) {
+            *--dst = c;
+        } else {
+            *--dst = (unsigned char) (0x80 | (c & 0x3f));
+            *--dst = (unsigned char) (0xc0 | (c >> 6));
+        }
+    }
+
+    ZSTR_VAL(utf8)[ZSTR_LEN(utf8)] = '\0';
+
+    return utf8;
+}
+
+zend_string *php_v8_string_to_zend_string(v8::Local<v8::String> local_string) {
+    int length = local_string->Length();
+
+    if (!length) {
+        return ZSTR_EMPTY_ALLOC();
+    }
+
+    zend_string *string;
+
+    if (local_string->IsOneByte()) {
+        // latin1 bytes are copied as is, which is valid utf-8 as long as they are all ascii (and they usually are)
+        string = zend_string_alloc(static_cast<size_t>(length), 0);
+        local_string->WriteOneByte(reinterpret_cast<uint8_t *>(ZSTR_VAL(string)), 0, length, v8::String::NO_NULL_TERMINATION);
+        ZSTR_VAL(string)[length] = '\0';
+
+        if (!php_v8_string_is_ascii(ZSTR_VAL(string), ZSTR_LEN(string))) {
+            string = php_v8_string_latin1_to_utf8(string);
+        }
+
+        return string;
+    }
+
+    int utf8_length = local_string->Utf8Length();
+
+    string = zend_string_alloc(static_cast<size_t>(utf8_length), 0);
+    local_string->WriteUtf8(ZSTR_VAL(string), utf8_length, nullptr, v8::String::NO_NULL_TERMINATION);
+    ZSTR_VAL(string)[utf8_length] = '\0';
+
+    return string;
+}
+
+
 static PHP_METHOD(String, __construct) {
     zval *php_v8_isolate_zv;
 
@@ -45,7 +165,41 @@ static PHP_METHOD(String, __construct) {
 
     v8::Local<v8::String> str_tpl_checked = maybe_str_tpl.ToLocalChecked();
 
-    php_v8_value->persistent->Reset(isolate, str_tpl_checked);
+    php_v8_value->persistent.Reset(isolate, str_tpl_checked);
+}
+
+static PHP_METHOD(String, external)
+{
+    zval *php_v8_isolate_zv;
+    zend_string *string = NULL;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "oS", &php_v8_isolate_zv, &string) == FAILURE) {
+        return;
+    }
+
+    PHP_V8_ISOLATE_FETCH_WITH_CHECK(php_v8_isolate_zv, php_v8_isolate);
+    PHP_V8_ENTER_ISOLATE(php_v8_isolate);
+
+    PHP_V8_CHECK_STRING_RANGE(string, "String is too long");
+
+    v8::MaybeLocal<v8::String> maybe_string;
+
+    if (ZSTR_LEN(string) && php_v8_string_is_ascii(ZSTR_VAL(string), ZSTR_LEN(string))) {
+        // ASCII is valid Latin-1 that reads the same as UTF-8, so we can hand bytes over as is
+        phpv8::ExternalOneByteStringResource *resource = new phpv8::ExternalOneByteStringResource(php_v8_isolate, string);
+
+        maybe_string = v8::String::NewExternalOneByte(isolate, resource);
+
+        if (maybe_string.IsEmpty()) {
+            delete resource;
+        }
+    } else {
+        maybe_string = v8::String::NewFromUtf8(isolate, ZSTR_VAL(string), v8::NewStringType::kNormal, static_cast<int>(ZSTR_LEN(string)));
+    }
+
+    PHP_V8_THROW_VALUE_EXCEPTION_WHEN_EMPTY(maybe_string, "Failed to create String value");
+
+    php_v8_get_or_create_value(return_value, maybe_string.ToLocalChecked(), php_v8_isolate);
 }
 
 static PHP_METHOD(String, value)
@@ -57,13 +211,9 @@ static PHP_METHOD(String, value)
     PHP_V8_VALUE_FETCH_WITH_CHECK(getThis(), php_v8_value);
     PHP_V8_ENTER_ISOLATE(php_v8_value->php_v8_isolate);
 
-    v8::Local<v8::Value> str_tpl = php_v8_value_get_local(php_v8_value);
-
-    v8::String::Utf8Value str(isolate, str_tpl);
-
-    PHP_V8_CONVERT_UTF8VALUE_TO_STRING_WITH_CHECK(str, cstr);
+    v8::Local<v8::String> str_tpl_checked = php_v8_value_get_local_as<v8::String>(php_v8_value);
 
-    RETVAL_STRINGL(cstr, str.length());
+    RETVAL_STR(php_v8_string_to_zend_string(str_tpl_checked));
 }
 
 
@@ -112,6 +262,21 @@ static PHP_METHOD(String, isOneByte)
 }
 
 
+static PHP_METHOD(String, isExternal)
+{
+    if (zend_parse_parameters_none() == FAILURE) {
+        return;
+    }
+
+    PHP_V8_VALUE_FETCH_WITH_CHECK(getThis(), php_v8_value);
+    PHP_V8_ENTER_ISOLATE(php_v8_value->php_v8_isolate);
+
+    v8::Local<v8::String> str_tpl_checked = php_v8_value_get_local_as<v8::String>(php_v8_value);
+
+    RETVAL_BOOL(str_tpl_checked->IsExternal() || str_tpl_checked->IsExternalOneByte());
+}
+
+
 static PHP_METHOD(String, containsOnlyOneByte)
 {
     if (zend_parse_parameters_none() == FAILURE) {
@@ -132,6 +297,11 @@ PHP_V8_ZEND_BEGIN_ARG_WITH_CONSTRUCTOR_INFO_EX(arginfo___construct, 2)
     ZEND_ARG_INFO(0, data)
 ZEND_END_ARG_INFO()
 
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_external, ZEND_RETURN_VALUE, 2, V8\\StringValue, 0)
+    ZEND_ARG_OBJ_INFO(0, isolate, V8\\Isolate, 0)
+    ZEND_ARG_TYPE_INFO(0, data, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
 PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_value, ZEND_RETURN_VALUE, 0, IS_STRING, 0)
 ZEND_END_ARG_INFO()
 
@@ -144,16 +314,21 @@ ZEND_END_ARG_INFO()
 PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_isOneByte, ZEND_RETURN_VALUE, 0, _IS_BOOL, 0)
 ZEND_END_ARG_INFO()
 
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_isExternal, ZEND_RETURN_VALUE, 0, _IS_BOOL, 0)
+ZEND_END_ARG_INFO()
+
 PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_containsOnlyOneByte, ZEND_RETURN_VALUE, 0, _IS_BOOL, 0)
 ZEND_END_ARG_INFO()
 
 
 static const zend_function_entry php_v8_string_methods[] = {
     PHP_V8_ME(String, __construct,         ZEND_ACC_PUBLIC | ZEND_ACC_CTOR)
+    PHP_V8_ME(String, external,            ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
     PHP_V8_ME(String, value,               ZEND_ACC_PUBLIC)
     PHP_V8_ME(String, length,              ZEND_ACC_PUBLIC)
     PHP_V8_ME(String, utf8Length,          ZEND_ACC_PUBLIC)
     PHP_V8_ME(String, isOneByte,           ZEND_ACC_PUBLIC)
+    PHP_V8_ME(String, isExternal,          ZEND_ACC_PUBLIC)
     PHP_V8_ME(String, containsOnlyOneByte, ZEND_ACC_PUBLIC)
 
     PHP_FE_END
@@ -28,6 +28,8 @@ extern "C" {
 
 extern zend_class_entry* php_v8_string_class_entry;
 
+extern zend_string *php_v8_string_to_zend_string(v8::Local<v8::String> local_string);
+
 
 #define MAYBE_ZSTR_VAL(zstr) ((zstr) ? ZSTR_VAL(zstr) : "")
 #define MAYBE_ZSTR_LEN(zstr) ((zstr) ? ZSTR_LEN(zstr) : 0)
@@ -45,7 +45,7 @@ static PHP_METHOD(StringObject, __construct) {
 
     php_v8_object_store_self_ptr(php_v8_value, local_string_obj);
 
-    php_v8_value->persistent->Reset(isolate, local_string_obj);
+    php_v8_value->persistent.Reset(isolate, local_string_obj);
 }
 
 static PHP_METHOD(StringObject, valueOf) {
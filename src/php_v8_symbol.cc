@@ -50,7 +50,7 @@ static PHP_METHOD(Symbol, __construct) {
         return;
     }
 
-    php_v8_value->persistent->Reset(isolate, local_symbol);
+    php_v8_value->persistent.Reset(isolate, local_symbol);
 }
 
 static PHP_METHOD(Symbol, value)
@@ -45,7 +45,7 @@ static PHP_METHOD(SymbolObject, __construct) {
 
     php_v8_object_store_self_ptr(php_v8_value, local_symbol_obj);
 
-    php_v8_value->persistent->Reset(isolate, local_symbol_obj);
+    php_v8_value->persistent.Reset(isolate, local_symbol_obj);
 }
 
 static PHP_METHOD(SymbolObject, valueOf) {
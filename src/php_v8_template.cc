@@ -31,6 +31,7 @@ template<class T, typename N> void php_v8_template_Set(v8::Isolate *isolate, v8:
 template<class T, typename N> void php_v8_template_SetAccessorProperty(v8::Isolate *isolate, v8::Local<T> local_template, N* php_v8_template, INTERNAL_FUNCTION_PARAMETERS);
 template<class T, typename N> void php_v8_template_SetNativeDataProperty(v8::Isolate *isolate, v8::Local<T> local_template, N* php_v8_template, INTERNAL_FUNCTION_PARAMETERS);
 template<class T, typename N> void php_v8_template_SetLazyDataProperty(v8::Isolate *isolate, v8::Local<T> local_template, N* php_v8_template, INTERNAL_FUNCTION_PARAMETERS);
+template<class T, typename N> void php_v8_template_Bind(phpv8::Binding::Kind kind, v8::Isolate *isolate, v8::Local<T> local_template, N* php_v8_template, INTERNAL_FUNCTION_PARAMETERS);
 
 
 void php_v8_object_template_Set(INTERNAL_FUNCTION_PARAMETERS) {
@@ -124,6 +125,29 @@ void php_v8_function_template_SetLazyDataProperty(INTERNAL_FUNCTION_PARAMETERS)
 }
 
 
+void php_v8_object_template_Bind(phpv8::Binding::Kind kind, INTERNAL_FUNCTION_PARAMETERS) {
+
+    PHP_V8_FETCH_OBJECT_TEMPLATE_WITH_CHECK(getThis(), php_v8_template);
+
+    PHP_V8_ENTER_STORED_ISOLATE(php_v8_template);
+
+    v8::Local<v8::ObjectTemplate> local_template = php_v8_object_template_get_local(php_v8_template);
+
+    php_v8_template_Bind(kind, isolate, local_template, php_v8_template, INTERNAL_FUNCTION_PARAM_PASSTHRU);
+}
+
+void php_v8_function_template_Bind(phpv8::Binding::Kind kind, INTERNAL_FUNCTION_PARAMETERS)
+{
+    PHP_V8_FETCH_FUNCTION_TEMPLATE_WITH_CHECK(getThis(), php_v8_template);
+
+    PHP_V8_ENTER_STORED_ISOLATE(php_v8_template);
+
+    v8::Local<v8::FunctionTemplate> local_template = php_v8_function_template_get_local(php_v8_template);
+
+    php_v8_template_Bind(kind, isolate, local_template, php_v8_template, INTERNAL_FUNCTION_PARAM_PASSTHRU);
+}
+
+
 template<typename M, typename N>
 static inline bool php_v8_template_node_set(M *parent, N *child) {
     if (parent->node->isSelf(child->node)) {
@@ -353,6 +377,131 @@ void php_v8_template_SetLazyDataProperty(v8::Isolate *isolate, v8::Local<T> loca
                                           static_cast<v8::PropertyAttribute>(attributes));
 }
 
+static zend_class_entry *php_v8_template_get_calling_scope() {
+    zend_execute_data *ex = EG(current_execute_data);
+
+    // skip internal frames (this very method) to get to the userland code that creates binding
+    while (ex && (!ex->func || !ZEND_USER_CODE(ex->func->type))) {
+        ex = ex->prev_execute_data;
+    }
+
+    if (ex && ex->func->common.scope) {
+        return ex->func->common.scope;
+    }
+
+    // stdClass has no non-public members, so only public properties are accessible, regardless of the scope
+    // which is active when js accesses binding
+    return zend_standard_class_def;
+}
+
+template<class T, typename N>
+void php_v8_template_Bind(phpv8::Binding::Kind kind, v8::Isolate *isolate, v8::Local<T> local_template, N* php_v8_template, INTERNAL_FUNCTION_PARAMETERS) {
+    zval *php_v8_name_zv;
+    zval *target_zv;
+    zval *key_zv = NULL;
+    zend_string *property = NULL;
+    zend_class_entry *scope = NULL;
+
+    zend_long attributes = v8::PropertyAttribute::None;
+
+    v8::AccessorNameSetterCallback setter = 0;
+    v8::Local<v8::External> data;
+
+    switch (kind) {
+        case phpv8::Binding::Kind::Constant:
+            if (zend_parse_parameters(ZEND_NUM_ARGS(), "oz|l", &php_v8_name_zv, &target_zv, &attributes) == FAILURE) {
+                return;
+            }
+
+            if (Z_TYPE_P(target_zv) > IS_STRING && Z_TYPE_P(target_zv) != IS_ARRAY) {
+                zend_throw_error(zend_ce_type_error, "Argument 2 passed to %s::%s() must be of the type scalar, array or null, %s given",
+                                 ZSTR_VAL(zend_get_executed_scope()->name), get_active_function_name(), zend_zval_type_name(target_zv));
+                return;
+            }
+            break;
+        case phpv8::Binding::Kind::Property:
+            if (zend_parse_parameters(ZEND_NUM_ARGS(), "oo|S!l", &php_v8_name_zv, &target_zv, &property, &attributes) == FAILURE) {
+                return;
+            }
+
+            // bound property is accessed with the same visibility it has in the scope where binding is created
+            scope = php_v8_template_get_calling_scope();
+            break;
+        case phpv8::Binding::Kind::ArrayOffset:
+            if (zend_parse_parameters(ZEND_NUM_ARGS(), "oz|z!l", &php_v8_name_zv, &target_zv, &key_zv, &attributes) == FAILURE) {
+                return;
+            }
+
+            if (!Z_ISREF_P(target_zv) || Z_TYPE_P(Z_REFVAL_P(target_zv)) != IS_ARRAY) {
+                zend_throw_error(zend_ce_type_error, "Argument 2 passed to %s::%s() must be of the type array, %s given",
+                                 ZSTR_VAL(zend_get_executed_scope()->name), get_active_function_name(), zend_zval_type_name(target_zv));
+                return;
+            }
+
+            if (key_zv && Z_TYPE_P(key_zv) != IS_LONG && Z_TYPE_P(key_zv) != IS_STRING) {
+                zend_throw_error(zend_ce_type_error, "Argument 3 passed to %s::%s() must be of the type integer, string or null, %s given",
+                                 ZSTR_VAL(zend_get_executed_scope()->name), get_active_function_name(), zend_zval_type_name(key_zv));
+                return;
+            }
+            break;
+        default:
+            // should never get here
+            PHP_V8_THROW_EXCEPTION("Unknown binding kind");
+            return;
+    }
+
+    PHP_V8_VALUE_FETCH_WITH_CHECK(php_v8_name_zv, php_v8_name);
+    PHP_V8_DATA_ISOLATES_CHECK(php_v8_template, php_v8_name);
+
+    attributes = attributes ? attributes & PHP_V8_PROPERTY_ATTRIBUTE_FLAGS : attributes;
+
+    v8::Local<v8::Name> local_name = php_v8_value_get_local_as<v8::Name>(php_v8_name);
+
+    PHP_V8_CONVERT_FROM_V8_STRING_TO_STRING(isolate, name, local_name);
+
+    zval key;
+    ZVAL_NULL(&key);
+
+    if (property) {
+        ZVAL_STR_COPY(&key, property);
+    } else if (key_zv) {
+        ZVAL_COPY(&key, key_zv);
+    } else if (phpv8::Binding::Kind::Constant != kind) {
+        if (local_name->IsSymbol()) {
+            PHP_V8_THROW_VALUE_EXCEPTION("Property name or array offset should be given explicitly when binding to symbol");
+            return;
+        }
+
+        ZVAL_STRING(&key, name);
+    }
+
+    if (phpv8::Binding::Kind::ArrayOffset == kind && Z_TYPE(key) == IS_STRING) {
+        zend_ulong index;
+
+        // normalize key the same way php does, so that "1" and 1 address the same offset
+        if (ZEND_HANDLE_NUMERIC_STR(Z_STRVAL(key), Z_STRLEN(key), index)) {
+            zval_ptr_dtor(&key);
+            ZVAL_LONG(&key, static_cast<zend_long>(index));
+        }
+    }
+
+    phpv8::CallbacksBucket *bucket = php_v8_template->persistent_data->bucket("binding_", local_name->IsSymbol(), name);
+    data = v8::External::New(isolate, bucket);
+
+    bucket->binding()->set(kind, target_zv, &key, scope);
+    zval_ptr_dtor(&key);
+
+    if (phpv8::Binding::Kind::Constant != kind) {
+        setter = php_v8_callback_binding_setter;
+    }
+
+    local_template->SetNativeDataProperty(local_name,
+                                          php_v8_callback_binding_getter,
+                                          setter,
+                                          data,
+                                          static_cast<v8::PropertyAttribute>(attributes));
+}
+
 
 PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_getIsolate, ZEND_RETURN_VALUE, 0, V8\\Isolate, 0)
 ZEND_END_ARG_INFO()
@@ -387,12 +536,35 @@ PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_VOID_INFO_EX(arginfo_setLazyDataProperty, 2)
                 ZEND_ARG_TYPE_INFO(0, attributes, IS_LONG, 0)
 ZEND_END_ARG_INFO()
 
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_VOID_INFO_EX(arginfo_bindConstant, 2)
+                ZEND_ARG_OBJ_INFO(0, name, V8\\NameValue, 0)
+                ZEND_ARG_INFO(0, value)
+                ZEND_ARG_TYPE_INFO(0, attributes, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_VOID_INFO_EX(arginfo_bindProperty, 2)
+                ZEND_ARG_OBJ_INFO(0, name, V8\\NameValue, 0)
+                ZEND_ARG_TYPE_INFO(0, object, IS_OBJECT, 0)
+                ZEND_ARG_TYPE_INFO(0, property, IS_STRING, 1)
+                ZEND_ARG_TYPE_INFO(0, attributes, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_VOID_INFO_EX(arginfo_bindArrayOffset, 2)
+                ZEND_ARG_OBJ_INFO(0, name, V8\\NameValue, 0)
+                ZEND_ARG_ARRAY_INFO(1, array, 0)
+                ZEND_ARG_INFO(0, offset)
+                ZEND_ARG_TYPE_INFO(0, attributes, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
 static const zend_function_entry php_v8_template_methods[] = {
         PHP_V8_ABSTRACT_ME(Template, getIsolate)
         PHP_V8_ABSTRACT_ME(Template, set)
         PHP_V8_ABSTRACT_ME(Template, setAccessorProperty)
         PHP_V8_ABSTRACT_ME(Template, setNativeDataProperty)
         PHP_V8_ABSTRACT_ME(Template, setLazyDataProperty)
+        PHP_V8_ABSTRACT_ME(Template, bindConstant)
+        PHP_V8_ABSTRACT_ME(Template, bindProperty)
+        PHP_V8_ABSTRACT_ME(Template, bindArrayOffset)
 
         PHP_FE_END
 };
@@ -0,0 +1,268 @@
+/*
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "php_v8_typed_array.h"
+#include "php_v8_array_buffer_view.h"
+#include "php_v8_array_buffer.h"
+#include "php_v8_object.h"
+#include "php_v8_context.h"
+#include "php_v8_value.h"
+#include "php_v8.h"
+
+zend_class_entry *php_v8_typed_array_class_entry;
+zend_class_entry *php_v8_uint8_array_class_entry;
+zend_class_entry *php_v8_uint8_clamped_array_class_entry;
+zend_class_entry *php_v8_int8_array_class_entry;
+zend_class_entry *php_v8_uint16_array_class_entry;
+zend_class_entry *php_v8_int16_array_class_entry;
+zend_class_entry *php_v8_uint32_array_class_entry;
+zend_class_entry *php_v8_int32_array_class_entry;
+zend_class_entry *php_v8_float32_array_class_entry;
+zend_class_entry *php_v8_float64_array_class_entry;
+#define this_ce php_v8_typed_array_class_entry
+
+
+zend_class_entry *php_v8_typed_array_get_class_entry(v8::Local<v8::Value> value) {
+    if (value->IsUint8Array()) {
+        return php_v8_uint8_array_class_entry;
+    }
+
+    if (value->IsUint8ClampedArray()) {
+        return php_v8_uint8_clamped_array_class_entry;
+    }
+
+    if (value->IsInt8Array()) {
+        return php_v8_int8_array_class_entry;
+    }
+
+    if (value->IsUint16Array()) {
+        return php_v8_uint16_array_class_entry;
+    }
+
+    if (value->IsInt16Array()) {
+        return php_v8_int16_array_class_entry;
+    }
+
+    if (value->IsUint32Array()) {
+        return php_v8_uint32_array_class_entry;
+    }
+
+    if (value->IsInt32Array()) {
+        return php_v8_int32_array_class_entry;
+    }
+
+    if (value->IsFloat32Array()) {
+        return php_v8_float32_array_class_entry;
+    }
+
+    if (value->IsFloat64Array()) {
+        return php_v8_float64_array_class_entry;
+    }
+
+    // typed arrays we don't have dedicated class for are represented as plain objects
+    return php_v8_object_class_entry;
+}
+
+template<class T>
+static void php_v8_typed_array_construct(INTERNAL_FUNCTION_PARAMETERS, size_t element_size) {
+    zval rv;
+    zval *php_v8_context_zv;
+    zval *php_v8_buffer_zv;
+
+    zend_long byte_offset = 0;
+    zend_long length = 0;
+    zend_bool length_is_null = 1;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "oo|ll!", &php_v8_context_zv, &php_v8_buffer_zv, &byte_offset, &length, &length_is_null) == FAILURE) {
+        return;
+    }
+
+    PHP_V8_OBJECT_CONSTRUCT(getThis(), php_v8_context_zv, php_v8_context, php_v8_value);
+
+    PHP_V8_VALUE_FETCH_WITH_CHECK(php_v8_buffer_zv, php_v8_buffer);
+    PHP_V8_DATA_ISOLATES_CHECK(php_v8_value, php_v8_buffer);
+
+    v8::Local<v8::ArrayBuffer> local_buffer = php_v8_value_get_local_as<v8::ArrayBuffer>(php_v8_buffer);
+
+    if (!php_v8_array_buffer_view_check_range(local_buffer, byte_offset, &length, static_cast<bool>(length_is_null), element_size)) {
+        return;
+    }
+
+    v8::Local<T> local_array = T::New(local_buffer, static_cast<size_t>(byte_offset), static_cast<size_t>(length));
+
+    PHP_V8_THROW_VALUE_EXCEPTION_WHEN_EMPTY(local_array, "Failed to create TypedArray value");
+
+    php_v8_object_store_self_ptr(php_v8_value, local_array);
+
+    php_v8_value->persistent.Reset(isolate, local_array);
+}
+
+
+static PHP_METHOD(TypedArray, length) {
+    if (zend_parse_parameters_none() == FAILURE) {
+        return;
+    }
+
+    PHP_V8_VALUE_FETCH_WITH_CHECK(getThis(), php_v8_value);
+    PHP_V8_ENTER_STORED_ISOLATE(php_v8_value);
+
+    RETURN_LONG(static_cast<zend_long>(php_v8_value_get_local_as<v8::TypedArray>(php_v8_value)->Length()));
+}
+
+static PHP_METHOD(Uint8Array, __construct) {
+    php_v8_typed_array_construct<v8::Uint8Array>(INTERNAL_FUNCTION_PARAM_PASSTHRU, sizeof(uint8_t));
+}
+
+static PHP_METHOD(Uint8ClampedArray, __construct) {
+    php_v8_typed_array_construct<v8::Uint8ClampedArray>(INTERNAL_FUNCTION_PARAM_PASSTHRU, sizeof(uint8_t));
+}
+
+static PHP_METHOD(Int8Array, __construct) {
+    php_v8_typed_array_construct<v8::Int8Array>(INTERNAL_FUNCTION_PARAM_PASSTHRU, sizeof(int8_t));
+}
+
+static PHP_METHOD(Uint16Array, __construct) {
+    php_v8_typed_array_construct<v8::Uint16Array>(INTERNAL_FUNCTION_PARAM_PASSTHRU, sizeof(uint16_t));
+}
+
+static PHP_METHOD(Int16Array, __construct) {
+    php_v8_typed_array_construct<v8::Int16Array>(INTERNAL_FUNCTION_PARAM_PASSTHRU, sizeof(int16_t));
+}
+
+static PHP_METHOD(Uint32Array, __construct) {
+    php_v8_typed_array_construct<v8::Uint32Array>(INTERNAL_FUNCTION_PARAM_PASSTHRU, sizeof(uint32_t));
+}
+
+static PHP_METHOD(Int32Array, __construct) {
+    php_v8_typed_array_construct<v8::Int32Array>(INTERNAL_FUNCTION_PARAM_PASSTHRU, sizeof(int32_t));
+}
+
+static PHP_METHOD(Float32Array, __construct) {
+    php_v8_typed_array_construct<v8::Float32Array>(INTERNAL_FUNCTION_PARAM_PASSTHRU, sizeof(float));
+}
+
+static PHP_METHOD(Float64Array, __construct) {
+    php_v8_typed_array_construct<v8::Float64Array>(INTERNAL_FUNCTION_PARAM_PASSTHRU, sizeof(double));
+}
+
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_length, ZEND_RETURN_VALUE, 0, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
+PHP_V8_ZEND_BEGIN_ARG_WITH_CONSTRUCTOR_INFO_EX(arginfo___construct, 2)
+                ZEND_ARG_OBJ_INFO(0, context, V8\\Context, 0)
+                ZEND_ARG_OBJ_INFO(0, buffer, V8\\ArrayBufferObject, 0)
+                ZEND_ARG_TYPE_INFO(0, byte_offset, IS_LONG, 0)
+                ZEND_ARG_TYPE_INFO(0, length, IS_LONG, 1)
+ZEND_END_ARG_INFO()
+
+
+static const zend_function_entry php_v8_typed_array_methods[] = {
+        PHP_V8_ME(TypedArray, length, ZEND_ACC_PUBLIC)
+
+        PHP_FE_END
+};
+
+static const zend_function_entry php_v8_uint8_array_methods[] = {
+        PHP_V8_ME(Uint8Array, __construct, ZEND_ACC_PUBLIC | ZEND_ACC_CTOR)
+
+        PHP_FE_END
+};
+
+static const zend_function_entry php_v8_uint8_clamped_array_methods[] = {
+        PHP_V8_ME(Uint8ClampedArray, __construct, ZEND_ACC_PUBLIC | ZEND_ACC_CTOR)
+
+        PHP_FE_END
+};
+
+static const zend_function_entry php_v8_int8_array_methods[] = {
+        PHP_V8_ME(Int8Array, __construct, ZEND_ACC_PUBLIC | ZEND_ACC_CTOR)
+
+        PHP_FE_END
+};
+
+static const zend_function_entry php_v8_uint16_array_methods[] = {
+        PHP_V8_ME(Uint16Array, __construct, ZEND_ACC_PUBLIC | ZEND_ACC_CTOR)
+
+        PHP_FE_END
+};
+
+static const zend_function_entry php_v8_int16_array_methods[] = {
+        PHP_V8_ME(Int16Array, __construct, ZEND_ACC_PUBLIC | ZEND_ACC_CTOR)
+
+        PHP_FE_END
+};
+
+static const zend_function_entry php_v8_uint32_array_methods[] = {
+        PHP_V8_ME(Uint32Array, __construct, ZEND_ACC_PUBLIC | ZEND_ACC_CTOR)
+
+        PHP_FE_END
+};
+
+static const zend_function_entry php_v8_int32_array_methods[] = {
+        PHP_V8_ME(Int32Array, __construct, ZEND_ACC_PUBLIC | ZEND_ACC_CTOR)
+
+        PHP_FE_END
+};
+
+static const zend_function_entry php_v8_float32_array_methods[] = {
+        PHP_V8_ME(Float32Array, __construct, ZEND_ACC_PUBLIC | ZEND_ACC_CTOR)
+
+        PHP_FE_END
+};
+
+static const zend_function_entry php_v8_float64_array_methods[] = {
+        PHP_V8_ME(Float64Array, __construct, ZEND_ACC_PUBLIC | ZEND_ACC_CTOR)
+
+        PHP_FE_END
+};
+
+
+PHP_MINIT_FUNCTION(php_v8_typed_array) {
+    zend_class_entry ce;
+    INIT_NS_CLASS_ENTRY(ce, PHP_V8_NS, "TypedArrayObject", php_v8_typed_array_methods);
+    this_ce = zend_register_internal_class_ex(&ce, php_v8_array_buffer_view_class_entry);
+    this_ce->ce_flags |= ZEND_ACC_EXPLICIT_ABSTRACT_CLASS;
+
+    INIT_NS_CLASS_ENTRY(ce, PHP_V8_NS, "Uint8ArrayObject", php_v8_uint8_array_methods);
+    php_v8_uint8_array_class_entry = zend_register_internal_class_ex(&ce, this_ce);
+
+    INIT_NS_CLASS_ENTRY(ce, PHP_V8_NS, "Uint8ClampedArrayObject", php_v8_uint8_clamped_array_methods);
+    php_v8_uint8_clamped_array_class_entry = zend_register_internal_class_ex(&ce, this_ce);
+
+    INIT_NS_CLASS_ENTRY(ce, PHP_V8_NS, "Int8ArrayObject", php_v8_int8_array_methods);
+    php_v8_int8_array_class_entry = zend_register_internal_class_ex(&ce, this_ce);
+
+    INIT_NS_CLASS_ENTRY(ce, PHP_V8_NS, "Uint16ArrayObject", php_v8_uint16_array_methods);
+    php_v8_uint16_array_class_entry = zend_register_internal_class_ex(&ce, this_ce);
+
+    INIT_NS_CLASS_ENTRY(ce, PHP_V8_NS, "Int16ArrayObject", php_v8_int16_array_methods);
+    php_v8_int16_array_class_entry = zend_register_internal_class_ex(&ce, this_ce);
+
+    INIT_NS_CLASS_ENTRY(ce, PHP_V8_NS, "Uint32ArrayObject", php_v8_uint32_array_methods);
+    php_v8_uint32_array_class_entry = zend_register_internal_class_ex(&ce, this_ce);
+
+    INIT_NS_CLASS_ENTRY(ce, PHP_V8_NS, "Int32ArrayObject", php_v8_int32_array_methods);
+    php_v8_int32_array_class_entry = zend_register_internal_class_ex(&ce, this_ce);
+
+    INIT_NS_CLASS_ENTRY(ce, PHP_V8_NS, "Float32ArrayObject", php_v8_float32_array_methods);
+    php_v8_float32_array_class_entry = zend_register_internal_class_ex(&ce, this_ce);
+
+    INIT_NS_CLASS_ENTRY(ce, PHP_V8_NS, "Float64ArrayObject", php_v8_float64_array_methods);
+    php_v8_float64_array_class_entry = zend_register_internal_class_ex(&ce, this_ce);
+
+    return SUCCESS;
+}
@@ -0,0 +1,42 @@
+/*
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+#ifndef PHP_V8_TYPED_ARRAY_H
+#define PHP_V8_TYPED_ARRAY_H
+
+#include "php_v8_value.h"
+#include <v8.h>
+
+extern "C" {
+#include "php.h"
+
+#ifdef ZTS
+#include "TSRM.h"
+#endif
+}
+
+extern zend_class_entry* php_v8_typed_array_class_entry;
+extern zend_class_entry* php_v8_uint8_array_class_entry;
+extern zend_class_entry* php_v8_uint8_clamped_array_class_entry;
+extern zend_class_entry* php_v8_int8_array_class_entry;
+extern zend_class_entry* php_v8_uint16_array_class_entry;
+extern zend_class_entry* php_v8_int16_array_class_entry;
+extern zend_class_entry* php_v8_uint32_array_class_entry;
+extern zend_class_entry* php_v8_int32_array_class_entry;
+extern zend_class_entry* php_v8_float32_array_class_entry;
+extern zend_class_entry* php_v8_float64_array_class_entry;
+
+extern zend_class_entry *php_v8_typed_array_get_class_entry(v8::Local<v8::Value> value);
+
+PHP_MINIT_FUNCTION(php_v8_typed_array);
+
+#endif //PHP_V8_TYPED_ARRAY_H
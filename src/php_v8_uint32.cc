@@ -40,7 +40,7 @@ static PHP_METHOD(Uint32, __construct) {
 
     PHP_V8_THROW_VALUE_EXCEPTION_WHEN_EMPTY(local_value, "Failed to create Uint32 value");
 
-    php_v8_value->persistent->Reset(isolate, local_value);
+    php_v8_value->persistent.Reset(isolate, local_value);
 }
 
 
@@ -32,7 +32,7 @@ static PHP_METHOD(Undefined, __construct) {
 
     PHP_V8_VALUE_CONSTRUCT(getThis(), php_v8_isolate_zv, php_v8_isolate, php_v8_value);
 
-    php_v8_value->persistent->Reset(isolate, v8::Undefined(isolate));
+    php_v8_value->persistent.Reset(isolate, v8::Undefined(isolate));
 }
 
 static PHP_METHOD(Undefined, value)
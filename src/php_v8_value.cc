@@ -30,6 +30,9 @@
 #include "php_v8_set.h"
 #include "php_v8_promise.h"
 #include "php_v8_proxy.h"
+#include "php_v8_array_buffer.h"
+#include "php_v8_typed_array.h"
+#include "php_v8_data_view.h"
 #include "php_v8_object.h"
 
 #include "php_v8_null.h"
@@ -44,6 +47,7 @@
 /* end of type listing */
 
 #include "php_v8_data.h"
+#include "php_v8_value_converter.h"
 #include "php_v8_isolate.h"
 #include "php_v8_context.h"
 #include "php_v8.h"
@@ -75,29 +79,46 @@ static void php_v8_value_make_weak(php_v8_value_t *php_v8_value) {
     // TODO: maybe week: if it already week, if has no isolate, if no callbacks or empty callbacks
     assert(!php_v8_value->is_weak);
 
-    php_v8_value->php_v8_isolate->weak_values->add(php_v8_value->persistent, php_v8_value->persistent_data);
+    PHP_V8_ENTER_STORED_ISOLATE(php_v8_value);
+
+    // inline handle goes away together with wrapper object, so weak one has to live on its own
+    v8::Persistent<v8::Value> *persistent = new v8::Persistent<v8::Value>(isolate, php_v8_value_get_local(php_v8_value));
+    php_v8_value->persistent.Reset();
+
+    // from now on persistent data is owned by weak values collection
+    phpv8::PersistentData *persistent_data = php_v8_value->persistent_data;
+    php_v8_value->persistent_data = NULL;
+
+    php_v8_value->php_v8_isolate->weak_values->add(persistent, persistent_data);
 
     php_v8_value->is_weak = true;
-    php_v8_value->persistent->SetWeak(php_v8_value->persistent, php_v8_value_weak_callback, v8::WeakCallbackType::kParameter);
+    persistent->SetWeak(persistent, php_v8_value_weak_callback, v8::WeakCallbackType::kParameter);
 
     // Tell v8 that we allocated external memory
-    php_v8_debug_external_mem("Allocate external memory (value: %p):  %" PRId64 "\n", php_v8_value->persistent_data, php_v8_value->persistent_data->getTotalSize())
-    php_v8_value->php_v8_isolate->isolate->AdjustAmountOfExternalAllocatedMemory(php_v8_value->persistent_data->getTotalSize());
+    php_v8_debug_external_mem("Allocate external memory (value: %p):  %" PRId64 "\n", persistent_data, persistent_data->getTotalSize())
+    isolate->AdjustAmountOfExternalAllocatedMemory(persistent_data->getTotalSize());
 }
 
 static HashTable * php_v8_value_gc(zval *object, zval **table, int *n) {
     PHP_V8_VALUE_FETCH_INTO(object, php_v8_value);
 
-    php_v8_callbacks_gc(php_v8_value->persistent_data, &php_v8_value->gc_data, &php_v8_value->gc_data_count, table, n);
+    if (php_v8_value->persistent_data) {
+        php_v8_callbacks_gc(php_v8_value->persistent_data, &php_v8_value->gc_data, &php_v8_value->gc_data_count, table, n);
+    } else {
+        *table = NULL;
+        *n = 0;
+    }
 
     if(!Z_ISUNDEF(php_v8_value->exception)) {
         *n = *n + 1;
 
         if (php_v8_value->gc_data_count < *n) {
             php_v8_value->gc_data = (zval *)safe_erealloc(php_v8_value->gc_data, *n, sizeof(zval), 0);
+            php_v8_value->gc_data_count = *n;
         }
 
         ZVAL_COPY_VALUE(&php_v8_value->gc_data[*n-1], &php_v8_value->exception);
+        *table = php_v8_value->gc_data;
     }
 
     return zend_std_get_properties(object);
@@ -106,21 +127,13 @@ static HashTable * php_v8_value_gc(zval *object, zval **table, int *n) {
 static void php_v8_value_free(zend_object *object) {
     php_v8_value_t *php_v8_value = php_v8_value_fetch_object(object);
 
-    // TODO: check whether we have valid isolate?
-    if (PHP_V8_IS_UP_AND_RUNNING() && php_v8_value->php_v8_isolate && php_v8_value->persistent && !php_v8_value->persistent->IsEmpty()) {
-        PHP_V8_ENTER_STORED_ISOLATE(php_v8_value);
-
-        // TODO: in general, this makes sense only for objects
-        v8::Local<v8::Value> local_value = php_v8_value_get_local(php_v8_value);
+    if (php_v8_value->identity_hash && php_v8_value->php_v8_isolate && PHP_V8_ISOLATE_HAS_VALID_HANDLE(php_v8_value)) {
+        // TODO: at this point we SHOULD drop link to complete object and replace it with link to persistent handler and callbacks
 
-        if (local_value->IsObject()) {
-            // TODO: at this point we SHOULD drop link to complete object and replace it with link to persistent handler and callbacks
-
-            /* Here we lose reference to persistent handler and callbacks. While in most cases this should be
-             * rare case, it may lead to allocated memory bloating, so it may be a good idea to store proper reference
-             */
-            php_v8_object_delete_self_ptr(php_v8_value, v8::Local<v8::Object>::Cast(local_value));
-        }
+        /* Here we lose reference to persistent handler and callbacks. While in most cases this should be
+         * rare case, it may lead to allocated memory bloating, so it may be a good idea to store proper reference
+         */
+        php_v8_object_delete_self_ptr(php_v8_value);
     }
 
     if (!Z_ISUNDEF(php_v8_value->exception)) {
@@ -136,24 +149,19 @@ static void php_v8_value_free(zend_object *object) {
 
 
     // TODO: making weak makes sense for objects only
-    if (PHP_V8_IS_UP_AND_RUNNING() && php_v8_value->persistent_data && !php_v8_value->persistent_data->empty()) {
+    if (PHP_V8_IS_UP_AND_RUNNING() && php_v8_value->persistent_data && !php_v8_value->persistent_data->empty()
+        && PHP_V8_ISOLATE_HAS_VALID_HANDLE(php_v8_value)) {
         php_v8_value_make_weak(php_v8_value); // TODO: refactor logic for make weak to include checking whether it can be weak -> maybe_make_weak
     }
 
-    // NOTE: is weak check can be made in this way:
-    //if (!php_v8_value->persistent || !php_v8_value->persistent->IsWeak()) {
     if (!php_v8_value->is_weak) {
         if (php_v8_value->persistent_data) {
             delete php_v8_value->persistent_data;
             php_v8_value->persistent_data = NULL;
         }
 
-        if (php_v8_value->persistent) {
-            if (PHP_V8_IS_UP_AND_RUNNING() && PHP_V8_ISOLATE_HAS_VALID_HANDLE(php_v8_value)) {
-                php_v8_value->persistent->Reset();
-            }
-
-            delete php_v8_value->persistent;
+        if (PHP_V8_IS_UP_AND_RUNNING() && PHP_V8_ISOLATE_HAS_VALID_HANDLE(php_v8_value)) {
+            php_v8_value->persistent.Reset();
         }
     }
 
@@ -169,9 +177,6 @@ static zend_object * php_v8_value_ctor(zend_class_entry *ce) {
     zend_object_std_init(&php_v8_value->std, ce);
     object_properties_init(&php_v8_value->std, ce);
 
-    php_v8_value->persistent = new v8::Persistent<v8::Value>();
-    php_v8_value->persistent_data = new phpv8::PersistentData();
-
     php_v8_value->std.handlers = &php_v8_value_object_handlers;
 
     return &php_v8_value->std;
@@ -247,6 +252,18 @@ zend_class_entry *php_v8_get_class_entry_from_value(v8::Local<v8::Value> value)
             return php_v8_proxy_class_entry;
         }
 
+        if (value->IsArrayBuffer()) {
+            return php_v8_array_buffer_class_entry;
+        }
+
+        if (value->IsTypedArray()) {
+            return php_v8_typed_array_get_class_entry(value);
+        }
+
+        if (value->IsDataView()) {
+            return php_v8_data_view_class_entry;
+        }
+
         // anything else will be just an object
         return php_v8_object_class_entry;
     }
@@ -312,7 +329,7 @@ php_v8_value_t *php_v8_create_value(zval *return_value, v8::Local<v8::Value> loc
         php_v8_object_store_self_ptr(return_php_v8_value, v8::Local<v8::Object>::Cast(local_value));
     }
 
-    return_php_v8_value->persistent->Reset(php_v8_isolate->isolate, local_value);
+    return_php_v8_value->persistent.Reset(php_v8_isolate->isolate, local_value);
 
     return return_php_v8_value;
 }
@@ -335,6 +352,22 @@ php_v8_value_t *php_v8_get_or_create_value(zval *return_value, v8::Local<v8::Val
     return php_v8_create_value(return_value, local_value, php_v8_isolate);
 }
 
+phpv8::PersistentData *php_v8_value_get_persistent_data(php_v8_value_t *php_v8_value) {
+    if (!php_v8_value->persistent_data) {
+        php_v8_value->persistent_data = new phpv8::PersistentData();
+    }
+
+    return php_v8_value->persistent_data;
+}
+
+void php_v8_get_or_unwrap_value(zval *return_value, v8::Local<v8::Value> local_value, php_v8_context_t *php_v8_context) {
+    if (php_v8_context->unwrap_primitives && phpv8::ValueConverter::toPhpScalar(local_value, return_value)) {
+        return;
+    }
+
+    php_v8_get_or_create_value(return_value, local_value, php_v8_context->php_v8_isolate);
+}
+
 
 static PHP_METHOD(Value, getIsolate) {
     zval rv;
@@ -932,6 +965,83 @@ static PHP_METHOD(Value, instanceOf) {
 }
 
 
+/* -----------------------------------------------------------------------
+          Deep conversion between php and js values
+   ----------------------------------------------------------------------- */
+
+static PHP_METHOD(Value, fromPhp) {
+    zval *php_v8_context_zv;
+    zval *value_zv;
+    zend_long max_depth = PHP_V8_VALUE_CONVERTER_DEFAULT_MAX_DEPTH;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "oz|l", &php_v8_context_zv, &value_zv, &max_depth) == FAILURE) {
+        return;
+    }
+
+    if (max_depth < 1) {
+        PHP_V8_THROW_VALUE_EXCEPTION("Max depth should be a positive number");
+        return;
+    }
+
+    PHP_V8_CONTEXT_FETCH_WITH_CHECK(php_v8_context_zv, php_v8_context);
+
+    PHP_V8_ENTER_STORED_ISOLATE(php_v8_context);
+    PHP_V8_ENTER_CONTEXT(php_v8_context);
+
+    PHP_V8_TRY_CATCH(isolate);
+    PHP_V8_INIT_ISOLATE_LIMITS_ON_CONTEXT(php_v8_context);
+
+    phpv8::ValueConverter converter(php_v8_context->php_v8_isolate, context, max_depth);
+
+    v8::MaybeLocal<v8::Value> maybe_local = converter.fromPhp(value_zv);
+
+    PHP_V8_MAYBE_CATCH(php_v8_context, try_catch);
+
+    if (EG(exception)) {
+        return;
+    }
+
+    PHP_V8_THROW_VALUE_EXCEPTION_WHEN_EMPTY(maybe_local, "Failed to convert");
+
+    php_v8_get_or_create_value(return_value, maybe_local.ToLocalChecked(), php_v8_context->php_v8_isolate);
+}
+
+static PHP_METHOD(Value, toPhp) {
+    zval *php_v8_context_zv;
+    zend_long max_depth = PHP_V8_VALUE_CONVERTER_DEFAULT_MAX_DEPTH;
+
+    if (zend_parse_parameters(ZEND_NUM_ARGS(), "o|l", &php_v8_context_zv, &max_depth) == FAILURE) {
+        return;
+    }
+
+    if (max_depth < 1) {
+        PHP_V8_THROW_VALUE_EXCEPTION("Max depth should be a positive number");
+        return;
+    }
+
+    PHP_V8_CONTEXT_FETCH_WITH_CHECK(php_v8_context_zv, php_v8_context);
+    PHP_V8_VALUE_FETCH_WITH_CHECK(getThis(), php_v8_value);
+
+    PHP_V8_DATA_ISOLATES_CHECK(php_v8_value, php_v8_context);
+
+    PHP_V8_ENTER_STORED_ISOLATE(php_v8_context);
+    PHP_V8_ENTER_CONTEXT(php_v8_context);
+
+    PHP_V8_TRY_CATCH(isolate);
+    PHP_V8_INIT_ISOLATE_LIMITS_ON_CONTEXT(php_v8_context);
+
+    phpv8::ValueConverter converter(php_v8_context->php_v8_isolate, context, max_depth);
+
+    bool converted = converter.toPhp(php_v8_value_get_local(php_v8_value), return_value);
+
+    PHP_V8_MAYBE_CATCH(php_v8_context, try_catch);
+
+    if (!converted && !EG(exception)) {
+        PHP_V8_THROW_VALUE_EXCEPTION("Failed to convert");
+    }
+}
+
+
 PHP_V8_ZEND_BEGIN_ARG_WITH_CONSTRUCTOR_INFO_EX(arginfo___construct, 1)
                 ZEND_ARG_OBJ_INFO(0, isolate, V8\\Isolate, 0)
 ZEND_END_ARG_INFO()
@@ -1074,6 +1184,17 @@ PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_instanceOf, ZEND_RETURN_V
                 ZEND_ARG_OBJ_INFO(0, object, V8\\ObjectValue, 0)
 ZEND_END_ARG_INFO()
 
+PHP_V8_ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_fromPhp, ZEND_RETURN_VALUE, 2, V8\\Value, 0)
+                ZEND_ARG_OBJ_INFO(0, context, V8\\Context, 0)
+                ZEND_ARG_INFO(0, value)
+                ZEND_ARG_TYPE_INFO(0, max_depth, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_INFO_EX(arginfo_toPhp, ZEND_SEND_BY_VAL, ZEND_RETURN_VALUE, 1)
+                ZEND_ARG_OBJ_INFO(0, context, V8\\Context, 0)
+                ZEND_ARG_TYPE_INFO(0, max_depth, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
 
 static const zend_function_entry php_v8_value_methods[] = {
 //        PHP_V8_ME(Value, __construct,  ZEND_ACC_PRIVATE | ZEND_ACC_CTOR)
@@ -1148,6 +1269,8 @@ static const zend_function_entry php_v8_value_methods[] = {
         PHP_V8_ME(Value, sameValue,           ZEND_ACC_PUBLIC)
         PHP_V8_ME(Value, typeOf,              ZEND_ACC_PUBLIC)
         PHP_V8_ME(Value, instanceOf,          ZEND_ACC_PUBLIC)
+        PHP_V8_ME(Value, fromPhp,             ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+        PHP_V8_ME(Value, toPhp,               ZEND_ACC_PUBLIC)
 
         PHP_FE_END
 };
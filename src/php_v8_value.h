@@ -37,6 +37,8 @@ inline php_v8_value_t *php_v8_value_fetch_object(zend_object *obj);
 extern zend_class_entry *php_v8_get_class_entry_from_value(v8::Local<v8::Value> value);
 extern php_v8_value_t *php_v8_create_value(zval *return_value, v8::Local<v8::Value> value, php_v8_isolate_t *php_v8_isolate);
 extern php_v8_value_t *php_v8_get_or_create_value(zval *return_value, v8::Local<v8::Value> local_value, php_v8_isolate_t *php_v8_isolate);
+extern phpv8::PersistentData *php_v8_value_get_persistent_data(php_v8_value_t *php_v8_value);
+extern void php_v8_get_or_unwrap_value(zval *return_value, v8::Local<v8::Value> local_value, php_v8_context_t *php_v8_context);
 
 #define PHP_V8_VALUE_FETCH(zv) php_v8_value_fetch_object(Z_OBJ_P(zv))
 #define PHP_V8_VALUE_FETCH_INTO(pzval, into) php_v8_value_t *(into) = PHP_V8_VALUE_FETCH((pzval));
@@ -101,8 +103,13 @@ struct _php_v8_value_t {
 
     uint32_t isolate_handle;
 
+    // non-zero while wrapper is registered in isolate object wrappers map (v8 never generates zero identity hash)
+    int identity_hash;
+
     bool is_weak;
-    v8::Persistent<v8::Value> *persistent;
+    // empty handle as object memory is zero-filled on creation, moved to heap only when value made weak
+    v8::Persistent<v8::Value> persistent;
+    // allocated on demand, only values with callbacks or adjusted external memory need it
     phpv8::PersistentData *persistent_data;
     zval exception;
 
@@ -117,7 +124,7 @@ inline php_v8_value_t *php_v8_value_fetch_object(zend_object *obj) {
 }
 
 inline v8::Local<v8::Value> php_v8_value_get_local(php_v8_value_t *php_v8_value) {
-    return v8::Local<v8::Value>::New(php_v8_value->php_v8_isolate->isolate, *php_v8_value->persistent);
+    return v8::Local<v8::Value>::New(php_v8_value->php_v8_isolate->isolate, php_v8_value->persistent);
 };
 
 template<class T>
@@ -0,0 +1,384 @@
+/*
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "php_v8_value_converter.h"
+#include "php_v8_exceptions.h"
+#include "php_v8_object.h"
+#include "php_v8_string.h"
+#include "php_v8_value.h"
+#include "php_v8.h"
+#include <algorithm>
+#include <cmath>
+
+extern "C" {
+#include "zend_interfaces.h"
+}
+
+// 2^53 - 1, integral doubles beyond that are not exact anyway
+#define PHP_V8_MAX_SAFE_INTEGER 9007199254740991.0
+
+
+static zend_class_entry *php_v8_value_converter_json_serializable_ce() {
+    // ext/json may be built as shared or disabled at all on php 7, so we don't link against it
+    return (zend_class_entry *) zend_hash_str_find_ptr(CG(class_table), ZEND_STRL("jsonserializable"));
+}
+
+phpv8::ValueConverter::ValueConverter(php_v8_isolate_t *php_v8_isolate, v8::Local<v8::Context> context, zend_long max_depth)
+        : php_v8_isolate(php_v8_isolate), isolate(php_v8_isolate->isolate), context(context), max_depth(max_depth) {
+}
+
+bool phpv8::ValueConverter::enterPhp(void *ptr) {
+    if (php_path.size() >= static_cast<size_t>(max_depth)) {
+        zend_throw_exception_ex(php_v8_value_exception_class_entry, 0, "Maximum nesting depth of " ZEND_LONG_FMT " exceeded", max_depth);
+        return false;
+    }
+
+    if (std::find(php_path.begin(), php_path.end(), ptr) != php_path.end()) {
+        PHP_V8_THROW_VALUE_EXCEPTION("Unable to convert circular structure");
+        return false;
+    }
+
+    php_path.push_back(ptr);
+
+    return true;
+}
+
+bool phpv8::ValueConverter::enterJs(v8::Local<v8::Object> object) {
+    if (js_path.size() >= static_cast<size_t>(max_depth)) {
+        zend_throw_exception_ex(php_v8_value_exception_class_entry, 0, "Maximum nesting depth of " ZEND_LONG_FMT " exceeded", max_depth);
+        return false;
+    }
+
+    for (auto const &parent : js_path) {
+        if (parent == object) {
+            PHP_V8_THROW_VALUE_EXCEPTION("Unable to convert circular structure");
+            return false;
+        }
+    }
+
+    js_path.push_back(object);
+
+    return true;
+}
+
+v8::MaybeLocal<v8::Value> phpv8::ValueConverter::fromPhp(zval *value) {
+    ZVAL_DEREF(value);
+
+    switch (Z_TYPE_P(value)) {
+        case IS_UNDEF:
+        case IS_NULL:
+            return v8::Null(isolate);
+        case IS_FALSE:
+            return v8::False(isolate);
+        case IS_TRUE:
+            return v8::True(isolate);
+        case IS_LONG:
+            if (Z_LVAL_P(value) >= INT32_MIN && Z_LVAL_P(value) <= INT32_MAX) {
+                return v8::Integer::New(isolate, static_cast<int32_t>(Z_LVAL_P(value)));
+            }
+
+            return v8::Number::New(isolate, static_cast<double>(Z_LVAL_P(value)));
+        case IS_DOUBLE:
+            return v8::Number::New(isolate, Z_DVAL_P(value));
+        case IS_STRING:
+            if (Z_STRLEN_P(value) > v8::String::kMaxLength) {
+                PHP_V8_THROW_VALUE_EXCEPTION("String is too long");
+                return v8::MaybeLocal<v8::Value>();
+            }
+
+            return v8::String::NewFromUtf8(isolate, Z_STRVAL_P(value), v8::NewStringType::kNormal, static_cast<int>(Z_STRLEN_P(value)));
+        case IS_ARRAY:
+            return fromPhpArray(Z_ARRVAL_P(value));
+        case IS_OBJECT:
+            return fromPhpObject(value);
+        default:
+            zend_throw_exception_ex(php_v8_value_exception_class_entry, 0, "Unable to convert value of type %s", zend_zval_type_name(value));
+            return v8::MaybeLocal<v8::Value>();
+    }
+}
+
+v8::MaybeLocal<v8::Value> phpv8::ValueConverter::fromPhpArray(HashTable *ht) {
+    if (!enterPhp(ht)) {
+        return v8::MaybeLocal<v8::Value>();
+    }
+
+    v8::MaybeLocal<v8::Value> result = fromPhpHashTable(ht, false);
+
+    php_path.pop_back();
+
+    return result;
+}
+
+v8::MaybeLocal<v8::Value> phpv8::ValueConverter::fromPhpHashTable(HashTable *ht, bool skip_mangled) {
+    v8::EscapableHandleScope handle_scope(isolate);
+
+    zend_ulong index;
+    zend_string *key;
+    zval *item;
+
+    bool is_list = !skip_mangled;
+    zend_ulong expected = 0;
+
+    if (is_list) {
+        ZEND_HASH_FOREACH_KEY(ht, index, key) {
+            if (key || index != expected++) {
+                is_list = false;
+                break;
+            }
+        } ZEND_HASH_FOREACH_END();
+    }
+
+    if (is_list) {
+        v8::Local<v8::Array> array = v8::Array::New(isolate, static_cast<int>(zend_hash_num_elements(ht)));
+        uint32_t i = 0;
+
+        ZEND_HASH_FOREACH_VAL_IND(ht, item) {
+            v8::Local<v8::Value> local_item;
+
+            if (!fromPhp(item).ToLocal(&local_item) || array->CreateDataProperty(context, i++, local_item).IsNothing()) {
+                return v8::MaybeLocal<v8::Value>();
+            }
+        } ZEND_HASH_FOREACH_END();
+
+        return handle_scope.Escape(array);
+    }
+
+    v8::Local<v8::Object> object = v8::Object::New(isolate);
+
+    ZEND_HASH_FOREACH_KEY_VAL_IND(ht, index, key, item) {
+        v8::Local<v8::Value> local_item;
+        v8::Maybe<bool> created = v8::Nothing<bool>();
+
+        if (key && skip_mangled && ZSTR_LEN(key) && ZSTR_VAL(key)[0] == '\0') {
+            // private and protected properties
+            continue;
+        }
+
+        if (!fromPhp(item).ToLocal(&local_item)) {
+            return v8::MaybeLocal<v8::Value>();
+        }
+
+        if (!key && index < UINT32_MAX) {
+            created = object->CreateDataProperty(context, static_cast<uint32_t>(index), local_item);
+        } else {
+            v8::MaybeLocal<v8::String> maybe_local_key;
+
+            if (key) {
+                maybe_local_key = v8::String::NewFromUtf8(isolate, ZSTR_VAL(key), v8::NewStringType::kNormal, static_cast<int>(ZSTR_LEN(key)));
+            } else {
+                char buf[MAX_LENGTH_OF_LONG + 1];
+                char *res = zend_print_long_to_buf(buf + sizeof(buf) - 1, static_cast<zend_long>(index));
+
+                maybe_local_key = v8::String::NewFromUtf8(isolate, res, v8::NewStringType::kNormal, static_cast<int>(buf + sizeof(buf) - 1 - res));
+            }
+
+            v8::Local<v8::String> local_key;
+
+            if (maybe_local_key.ToLocal(&local_key)) {
+                created = object->CreateDataProperty(context, local_key, local_item);
+            }
+        }
+
+        if (created.IsNothing()) {
+            return v8::MaybeLocal<v8::Value>();
+        }
+    } ZEND_HASH_FOREACH_END();
+
+    return handle_scope.Escape(object);
+}
+
+v8::MaybeLocal<v8::Value> phpv8::ValueConverter::fromPhpObject(zval *value) {
+    if (instanceof_function(Z_OBJCE_P(value), php_v8_value_class_entry)) {
+        PHP_V8_VALUE_FETCH_INTO(value, php_v8_value);
+
+        if (php_v8_value->persistent.IsEmpty()) {
+            PHP_V8_THROW_EXCEPTION(PHP_V8_EMPTY_VALUE_MSG);
+            return v8::MaybeLocal<v8::Value>();
+        }
+
+        if (NULL == php_v8_value->php_v8_isolate || php_v8_value->php_v8_isolate->isolate != isolate) {
+            PHP_V8_THROW_EXCEPTION(PHP_V8_ISOLATES_MISMATCH_MSG);
+            return v8::MaybeLocal<v8::Value>();
+        }
+
+        return php_v8_value_get_local(php_v8_value);
+    }
+
+    if (!enterPhp(Z_OBJ_P(value))) {
+        return v8::MaybeLocal<v8::Value>();
+    }
+
+    v8::MaybeLocal<v8::Value> result;
+    zend_class_entry *json_serializable_ce = php_v8_value_converter_json_serializable_ce();
+
+    if (json_serializable_ce && instanceof_function(Z_OBJCE_P(value), json_serializable_ce)) {
+        zval serialized;
+        ZVAL_UNDEF(&serialized);
+
+        zend_call_method_with_0_params(value, Z_OBJCE_P(value), NULL, "jsonserialize", &serialized);
+
+        if (!EG(exception)) {
+            if (Z_TYPE(serialized) == IS_OBJECT && Z_OBJ(serialized) == Z_OBJ_P(value)) {
+                // object serializes to itself, so take its properties, just like json_encode() does
+                HashTable *properties = Z_OBJPROP_P(value);
+                result = properties ? fromPhpHashTable(properties, true) : v8::Object::New(isolate);
+            } else {
+                result = fromPhp(&serialized);
+            }
+        }
+
+        zval_ptr_dtor(&serialized);
+    } else {
+        HashTable *properties = Z_OBJPROP_P(value);
+        result = properties ? fromPhpHashTable(properties, true) : v8::Object::New(isolate);
+    }
+
+    php_path.pop_back();
+
+    return result;
+}
+
+bool phpv8::ValueConverter::toPhpScalar(v8::Local<v8::Value> value, zval *retval) {
+    if (value->IsUndefined() || value->IsNull()) {
+        ZVAL_NULL(retval);
+        return true;
+    }
+
+    if (value->IsBoolean()) {
+        ZVAL_BOOL(retval, value->IsTrue());
+        return true;
+    }
+
+    if (value->IsInt32()) {
+        ZVAL_LONG(retval, v8::Local<v8::Int32>::Cast(value)->Value());
+        return true;
+    }
+
+    if (value->IsNumber()) {
+        double number = v8::Local<v8::Number>::Cast(value)->Value();
+
+        if (std::isfinite(number) && std::trunc(number) == number && std::fabs(number) <= PHP_V8_MAX_SAFE_INTEGER
+            && number >= ZEND_LONG_MIN && number <= ZEND_LONG_MAX) {
+            ZVAL_LONG(retval, static_cast<zend_long>(number));
+        } else {
+            ZVAL_DOUBLE(retval, number);
+        }
+
+        return true;
+    }
+
+    if (value->IsString()) {
+        ZVAL_STR(retval, php_v8_string_to_zend_string(v8::Local<v8::String>::Cast(value)));
+        return true;
+    }
+
+    return false;
+}
+
+bool phpv8::ValueConverter::toPhp(v8::Local<v8::Value> value, zval *retval) {
+    if (toPhpScalar(value, retval)) {
+        return true;
+    }
+
+    if (value->IsArray()) {
+        return toPhpArray(v8::Local<v8::Array>::Cast(value), retval);
+    }
+
+    if (value->IsObject() && php_v8_get_class_entry_from_value(value) == php_v8_object_class_entry) {
+        return toPhpObject(v8::Local<v8::Object>::Cast(value), retval);
+    }
+
+    // functions, symbols, dates, maps and other values that have no php counterpart are passed as is
+    php_v8_get_or_create_value(retval, value, php_v8_isolate);
+
+    return true;
+}
+
+bool phpv8::ValueConverter::toPhpArray(v8::Local<v8::Array> array, zval *retval) {
+    if (!enterJs(array)) {
+        return false;
+    }
+
+    v8::HandleScope handle_scope(isolate);
+
+    uint32_t length = array->Length();
+
+    array_init_size(retval, length);
+
+    for (uint32_t i = 0; i < length; i++) {
+        v8::Local<v8::Value> local_item;
+        zval item;
+
+        if (!array->Get(context, i).ToLocal(&local_item) || !toPhp(local_item, &item)) {
+            zval_ptr_dtor(retval);
+            ZVAL_NULL(retval);
+            js_path.pop_back();
+            return false;
+        }
+
+        zend_hash_next_index_insert_new(Z_ARRVAL_P(retval), &item);
+    }
+
+    js_path.pop_back();
+
+    return true;
+}
+
+bool phpv8::ValueConverter::toPhpObject(v8::Local<v8::Object> object, zval *retval) {
+    if (!enterJs(object)) {
+        return false;
+    }
+
+    v8::HandleScope handle_scope(isolate);
+
+    v8::Local<v8::Array> keys;
+
+    if (!object->GetOwnPropertyNames(context).ToLocal(&keys)) {
+        js_path.pop_back();
+        return false;
+    }
+
+    uint32_t length = keys->Length();
+
+    array_init_size(retval, length);
+
+    for (uint32_t i = 0; i < length; i++) {
+        v8::Local<v8::Value> local_key;
+        v8::Local<v8::Value> local_item;
+        zval item;
+
+        if (!keys->Get(context, i).ToLocal(&local_key)
+            || !object->Get(context, local_key).ToLocal(&local_item)
+            || !toPhp(local_item, &item)) {
+            zval_ptr_dtor(retval);
+            ZVAL_NULL(retval);
+            js_path.pop_back();
+            return false;
+        }
+
+        if (local_key->IsUint32()) {
+            zend_hash_index_update(Z_ARRVAL_P(retval), v8::Local<v8::Uint32>::Cast(local_key)->Value(), &item);
+        } else {
+            zend_string *key = php_v8_string_to_zend_string(v8::Local<v8::String>::Cast(local_key));
+            zend_symtable_update(Z_ARRVAL_P(retval), key, &item);
+            zend_string_release(key);
+        }
+    }
+
+    js_path.pop_back();
+
+    return true;
+}
@@ -0,0 +1,76 @@
+/*
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+#ifndef PHP_V8_VALUE_CONVERTER_H
+#define PHP_V8_VALUE_CONVERTER_H
+
+namespace phpv8 {
+    class ValueConverter;
+}
+
+#include "php_v8_isolate.h"
+#include <v8.h>
+#include <vector>
+
+extern "C" {
+#include "php.h"
+
+#ifdef ZTS
+#include "TSRM.h"
+#endif
+}
+
+#define PHP_V8_VALUE_CONVERTER_DEFAULT_MAX_DEPTH 512
+
+
+namespace phpv8 {
+
+    /**
+     * Deep conversion between php values (scalars, arrays, JsonSerializable and plain objects) and js values, done
+     * natively within single isolate and context entry.
+     *
+     * On failure either php exception is thrown (unsupported value, cycle, depth limit) or js exception is left
+     * pending on the surrounding v8::TryCatch (e.g. when js getter throws), so caller should check both.
+     */
+    class ValueConverter {
+    public:
+        ValueConverter(php_v8_isolate_t *php_v8_isolate, v8::Local<v8::Context> context, zend_long max_depth);
+
+        v8::MaybeLocal<v8::Value> fromPhp(zval *value);
+        bool toPhp(v8::Local<v8::Value> value, zval *retval);
+
+        /**
+         * Convert js primitive (except symbol) to php scalar or null, returns false without touching retval otherwise
+         */
+        static bool toPhpScalar(v8::Local<v8::Value> value, zval *retval);
+    private:
+        v8::MaybeLocal<v8::Value> fromPhpArray(HashTable *ht);
+        v8::MaybeLocal<v8::Value> fromPhpHashTable(HashTable *ht, bool skip_mangled);
+        v8::MaybeLocal<v8::Value> fromPhpObject(zval *value);
+
+        bool toPhpArray(v8::Local<v8::Array> array, zval *retval);
+        bool toPhpObject(v8::Local<v8::Object> object, zval *retval);
+
+        bool enterPhp(void *ptr);
+        bool enterJs(v8::Local<v8::Object> object);
+
+        php_v8_isolate_t *php_v8_isolate;
+        v8::Isolate *isolate;
+        v8::Local<v8::Context> context;
+        zend_long max_depth;
+
+        std::vector<void *> php_path;
+        std::vector<v8::Local<v8::Object>> js_path;
+    };
+}
+
+#endif //PHP_V8_VALUE_CONVERTER_H
@@ -0,0 +1,1005 @@
+/*
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "php_v8_wire_format.h"
+#include "php_v8_exceptions.h"
+
+#include <cstring>
+#include <cmath>
+
+// serialization tags, see src/value-serializer.cc in v8 sources
+#define PHP_V8_WIRE_TAG_VERSION                 0xFF
+#define PHP_V8_WIRE_TAG_PADDING                 '\0'
+#define PHP_V8_WIRE_TAG_VERIFY_OBJECT_COUNT     '?'
+#define PHP_V8_WIRE_TAG_THE_HOLE                '-'
+#define PHP_V8_WIRE_TAG_UNDEFINED               '_'
+#define PHP_V8_WIRE_TAG_NULL                    '0'
+#define PHP_V8_WIRE_TAG_TRUE                    'T'
+#define PHP_V8_WIRE_TAG_FALSE                   'F'
+#define PHP_V8_WIRE_TAG_INT32                   'I'
+#define PHP_V8_WIRE_TAG_UINT32                  'U'
+#define PHP_V8_WIRE_TAG_DOUBLE                  'N'
+#define PHP_V8_WIRE_TAG_UTF8_STRING             'S'
+#define PHP_V8_WIRE_TAG_ONE_BYTE_STRING         '"'
+#define PHP_V8_WIRE_TAG_TWO_BYTE_STRING         'c'
+#define PHP_V8_WIRE_TAG_OBJECT_REFERENCE        '^'
+#define PHP_V8_WIRE_TAG_BEGIN_JS_OBJECT         'o'
+#define PHP_V8_WIRE_TAG_END_JS_OBJECT           '{'
+#define PHP_V8_WIRE_TAG_BEGIN_SPARSE_JS_ARRAY   'a'
+#define PHP_V8_WIRE_TAG_END_SPARSE_JS_ARRAY     '@'
+#define PHP_V8_WIRE_TAG_BEGIN_DENSE_JS_ARRAY    'A'
+#define PHP_V8_WIRE_TAG_END_DENSE_JS_ARRAY      '$'
+#define PHP_V8_WIRE_TAG_DATE                    'D'
+#define PHP_V8_WIRE_TAG_TRUE_OBJECT             'y'
+#define PHP_V8_WIRE_TAG_FALSE_OBJECT            'x'
+#define PHP_V8_WIRE_TAG_NUMBER_OBJECT           'n'
+#define PHP_V8_WIRE_TAG_STRING_OBJECT           's'
+#define PHP_V8_WIRE_TAG_REGEXP                  'R'
+#define PHP_V8_WIRE_TAG_BEGIN_JS_MAP            ';'
+#define PHP_V8_WIRE_TAG_END_JS_MAP              ':'
+#define PHP_V8_WIRE_TAG_BEGIN_JS_SET            '\''
+#define PHP_V8_WIRE_TAG_END_JS_SET              ','
+#define PHP_V8_WIRE_TAG_ARRAY_BUFFER            'B'
+#define PHP_V8_WIRE_TAG_ARRAY_BUFFER_VIEW       'V'
+#define PHP_V8_WIRE_TAG_HOST_OBJECT             '\\'
+
+#define PHP_V8_WIRE_VIEW_TAG_INT8_ARRAY           'b'
+#define PHP_V8_WIRE_VIEW_TAG_UINT8_ARRAY          'B'
+#define PHP_V8_WIRE_VIEW_TAG_UINT8_CLAMPED_ARRAY  'C'
+#define PHP_V8_WIRE_VIEW_TAG_INT16_ARRAY          'w'
+#define PHP_V8_WIRE_VIEW_TAG_UINT16_ARRAY         'W'
+#define PHP_V8_WIRE_VIEW_TAG_INT32_ARRAY          'd'
+#define PHP_V8_WIRE_VIEW_TAG_UINT32_ARRAY         'D'
+#define PHP_V8_WIRE_VIEW_TAG_FLOAT32_ARRAY        'f'
+#define PHP_V8_WIRE_VIEW_TAG_FLOAT64_ARRAY        'F'
+#define PHP_V8_WIRE_VIEW_TAG_DATA_VIEW            '?'
+
+// v8::RegExp::Flags
+#define PHP_V8_WIRE_REGEXP_GLOBAL       1
+#define PHP_V8_WIRE_REGEXP_IGNORE_CASE  2
+#define PHP_V8_WIRE_REGEXP_MULTILINE    4
+#define PHP_V8_WIRE_REGEXP_STICKY       8
+#define PHP_V8_WIRE_REGEXP_UNICODE      16
+#define PHP_V8_WIRE_REGEXP_DOT_ALL      32
+
+
+static inline void php_v8_wire_format_set_number(zval *value, int32_t number) {
+    ZVAL_LONG(value, number);
+}
+
+static inline void php_v8_wire_format_set_number(zval *value, uint32_t number) {
+    if (static_cast<uint64_t>(number) > static_cast<uint64_t>(ZEND_LONG_MAX)) {
+        ZVAL_DOUBLE(value, number);
+        return;
+    }
+
+    ZVAL_LONG(value, static_cast<zend_long>(number));
+}
+
+static inline void php_v8_wire_format_set_number(zval *value, float number) {
+    ZVAL_DOUBLE(value, number);
+}
+
+static inline void php_v8_wire_format_set_number(zval *value, double number) {
+    ZVAL_DOUBLE(value, number);
+}
+
+template<class T, class N = T>
+static bool php_v8_wire_format_read_elements(zval *value, const char *data, size_t byte_length) {
+    if (byte_length % sizeof(T)) {
+        return false;
+    }
+
+    size_t length = byte_length / sizeof(T);
+    zval element_zv;
+    T element;
+
+    array_init_size(value, static_cast<uint32_t>(length));
+
+    for (size_t i = 0; i < length; i++) {
+        // view data is not guaranteed to be aligned
+        memcpy(&element, data + i * sizeof(T), sizeof(T));
+
+        php_v8_wire_format_set_number(&element_zv, static_cast<N>(element));
+        zend_hash_next_index_insert_new(Z_ARRVAL_P(value), &element_zv);
+    }
+
+    return true;
+}
+
+static bool php_v8_wire_format_add_property(HashTable *ht, zval *key, zval *value) {
+    switch (Z_TYPE_P(key)) {
+        case IS_LONG:
+            zend_hash_index_update(ht, static_cast<zend_ulong>(Z_LVAL_P(key)), value);
+            return true;
+        case IS_DOUBLE:
+            // array indexes beyond smi range are written as doubles, all other keys are strings
+            if (!zend_finite(Z_DVAL_P(key)) || floor(Z_DVAL_P(key)) != Z_DVAL_P(key) || !ZEND_DOUBLE_FITS_LONG(Z_DVAL_P(key))) {
+                return false;
+            }
+
+            zend_hash_index_update(ht, static_cast<zend_ulong>(zend_dval_to_lval(Z_DVAL_P(key))), value);
+            return true;
+        case IS_STRING:
+            zend_symtable_update(ht, Z_STR_P(key), value);
+            return true;
+        default:
+            return false;
+    }
+}
+
+
+namespace phpv8 {
+    WireFormatDecoder::~WireFormatDecoder() {
+        for (auto &object : objects) {
+            zval_ptr_dtor(&object);
+        }
+    }
+
+    bool WireFormatDecoder::decode(zval *return_value) {
+        uint32_t version;
+        zval value;
+
+        if (position == end || static_cast<uint8_t>(*position) != PHP_V8_WIRE_TAG_VERSION) {
+            return error("Serialized data has no version header");
+        }
+
+        position++;
+
+        if (!readVarint32(&version)) {
+            return false;
+        }
+
+        if (version != PHP_V8_WIRE_FORMAT_VERSION) {
+            return error("Unsupported serialization format version %u", version);
+        }
+
+        ZVAL_UNDEF(&value);
+
+        if (!readValue(&value)) {
+            return false;
+        }
+
+        ZVAL_COPY_VALUE(return_value, &value);
+
+        return true;
+    }
+
+    bool WireFormatDecoder::readValue(zval *value) {
+        if (readValueOfAnyType(value)) {
+            return true;
+        }
+
+        // partially decoded value is not needed anymore
+        zval_ptr_dtor(value);
+        ZVAL_UNDEF(value);
+
+        return false;
+    }
+
+    bool WireFormatDecoder::readValueOfAnyType(zval *value) {
+        uint8_t tag;
+
+        if (!readTag(&tag)) {
+            return false;
+        }
+
+        // object count is not verified, and any number of such tags may precede value, so they are skipped in a loop
+        // rather than recursively, which would let long run of them exhaust the stack
+        while (tag == PHP_V8_WIRE_TAG_VERIFY_OBJECT_COUNT) {
+            uint32_t ignored;
+
+            if (!readVarint32(&ignored) || !readTag(&tag)) {
+                return false;
+            }
+        }
+
+        switch (tag) {
+            case PHP_V8_WIRE_TAG_UNDEFINED:
+            case PHP_V8_WIRE_TAG_NULL:
+                ZVAL_NULL(value);
+                return true;
+            case PHP_V8_WIRE_TAG_TRUE:
+                ZVAL_TRUE(value);
+                return true;
+            case PHP_V8_WIRE_TAG_FALSE:
+                ZVAL_FALSE(value);
+                return true;
+            case PHP_V8_WIRE_TAG_INT32: {
+                int32_t number;
+
+                if (!readZigZag32(&number)) {
+                    return false;
+                }
+
+                php_v8_wire_format_set_number(value, number);
+                return true;
+            }
+            case PHP_V8_WIRE_TAG_UINT32: {
+                uint32_t number;
+
+                if (!readVarint32(&number)) {
+                    return false;
+                }
+
+                php_v8_wire_format_set_number(value, number);
+                return true;
+            }
+            case PHP_V8_WIRE_TAG_DOUBLE: {
+                double number;
+
+                if (!readDouble(&number)) {
+                    return false;
+                }
+
+                ZVAL_DOUBLE(value, number);
+                return true;
+            }
+            case PHP_V8_WIRE_TAG_UTF8_STRING:
+            case PHP_V8_WIRE_TAG_ONE_BYTE_STRING:
+            case PHP_V8_WIRE_TAG_TWO_BYTE_STRING:
+                return readStringOfType(value, tag);
+            case PHP_V8_WIRE_TAG_OBJECT_REFERENCE: {
+                uint32_t id;
+
+                if (!readVarint32(&id)) {
+                    return false;
+                }
+
+                if (id >= objects.size()) {
+                    return error("Invalid object reference");
+                }
+
+                if (Z_ISUNDEF(objects[id])) {
+                    return error("Unable to decode circular structure");
+                }
+
+                ZVAL_COPY(value, &objects[id]);
+
+                return !buffers[id] || maybeReadArrayBufferView(value);
+            }
+            case PHP_V8_WIRE_TAG_BEGIN_JS_OBJECT:
+            case PHP_V8_WIRE_TAG_BEGIN_SPARSE_JS_ARRAY:
+            case PHP_V8_WIRE_TAG_BEGIN_DENSE_JS_ARRAY:
+            case PHP_V8_WIRE_TAG_BEGIN_JS_MAP:
+            case PHP_V8_WIRE_TAG_BEGIN_JS_SET:
+                return readObject(value, tag);
+            case PHP_V8_WIRE_TAG_DATE:
+            case PHP_V8_WIRE_TAG_NUMBER_OBJECT: {
+                uint32_t id = reserveId();
+                double number;
+
+                if (!readDouble(&number)) {
+                    return false;
+                }
+
+                ZVAL_DOUBLE(value, number);
+                assignId(id, value);
+                return true;
+            }
+            case PHP_V8_WIRE_TAG_TRUE_OBJECT:
+            case PHP_V8_WIRE_TAG_FALSE_OBJECT: {
+                ZVAL_BOOL(value, tag == PHP_V8_WIRE_TAG_TRUE_OBJECT);
+                assignId(reserveId(), value);
+                return true;
+            }
+            case PHP_V8_WIRE_TAG_STRING_OBJECT: {
+                uint32_t id = reserveId();
+
+                if (!readString(value)) {
+                    return false;
+                }
+
+                assignId(id, value);
+                return true;
+            }
+            case PHP_V8_WIRE_TAG_REGEXP:
+                return readRegExp(value);
+            case PHP_V8_WIRE_TAG_ARRAY_BUFFER: {
+                uint32_t id = reserveId();
+                uint32_t byte_length;
+                const char *data;
+
+                if (!readVarint32(&byte_length) || !readRawBytes(byte_length, &data)) {
+                    return false;
+                }
+
+                ZVAL_STRINGL(value, data, byte_length);
+                assignId(id, value, true);
+
+                return maybeReadArrayBufferView(value);
+            }
+            case PHP_V8_WIRE_TAG_HOST_OBJECT:
+                return readHostObject(value);
+            default:
+                break;
+        }
+
+        if (tag >= 0x20 && tag < 0x7F) {
+            return error("Unsupported serialization tag '%c'", tag);
+        }
+
+        return error("Unsupported serialization tag 0x%02x", tag);
+    }
+
+    bool WireFormatDecoder::readObject(zval *value, uint8_t tag) {
+        bool result;
+
+        if (depth >= max_depth) {
+            return error("Maximum nesting depth of %u exceeded", max_depth);
+        }
+
+        depth++;
+
+        switch (tag) {
+            case PHP_V8_WIRE_TAG_BEGIN_JS_OBJECT:
+                result = readJSObject(value);
+                break;
+            case PHP_V8_WIRE_TAG_BEGIN_SPARSE_JS_ARRAY:
+                result = readSparseArray(value);
+                break;
+            case PHP_V8_WIRE_TAG_BEGIN_DENSE_JS_ARRAY:
+                result = readDenseArray(value);
+                break;
+            case PHP_V8_WIRE_TAG_BEGIN_JS_MAP:
+                result = readMap(value);
+                break;
+            default:
+                result = readSet(value);
+                break;
+        }
+
+        depth--;
+
+        return result;
+    }
+
+    bool WireFormatDecoder::readJSObject(zval *value) {
+        uint32_t id = reserveId();
+        uint32_t count;
+        uint32_t num_properties;
+
+        array_init(value);
+
+        if (!readProperties(Z_ARRVAL_P(value), PHP_V8_WIRE_TAG_END_JS_OBJECT, &count) || !readVarint32(&num_properties)) {
+            return false;
+        }
+
+        if (num_properties != count) {
+            return error("Object properties count mismatch");
+        }
+
+        assignId(id, value);
+
+        return true;
+    }
+
+    bool WireFormatDecoder::readProperties(HashTable *ht, uint8_t end_tag, uint32_t *count) {
+        uint8_t tag;
+        zval key;
+        zval property;
+
+        *count = 0;
+
+        while (true) {
+            if (!peekTag(&tag)) {
+                return error("Unexpected end of serialized data");
+            }
+
+            if (tag == end_tag) {
+                position++;
+                return true;
+            }
+
+            ZVAL_UNDEF(&key);
+            ZVAL_UNDEF(&property);
+
+            if (!readValue(&key)) {
+                return false;
+            }
+
+            if (!readValue(&property)) {
+                zval_ptr_dtor(&key);
+                return false;
+            }
+
+            bool added = php_v8_wire_format_add_property(ht, &key, &property);
+
+            zval_ptr_dtor(&key);
+
+            if (!added) {
+                zval_ptr_dtor(&property);
+                return error("Invalid property key");
+            }
+
+            (*count)++;
+        }
+    }
+
+    bool WireFormatDecoder::readDenseArray(zval *value) {
+        uint32_t id = reserveId();
+        uint32_t length;
+        uint32_t count;
+        uint32_t num_properties;
+        uint32_t end_length;
+        uint8_t tag;
+        zval element;
+
+        if (!readVarint32(&length)) {
+            return false;
+        }
+
+        // every element takes at least one byte, so bogus length doesn't make us allocate too much
+        if (length > static_cast<size_t>(end - position)) {
+            return error("Array length is out of range");
+        }
+
+        array_init_size(value, length);
+
+        for (uint32_t i = 0; i < length; i++) {
+            if (!peekTag(&tag)) {
+                return error("Unexpected end of serialized data");
+            }
+
+            if (tag == PHP_V8_WIRE_TAG_THE_HOLE) {
+                position++;
+                continue;
+            }
+
+            ZVAL_UNDEF(&element);
+
+            if (!readValue(&element)) {
+                return false;
+            }
+
+            zend_hash_index_update(Z_ARRVAL_P(value), i, &element);
+        }
+
+        if (!readProperties(Z_ARRVAL_P(value), PHP_V8_WIRE_TAG_END_DENSE_JS_ARRAY, &count)
+            || !readVarint32(&num_properties)
+            || !readVarint32(&end_length)) {
+            return false;
+        }
+
+        if (num_properties != count || end_length != length) {
+            return error("Array properties count mismatch");
+        }
+
+        assignId(id, value);
+
+        return true;
+    }
+
+    bool WireFormatDecoder::readSparseArray(zval *value) {
+        uint32_t id = reserveId();
+        uint32_t length;
+        uint32_t count;
+        uint32_t num_properties;
+        uint32_t end_length;
+
+        if (!readVarint32(&length)) {
+            return false;
+        }
+
+        array_init(value);
+
+        if (!readProperties(Z_ARRVAL_P(value), PHP_V8_WIRE_TAG_END_SPARSE_JS_ARRAY, &count)
+            || !readVarint32(&num_properties)
+            || !readVarint32(&end_length)) {
+            return false;
+        }
+
+        if (num_properties != count || end_length != length) {
+            return error("Array properties count mismatch");
+        }
+
+        assignId(id, value);
+
+        return true;
+    }
+
+    bool WireFormatDecoder::readMap(zval *value) {
+        uint32_t id = reserveId();
+        uint32_t count = 0;
+        uint32_t length;
+        uint8_t tag;
+        zval pair;
+        zval entry;
+
+        array_init(value);
+
+        while (true) {
+            if (!peekTag(&tag)) {
+                return error("Unexpected end of serialized data");
+            }
+
+            if (tag == PHP_V8_WIRE_TAG_END_JS_MAP) {
+                position++;
+                break;
+            }
+
+            array_init_size(&pair, 2);
+            zend_hash_next_index_insert_new(Z_ARRVAL_P(value), &pair);
+
+            // key and value are read right into the pair, so nothing leaks when any of them fails
+            for (int i = 0; i < 2; i++) {
+                ZVAL_UNDEF(&entry);
+
+                if (!readValue(&entry)) {
+                    return false;
+                }
+
+                zend_hash_next_index_insert_new(Z_ARRVAL(pair), &entry);
+            }
+
+            count += 2;
+        }
+
+        if (!readVarint32(&length)) {
+            return false;
+        }
+
+        if (length != count) {
+            return error("Map entries count mismatch");
+        }
+
+        assignId(id, value);
+
+        return true;
+    }
+
+    bool WireFormatDecoder::readSet(zval *value) {
+        uint32_t id = reserveId();
+        uint32_t count = 0;
+        uint32_t length;
+        uint8_t tag;
+        zval entry;
+
+        array_init(value);
+
+        while (true) {
+            if (!peekTag(&tag)) {
+                return error("Unexpected end of serialized data");
+            }
+
+            if (tag == PHP_V8_WIRE_TAG_END_JS_SET) {
+                position++;
+                break;
+            }
+
+            ZVAL_UNDEF(&entry);
+
+            if (!readValue(&entry)) {
+                return false;
+            }
+
+            zend_hash_next_index_insert_new(Z_ARRVAL_P(value), &entry);
+            count++;
+        }
+
+        if (!readVarint32(&length)) {
+            return false;
+        }
+
+        if (length != count) {
+            return error("Set entries count mismatch");
+        }
+
+        assignId(id, value);
+
+        return true;
+    }
+
+    bool WireFormatDecoder::readString(zval *value) {
+        uint8_t tag;
+
+        if (!readTag(&tag)) {
+            return false;
+        }
+
+        if (tag != PHP_V8_WIRE_TAG_UTF8_STRING && tag != PHP_V8_WIRE_TAG_ONE_BYTE_STRING && tag != PHP_V8_WIRE_TAG_TWO_BYTE_STRING) {
+            return error("String expected");
+        }
+
+        return readStringOfType(value, tag);
+    }
+
+    bool WireFormatDecoder::readStringOfType(zval *value, uint8_t tag) {
+        uint32_t byte_length;
+        const char *data;
+
+        if (!readVarint32(&byte_length) || !readRawBytes(byte_length, &data)) {
+            return false;
+        }
+
+        if (tag == PHP_V8_WIRE_TAG_UTF8_STRING) {
+            ZVAL_STRINGL(value, data, byte_length);
+            return true;
+        }
+
+        if (tag == PHP_V8_WIRE_TAG_ONE_BYTE_STRING) {
+            // latin1 chars above ascii range take two bytes in utf8
+            size_t extra = 0;
+
+            for (uint32_t i = 0; i < byte_length; i++) {
+                extra += static_cast<uint8_t>(data[i]) >> 7;
+            }
+
+            if (!extra) {
+                ZVAL_STRINGL(value, data, byte_length);
+                return true;
+            }
+
+            zend_string *str = zend_string_alloc(byte_length + extra, 0);
+            char *out = ZSTR_VAL(str);
+
+            for (uint32_t i = 0; i < byte_length; i++) {
+                uint8_t c = static_cast<uint8_t>(data[i]);
+
+                if (c < 0x80) {
+                    *out++ = c;
+                } else {
+                    *out++ = static_cast<char>(0xC0 | (c >> 6));
+                    *out++ = static_cast<char>(0x80 | (c & 0x3F));
+                }
+            }
+
+            *out = '\0';
+
+            ZVAL_NEW_STR(value, str);
+            return true;
+        }
+
+        if (byte_length % sizeof(uint16_t)) {
+            return error("Invalid two-byte string length");
+        }
+
+        // every utf16 code unit takes up to three bytes in utf8, surrogate pair takes four bytes for two units
+        uint32_t length = byte_length / sizeof(uint16_t);
+        zend_string *str = zend_string_alloc(static_cast<size_t>(length) * 3, 0);
+        char *out = ZSTR_VAL(str);
+        uint16_t unit;
+        uint16_t next;
+
+        for (uint32_t i = 0; i < length; i++) {
+            memcpy(&unit, data + i * sizeof(uint16_t), sizeof(uint16_t));
+
+            uint32_t code_point = unit;
+
+            if (unit >= 0xD800 && unit <= 0xDBFF && i + 1 < length) {
+                memcpy(&next, data + (i + 1) * sizeof(uint16_t), sizeof(uint16_t));
+
+                if (next >= 0xDC00 && next <= 0xDFFF) {
+                    code_point = 0x10000 + ((unit - 0xD800) << 10) + (next - 0xDC00);
+                    i++;
+                }
+            }
+
+            if (code_point >= 0xD800 && code_point <= 0xDFFF) {
+                // lone surrogate, the same as v8 does when it converts string to utf8
+                code_point = 0xFFFD;
+            }
+
+            if (code_point < 0x80) {
+                *out++ = static_cast<char>(code_point);
+            } else if (code_point < 0x800) {
+                *out++ = static_cast<char>(0xC0 | (code_point >> 6));
+                *out++ = static_cast<char>(0x80 | (code_point & 0x3F));
+            } else if (code_point < 0x10000) {
+                *out++ = static_cast<char>(0xE0 | (code_point >> 12));
+                *out++ = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+                *out++ = static_cast<char>(0x80 | (code_point & 0x3F));
+            } else {
+                *out++ = static_cast<char>(0xF0 | (code_point >> 18));
+                *out++ = static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+                *out++ = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+                *out++ = static_cast<char>(0x80 | (code_point & 0x3F));
+            }
+        }
+
+        str = zend_string_truncate(str, static_cast<size_t>(out - ZSTR_VAL(str)), 0);
+        ZSTR_VAL(str)[ZSTR_LEN(str)] = '\0';
+
+        ZVAL_NEW_STR(value, str);
+        return true;
+    }
+
+    bool WireFormatDecoder::readRegExp(zval *value) {
+        uint32_t id = reserveId();
+        uint32_t flags;
+        zval pattern;
+
+        ZVAL_UNDEF(&pattern);
+
+        if (!readString(&pattern)) {
+            zval_ptr_dtor(&pattern);
+            return false;
+        }
+
+        if (!readVarint32(&flags)) {
+            zval_ptr_dtor(&pattern);
+            return false;
+        }
+
+        // flags go in the same order as RegExp.prototype.flags returns them
+        ZVAL_NEW_STR(value, zend_strpprintf(0, "/%s/%s%s%s%s%s%s",
+                                            Z_STRVAL(pattern),
+                                            (flags & PHP_V8_WIRE_REGEXP_GLOBAL) ? "g" : "",
+                                            (flags & PHP_V8_WIRE_REGEXP_IGNORE_CASE) ? "i" : "",
+                                            (flags & PHP_V8_WIRE_REGEXP_MULTILINE) ? "m" : "",
+                                            (flags & PHP_V8_WIRE_REGEXP_DOT_ALL) ? "s" : "",
+                                            (flags & PHP_V8_WIRE_REGEXP_UNICODE) ? "u" : "",
+                                            (flags & PHP_V8_WIRE_REGEXP_STICKY) ? "y" : ""));
+
+        zval_ptr_dtor(&pattern);
+
+        assignId(id, value);
+
+        return true;
+    }
+
+    bool WireFormatDecoder::maybeReadArrayBufferView(zval *value) {
+        uint8_t tag;
+        zval view;
+
+        if (!peekTag(&tag) || tag != PHP_V8_WIRE_TAG_ARRAY_BUFFER_VIEW) {
+            return true;
+        }
+
+        position++;
+
+        ZVAL_UNDEF(&view);
+
+        if (!readArrayBufferView(&view, Z_STR_P(value))) {
+            zval_ptr_dtor(&view);
+            return false;
+        }
+
+        // view is what was serialized, buffer was written just because view needs it
+        zval_ptr_dtor(value);
+        ZVAL_COPY_VALUE(value, &view);
+
+        return true;
+    }
+
+    bool WireFormatDecoder::readArrayBufferView(zval *value, zend_string *buffer) {
+        uint32_t sub_tag;
+        uint32_t byte_offset;
+        uint32_t byte_length;
+
+        if (!readVarint32(&sub_tag) || !readVarint32(&byte_offset) || !readVarint32(&byte_length)) {
+            return false;
+        }
+
+        uint32_t id = reserveId();
+
+        if (byte_offset > ZSTR_LEN(buffer) || byte_length > ZSTR_LEN(buffer) - byte_offset) {
+            return error("Array buffer view is out of buffer range");
+        }
+
+        const char *data = ZSTR_VAL(buffer) + byte_offset;
+        bool result;
+
+        switch (sub_tag) {
+            case PHP_V8_WIRE_VIEW_TAG_DATA_VIEW:
+                ZVAL_STRINGL(value, data, byte_length);
+                result = true;
+                break;
+            case PHP_V8_WIRE_VIEW_TAG_INT8_ARRAY:
+                result = php_v8_wire_format_read_elements<int8_t, int32_t>(value, data, byte_length);
+                break;
+            case PHP_V8_WIRE_VIEW_TAG_UINT8_ARRAY:
+            case PHP_V8_WIRE_VIEW_TAG_UINT8_CLAMPED_ARRAY:
+                result = php_v8_wire_format_read_elements<uint8_t, int32_t>(value, data, byte_length);
+                break;
+            case PHP_V8_WIRE_VIEW_TAG_INT16_ARRAY:
+                result = php_v8_wire_format_read_elements<int16_t, int32_t>(value, data, byte_length);
+                break;
+            case PHP_V8_WIRE_VIEW_TAG_UINT16_ARRAY:
+                result = php_v8_wire_format_read_elements<uint16_t, int32_t>(value, data, byte_length);
+                break;
+            case PHP_V8_WIRE_VIEW_TAG_INT32_ARRAY:
+                result = php_v8_wire_format_read_elements<int32_t>(value, data, byte_length);
+                break;
+            case PHP_V8_WIRE_VIEW_TAG_UINT32_ARRAY:
+                result = php_v8_wire_format_read_elements<uint32_t>(value, data, byte_length);
+                break;
+            case PHP_V8_WIRE_VIEW_TAG_FLOAT32_ARRAY:
+                result = php_v8_wire_format_read_elements<float>(value, data, byte_length);
+                break;
+            case PHP_V8_WIRE_VIEW_TAG_FLOAT64_ARRAY:
+                result = php_v8_wire_format_read_elements<double>(value, data, byte_length);
+                break;
+            default:
+                return error("Unsupported array buffer view tag 0x%02x", sub_tag);
+        }
+
+        if (!result) {
+            return error("Array buffer view length is not a multiple of its element size");
+        }
+
+        assignId(id, value);
+
+        return true;
+    }
+
+    bool WireFormatDecoder::readHostObject(zval *value) {
+        uint32_t id = reserveId();
+        uint32_t byte_length;
+        const char *data;
+
+        if (!readVarint32(&byte_length) || !readRawBytes(byte_length, &data)) {
+            return false;
+        }
+
+        ZVAL_STRINGL(value, data, byte_length);
+
+        if (fci) {
+            zval args[1];
+
+            ZVAL_COPY_VALUE(&args[0], value);
+            ZVAL_UNDEF(value);
+
+            fci->params = args;
+            fci->param_count = 1;
+            fci->retval = value;
+
+            zend_call_function(fci, fci_cache);
+
+            zval_ptr_dtor(&args[0]);
+
+            if (EG(exception)) {
+                return false;
+            }
+
+            if (Z_ISUNDEF_P(value)) {
+                ZVAL_NULL(value);
+            }
+        }
+
+        assignId(id, value);
+
+        return true;
+    }
+
+    bool WireFormatDecoder::readTag(uint8_t *tag) {
+        if (!peekTag(tag)) {
+            return error("Unexpected end of serialized data");
+        }
+
+        position++;
+
+        return true;
+    }
+
+    bool WireFormatDecoder::peekTag(uint8_t *tag) {
+        while (position < end && *position == PHP_V8_WIRE_TAG_PADDING) {
+            position++;
+        }
+
+        if (position == end) {
+            return false;
+        }
+
+        *tag = static_cast<uint8_t>(*position);
+
+        return true;
+    }
+
+    bool WireFormatDecoder::readVarint(uint64_t *value) {
+        uint64_t result = 0;
+        unsigned shift = 0;
+        uint8_t byte;
+
+        do {
+            if (position == end) {
+                return error("Unexpected end of serialized data");
+            }
+
+            if (shift >= 64) {
+                return error("Invalid varint");
+            }
+
+            byte = static_cast<uint8_t>(*position++);
+            result |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            shift += 7;
+        } while (byte & 0x80);
+
+        *value = result;
+
+        return true;
+    }
+
+    bool WireFormatDecoder::readVarint32(uint32_t *value) {
+        uint64_t result;
+
+        if (!readVarint(&result)) {
+            return false;
+        }
+
+        if (result > UINT32_MAX) {
+            return error("Invalid varint");
+        }
+
+        *value = static_cast<uint32_t>(result);
+
+        return true;
+    }
+
+    bool WireFormatDecoder::readZigZag32(int32_t *value) {
+        uint32_t encoded;
+
+        if (!readVarint32(&encoded)) {
+            return false;
+        }
+
+        *value = static_cast<int32_t>((encoded >> 1) ^ -(encoded & 1));
+
+        return true;
+    }
+
+    bool WireFormatDecoder::readDouble(double *value) {
+        const char *data;
+
+        if (!readRawBytes(sizeof(double), &data)) {
+            return false;
+        }
+
+        memcpy(value, data, sizeof(double));
+
+        return true;
+    }
+
+    bool WireFormatDecoder::readRawBytes(size_t length, const char **data) {
+        if (length > static_cast<size_t>(end - position)) {
+            return error("Unexpected end of serialized data");
+        }
+
+        *data = position;
+        position += length;
+
+        return true;
+    }
+
+    uint32_t WireFormatDecoder::reserveId() {
+        zval object;
+
+        ZVAL_UNDEF(&object);
+
+        objects.push_back(object);
+        buffers.push_back(false);
+
+        return static_cast<uint32_t>(objects.size() - 1);
+    }
+
+    void WireFormatDecoder::assignId(uint32_t id, zval *value, bool is_buffer) {
+        ZVAL_COPY(&objects[id], value);
+        buffers[id] = is_buffer;
+    }
+
+    bool WireFormatDecoder::error(const char *format, ...) {
+        va_list args;
+
+        va_start(args, format);
+        zend_string *message = zend_vstrpprintf(0, format, args);
+        va_end(args);
+
+        zend_throw_exception(php_v8_value_exception_class_entry, ZSTR_VAL(message), 0);
+        zend_string_release(message);
+
+        return false;
+    }
+}
@@ -0,0 +1,100 @@
+/*
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+#ifndef PHP_V8_WIRE_FORMAT_H
+#define PHP_V8_WIRE_FORMAT_H
+
+namespace phpv8 {
+    class WireFormatDecoder;
+}
+
+#include <vector>
+#include <cstdint>
+
+extern "C" {
+#include "php.h"
+
+#ifdef ZTS
+#include "TSRM.h"
+#endif
+}
+
+// v8::ValueSerializer format version which decoder understands
+#define PHP_V8_WIRE_FORMAT_VERSION 13
+
+
+namespace phpv8 {
+
+    /**
+     * Decodes data written by v8::ValueSerializer straight into php values, without entering any isolate.
+     *
+     * Objects and sparse arrays become arrays, dense arrays become lists (holes are skipped), Maps become lists
+     * of [key, value] pairs and Sets become lists, Dates become float timestamps in milliseconds, boxed primitives
+     * are unboxed, RegExps become "/source/flags" strings, ArrayBuffers and DataViews become strings of their bytes
+     * and typed arrays become lists of numbers. Host objects data is given to optional callback, or returned as is.
+     *
+     * Since php arrays are values, object referenced more than once is decoded as a copy, and circular references
+     * can't be decoded at all.
+     */
+    class WireFormatDecoder {
+    public:
+        WireFormatDecoder(const char *data, size_t length, zend_fcall_info *fci, zend_fcall_info_cache *fci_cache, uint32_t max_depth)
+                : position(data), end(data + length), fci(fci), fci_cache(fci_cache), max_depth(max_depth) {}
+        ~WireFormatDecoder();
+
+        bool decode(zval *return_value);
+    private:
+        bool readValue(zval *value);
+        bool readValueOfAnyType(zval *value);
+        bool readObject(zval *value, uint8_t tag);
+        bool readJSObject(zval *value);
+        bool readProperties(HashTable *ht, uint8_t end_tag, uint32_t *count);
+        bool readDenseArray(zval *value);
+        bool readSparseArray(zval *value);
+        bool readMap(zval *value);
+        bool readSet(zval *value);
+        bool readString(zval *value);
+        bool readStringOfType(zval *value, uint8_t tag);
+        bool readRegExp(zval *value);
+        bool readArrayBufferView(zval *value, zend_string *buffer);
+        bool readHostObject(zval *value);
+        bool maybeReadArrayBufferView(zval *value);
+
+        bool readTag(uint8_t *tag);
+        bool peekTag(uint8_t *tag);
+        bool readVarint(uint64_t *value);
+        bool readVarint32(uint32_t *value);
+        bool readZigZag32(int32_t *value);
+        bool readDouble(double *value);
+        bool readRawBytes(size_t length, const char **data);
+
+        uint32_t reserveId();
+        void assignId(uint32_t id, zval *value, bool is_buffer = false);
+
+        bool error(const char *format, ...);
+
+        const char *position;
+        const char *end;
+
+        zend_fcall_info *fci;
+        zend_fcall_info_cache *fci_cache;
+
+        uint32_t depth = 0;
+        uint32_t max_depth;
+
+        // decoded objects by their ids, undefined while object is being decoded
+        std::vector<zval> objects;
+        std::vector<bool> buffers;
+    };
+}
+
+#endif //PHP_V8_WIRE_FORMAT_H
@@ -0,0 +1,78 @@
+<?php declare(strict_types=1);
+
+/**
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+
+namespace V8;
+
+
+/**
+ * An instance of the built-in ArrayBuffer constructor (ES6 draft 15.13.5).
+ */
+class ArrayBufferObject extends ObjectValue
+{
+    /**
+     * Create a new ArrayBuffer with zero-filled backing store of given length.
+     *
+     * @param Context $context
+     * @param int     $byte_length
+     */
+    public function __construct(Context $context, int $byte_length = 0)
+    {
+        parent::__construct($context);
+    }
+
+    /**
+     * Non-standard. Create a new ArrayBuffer with given string contents.
+     *
+     * When nothing else refers to the string (e.g. it is a function result passed right in), it becomes buffer's
+     * backing store without copying and is kept alive while ArrayBuffer lives, even after ArrayBufferObject is
+     * destroyed. Otherwise, as well as for interned strings (e.g. literals), contents are copied once, so js never
+     * writes into a string php code can see.
+     *
+     * @param Context $context
+     * @param string  $data
+     *
+     * @return ArrayBufferObject
+     */
+    public static function fromString(Context $context, string $data): ArrayBufferObject
+    {
+    }
+
+    /**
+     * Data length in bytes.
+     *
+     * @return int
+     */
+    public function byteLength(): int
+    {
+    }
+
+    /**
+     * Returns true if ArrayBuffer is externalized, that is, does not own its memory block.
+     *
+     * @return bool
+     */
+    public function isExternal(): bool
+    {
+    }
+
+    /**
+     * Non-standard. Get a copy of buffer contents as a string.
+     *
+     * @return string
+     */
+    public function getContents(): string
+    {
+    }
+}
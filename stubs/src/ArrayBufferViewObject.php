@@ -0,0 +1,69 @@
+<?php declare(strict_types=1);
+
+/**
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+
+namespace V8;
+
+
+/**
+ * A base class for an instance of one of "views" over ArrayBuffer,
+ * including TypedArrays and DataView (ES6 draft 15.13).
+ */
+abstract class ArrayBufferViewObject extends ObjectValue
+{
+    /**
+     * Returns underlying ArrayBuffer.
+     *
+     * @return ArrayBufferObject
+     */
+    public function buffer(): ArrayBufferObject
+    {
+    }
+
+    /**
+     * Byte offset in buffer.
+     *
+     * @return int
+     */
+    public function byteOffset(): int
+    {
+    }
+
+    /**
+     * Size of a view in bytes.
+     *
+     * @return int
+     */
+    public function byteLength(): int
+    {
+    }
+
+    /**
+     * Returns true if ArrayBufferView's backing ArrayBuffer has already been allocated.
+     *
+     * @return bool
+     */
+    public function hasBuffer(): bool
+    {
+    }
+
+    /**
+     * Non-standard. Get a copy of view contents as a string.
+     *
+     * @return string
+     */
+    public function getContents(): string
+    {
+    }
+}
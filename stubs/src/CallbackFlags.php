@@ -0,0 +1,33 @@
+<?php declare(strict_types=1);
+
+/**
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+
+namespace V8;
+
+
+/**
+ * Non-standard. Flags which control how php callbacks are invoked from js.
+ */
+final class CallbackFlags
+{
+    /**
+     * Result is set only via ReturnValue object, value returned from php callback is ignored.
+     */
+    const NONE = 0;
+    /**
+     * Value returned from php callback becomes js result. Scalars and arrays are converted natively, \V8\Value objects
+     * are used as is. Returning null (or nothing) leaves result untouched, so ReturnValue object could still be used.
+     */
+    const DIRECT_RETURN = 1;
+}
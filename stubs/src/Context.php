@@ -162,4 +162,23 @@ class Context
     public function setErrorMessageForCodeGenerationFromStrings(StringValue $message)
     {
     }
+
+    /**
+     * Whether primitive results of Script::run(), FunctionObject::call() and ObjectValue::get() should be returned
+     * as native php values (int, float, string, bool or null) instead of Value objects.
+     *
+     * Symbols and objects are always returned as Value objects. Disabled by default.
+     *
+     * @param bool $unwrap
+     */
+    public function setUnwrapPrimitives(bool $unwrap)
+    {
+    }
+
+    /**
+     * @return bool
+     */
+    public function getUnwrapPrimitives(): bool
+    {
+    }
 }
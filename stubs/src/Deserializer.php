@@ -0,0 +1,54 @@
+<?php declare(strict_types=1);
+
+/**
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+
+namespace V8;
+
+/**
+ * Non-standard. Deserializes data written by Serializer.
+ */
+class Deserializer
+{
+    /**
+     * Deserializes data into value.
+     *
+     * @param Context       $context
+     * @param string        $data
+     * @param callable|null $host_object_reader Callback with string $data argument, which returns ObjectValue
+     *
+     * @return Value|PrimitiveValue|ObjectValue
+     */
+    public static function deserialize(Context $context, string $data, callable $host_object_reader = null): Value
+    {
+    }
+
+    /**
+     * Decodes data into php value without any isolate involved.
+     *
+     * Objects and sparse arrays become arrays, dense arrays become lists with holes skipped, Maps become lists of
+     * [key, value] pairs and Sets become lists, Dates become float timestamps in milliseconds, boxed primitives are
+     * unboxed, RegExps become "/source/flags" strings, ArrayBuffers and DataViews become strings of their bytes and
+     * typed arrays become lists of numbers. Objects referenced more than once are copied, circular references
+     * are not supported.
+     *
+     * @param string        $data
+     * @param callable|null $host_object_decoder Callback with string $data argument, which may return any value.
+     *                                           Without it host object data is returned as is.
+     *
+     * @return mixed
+     */
+    public static function decode(string $data, callable $host_object_decoder = null)
+    {
+    }
+}
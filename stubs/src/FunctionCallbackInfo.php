@@ -75,6 +75,17 @@ class FunctionCallbackInfo implements CallbackInfoInterface
     {
     }
 
+    /**
+     * Get argument by its index. Unlike arguments(), only requested argument is wrapped.
+     *
+     * @param int $index
+     *
+     * @return Value|PrimitiveValue|ObjectValue UndefinedValue when index is out of range
+     */
+    public function argument(int $index): Value
+    {
+    }
+
     /**
      * For construct calls, this returns the "new.target" value.
      *
@@ -29,9 +29,15 @@ class  FunctionObject extends ObjectValue
      * @param callable $callback
      * @param int      $length
      * @param int      $behavior
+     * @param int      $flags    Callback flags, see CallbackFlags. Non-standard.
      */
-    public function __construct(Context $context, callable $callback, int $length = 0, int $behavior = ConstructorBehavior::ALLOW)
-    {
+    public function __construct(
+        Context $context,
+        callable $callback,
+        int $length = 0,
+        int $behavior = ConstructorBehavior::ALLOW,
+        int $flags = CallbackFlags::NONE
+    ) {
         parent::__construct($context);
     }
 
@@ -50,9 +56,23 @@ class  FunctionObject extends ObjectValue
      * @param Value   $recv
      * @param Value[] $arguments
      *
-     * @return Value|PrimitiveValue|ObjectValue
+     * @return Value|PrimitiveValue|ObjectValue|int|float|string|bool|null Scalar when context unwraps primitives
+     */
+    public function call(Context $context, Value $recv, array $arguments = [])
+    {
+    }
+
+    /**
+     * Non-standard. Same as FunctionObject::call(), but takes arguments as variadic list. Besides Value objects,
+     * php scalars and null are accepted and converted to js values in place.
+     *
+     * @param Context                               $context
+     * @param Value                                 $recv
+     * @param Value|int|float|string|bool|null ...$arguments
+     *
+     * @return Value|PrimitiveValue|ObjectValue|int|float|string|bool|null Scalar when context unwraps primitives
      */
-    public function call(Context $context, Value $recv, array $arguments = []): Value
+    public function callArgs(Context $context, Value $recv, ...$arguments)
     {
     }
 
@@ -123,13 +123,15 @@ class FunctionTemplate extends Template implements AdjustableExternalMemoryInter
      * @param FunctionTemplate|null $receiver Specifies which receiver is valid for a function
      * @param int                   $length
      * @param int                   $behavior
+     * @param int                   $flags    Callback flags, see CallbackFlags. Non-standard.
      */
     public function __construct(
         Isolate $isolate,
         callable $callback = null,
         FunctionTemplate $receiver = null,
         int $length = 0,
-        int $behavior = ConstructorBehavior::ALLOW
+        int $behavior = ConstructorBehavior::ALLOW,
+        int $flags = CallbackFlags::NONE
     ) {
         parent::__construct($isolate);
     }
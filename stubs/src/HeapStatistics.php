@@ -68,6 +68,14 @@ class  HeapStatistics
      * @var float
      */
     private $number_of_detached_contexts;
+    /**
+     * @var float
+     */
+    private $array_buffer_allocated_size;
+    /**
+     * @var float
+     */
+    private $peak_array_buffer_allocated_size;
 
     /**
      * @param float $total_heap_size
@@ -81,6 +89,8 @@ class  HeapStatistics
      * @param bool  $does_zap_garbage
      * @param float $number_of_native_contexts
      * @param float $number_of_detached_contexts
+     * @param float $array_buffer_allocated_size
+     * @param float $peak_array_buffer_allocated_size
      */
     public function __construct(
         float $total_heap_size,
@@ -93,7 +103,9 @@ class  HeapStatistics
         float $peak_malloced_memory,
         bool $does_zap_garbage,
         float $number_of_native_contexts,
-        float $number_of_detached_contexts
+        float $number_of_detached_contexts,
+        float $array_buffer_allocated_size,
+        float $peak_array_buffer_allocated_size
     ) {
         $this->total_heap_size             = $total_heap_size;
         $this->total_heap_size_executable  = $total_heap_size_executable;
@@ -106,6 +118,9 @@ class  HeapStatistics
         $this->does_zap_garbage            = $does_zap_garbage;
         $this->number_of_native_contexts   = $number_of_native_contexts;
         $this->number_of_detached_contexts = $number_of_detached_contexts;
+
+        $this->array_buffer_allocated_size      = $array_buffer_allocated_size;
+        $this->peak_array_buffer_allocated_size = $peak_array_buffer_allocated_size;
     }
 
     /**
@@ -199,4 +214,26 @@ class  HeapStatistics
     {
         return $this->number_of_detached_contexts;
     }
+
+    /**
+     * Non-standard. The total size of ArrayBuffer backing stores that are currently allocated. Such memory lives
+     * outside of V8 heap, but it counts towards isolate memory limit.
+     *
+     * @return float
+     */
+    public function getArrayBufferAllocatedSize(): float
+    {
+        return $this->array_buffer_allocated_size;
+    }
+
+    /**
+     * Non-standard. The peak size of allocated ArrayBuffer backing stores since isolate was created or taken from
+     * isolate pool.
+     *
+     * @return float
+     */
+    public function getPeakArrayBufferAllocatedSize(): float
+    {
+        return $this->peak_array_buffer_allocated_size;
+    }
 }
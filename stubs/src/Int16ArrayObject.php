@@ -0,0 +1,34 @@
+<?php declare(strict_types=1);
+
+/**
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+
+namespace V8;
+
+
+/**
+ * An instance of Int16Array constructor (ES6 draft 15.13.6).
+ */
+class Int16ArrayObject extends TypedArrayObject
+{
+    /**
+     * @param Context           $context
+     * @param ArrayBufferObject $buffer
+     * @param int               $byte_offset Should be a multiple of element size
+     * @param int|null          $length      Number of elements, the rest of the buffer is used when null
+     */
+    public function __construct(Context $context, ArrayBufferObject $buffer, int $byte_offset = 0, ?int $length = null)
+    {
+        parent::__construct($context);
+    }
+}
@@ -26,7 +26,14 @@ class Isolate
     const MEMORY_PRESSURE_LEVEL_MODERATE = 1;
     const MEMORY_PRESSURE_LEVEL_CRITICAL = 2;
 
-    public function __construct(StartupData $snapshot = null)
+    /**
+     * @param StartupData|null $snapshot
+     * @param int              $memory_limit_in_bytes Heap limit the isolate is created with. With libv8 6.7+ V8
+     *                                                enforces it on allocation, so it is hit precisely instead of on
+     *                                                the next GC. With older libv8 it has the same effect as calling
+     *                                                setMemoryLimit() right after construction.
+     */
+    public function __construct(StartupData $snapshot = null, int $memory_limit_in_bytes = 0)
     {
     }
 
@@ -41,6 +48,13 @@ class Isolate
     {
     }
 
+    /**
+     * Heap limit set at runtime is checked against current usage right away and then on every GC. Unlike constructor
+     * limit, it can't change heap size V8 was created with, so with libv8 6.7+ it is only enforced on allocation when
+     * it is higher than that.
+     *
+     * @param int $memory_limit_in_bytes
+     */
     public function setMemoryLimit(int $memory_limit_in_bytes)
     {
     }
@@ -65,6 +79,35 @@ class Isolate
     {
     }
 
+    /**
+     * Get how late execution termination was requested after time limit deadline passed
+     *
+     * @return float Overshoot in seconds for the last time limit hit, 0.0 when time limit was not hit
+     */
+    public function getTimeLimitOvershoot(): float
+    {
+    }
+
+    /**
+     * Limit CPU time consumed by the thread executing JS in this isolate
+     *
+     * Unlike time limit, time when thread is descheduled or blocked is not counted.
+     *
+     * @param float $cpu_time_limit_in_seconds
+     * @param bool  $exclude_callbacks Whether to not count time spent in PHP callbacks (and any JS they call)
+     */
+    public function setCpuTimeLimit(float $cpu_time_limit_in_seconds, bool $exclude_callbacks = false)
+    {
+    }
+
+    public function getCpuTimeLimit(): float
+    {
+    }
+
+    public function isCpuTimeLimitHit(): bool
+    {
+    }
+
     /**
      * Optional notification that the system is running low on memory.
      * V8 uses these notifications to guide heuristics.
@@ -0,0 +1,90 @@
+<?php declare(strict_types=1);
+
+/**
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+
+namespace V8;
+
+
+/**
+ * Named pool of isolates that outlive the request which created them
+ *
+ * Pool with a given name is created once per worker process (per thread in ZTS builds) and is shared between all
+ * IsolatePool objects constructed with the same name, so next requests reuse already created isolates instead of
+ * paying for their creation (and snapshot deserialization).
+ *
+ * Isolate goes back to the pool when the V8\Isolate object returned from acquire() is destroyed. Limits, external
+ * exceptions and weak values belong to V8\Isolate object, so every acquired isolate starts with them reset. Contexts
+ * are never reused, so always create a new V8\Context for an acquired isolate.
+ */
+class IsolatePool
+{
+    /**
+     * @param string           $name          Pool name
+     * @param StartupData|null $snapshot      Snapshot to create pool isolates from. It is copied into persistent
+     *                                        memory, so later requests may omit it. Passing a different snapshot drops
+     *                                        all idle isolates.
+     * @param int              $max_idle      Max number of idle isolates to keep
+     * @param int              $max_heap_size Isolates with used heap size above this value (even after full GC) are
+     *                                        evicted instead of going back to the pool. Zero means no limit.
+     */
+    public function __construct(string $name, StartupData $snapshot = null, int $max_idle = 4, int $max_heap_size = 0)
+    {
+    }
+
+    public function getName(): string
+    {
+    }
+
+    /**
+     * Get an idle isolate from the pool or create a new one
+     *
+     * @return Isolate
+     */
+    public function acquire(): Isolate
+    {
+    }
+
+    /**
+     * Create isolates in advance till there are $count (but no more than max idle) idle ones
+     *
+     * @param int $count
+     */
+    public function warmUp(int $count)
+    {
+    }
+
+    /**
+     * Dispose all idle isolates
+     */
+    public function clear()
+    {
+    }
+
+    /**
+     * Get pool statistics
+     *
+     * - hits - acquire() calls served with idle isolate
+     * - misses - acquire() calls that had to create a new isolate
+     * - creations - total isolates created, including by warmUp()
+     * - evictions - isolates disposed on release due to their heap size
+     * - discards - isolates disposed on release as pool was full or they were not reusable
+     * - idle - isolates currently waiting in the pool
+     * - in_use - isolates currently acquired
+     *
+     * @return array
+     */
+    public function getStats(): array
+    {
+    }
+}
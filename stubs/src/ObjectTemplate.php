@@ -65,6 +65,9 @@ class ObjectTemplate extends Template implements AdjustableExternalMemoryInterfa
      *                                     receiver is incompatible (i.e. is not an instance of the constructor as
      *                                     defined by FunctionTemplate::HasInstance()), an implicit TypeError is
      *                                     thrown and no callback is invoked.
+     *
+     * @param int              $flags      Callback flags, see CallbackFlags. With CallbackFlags::DIRECT_RETURN value
+     *                                     returned from getter becomes property value. Non-standard.
      */
 
     public function setAccessor(
@@ -73,7 +76,8 @@ class ObjectTemplate extends Template implements AdjustableExternalMemoryInterfa
         callable $setter,
         $settings = AccessControl::DEFAULT_ACCESS,
         $attributes = PropertyAttribute::NONE,
-        FunctionTemplate $receiver
+        FunctionTemplate $receiver,
+        int $flags = CallbackFlags::NONE
     ) {
     }
 
@@ -140,6 +144,27 @@ class ObjectTemplate extends Template implements AdjustableExternalMemoryInterfa
     {
     }
 
+    /**
+     * Gets the number of internal fields for objects generated from
+     * this template.
+     *
+     * @return int
+     */
+    public function internalFieldCount(): int
+    {
+    }
+
+    /**
+     * Sets the number of internal fields for objects generated from
+     * this template. Objects with internal fields are host objects for
+     * V8\Serializer and V8\Deserializer.
+     *
+     * @param int $value
+     */
+    public function setInternalFieldCount(int $value)
+    {
+    }
+
     /**
      * {@inheritdoc}
      */
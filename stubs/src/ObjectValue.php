@@ -44,6 +44,21 @@ class ObjectValue extends Value implements AdjustableExternalMemoryInterface
     {
     }
 
+    /**
+     * Set multiple properties at once.
+     *
+     * Array keys are property names (integer keys are indexes) and values are either V8\Value instances or php
+     * values that are converted just like V8\Value::fromPhp() does.
+     *
+     * @param Context $context
+     * @param array   $properties
+     *
+     * @return bool Whether all properties were set
+     */
+    public function setMany(Context $context, array $properties): bool
+    {
+    }
+
 
     /**
      * Implements CreateDataProperty (ECMA-262, 7.3.4).
@@ -86,9 +101,22 @@ class ObjectValue extends Value implements AdjustableExternalMemoryInterface
      * @param Context $context
      * @param Value   $key
      *
-     * @return Value|PrimitiveValue|ObjectValue
+     * @return Value|PrimitiveValue|ObjectValue|int|float|string|bool|null Scalar when context unwraps primitives
+     */
+    public function get(Context $context, Value $key)
+    {
+    }
+
+    /**
+     * Get multiple properties at once.
+     *
+     * @param Context $context
+     * @param array   $keys    List of property names (integers are indexes)
+     * @param bool    $scalars Whether to return primitive values (except symbols) as php scalars and null
+     *
+     * @return array Property values keyed by property names
      */
-    public function get(Context $context, Value $key): Value
+    public function getMany(Context $context, array $keys, bool $scalars = false): array
     {
     }
 
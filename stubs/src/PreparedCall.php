@@ -0,0 +1,102 @@
+<?php declare(strict_types=1);
+
+/**
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+namespace V8;
+
+/**
+ * Non-standard. Function call bound to context, function and receiver, which are validated once on construction,
+ * so that repeated calls of the same function only do per-call work.
+ */
+class PreparedCall
+{
+    /**
+     * @var Isolate
+     */
+    private $isolate;
+    /**
+     * @var Context
+     */
+    private $context;
+    /**
+     * @var FunctionObject
+     */
+    private $function;
+    /**
+     * @var Value
+     */
+    private $receiver;
+
+    /**
+     * @param Context        $context
+     * @param FunctionObject $function
+     * @param Value          $recv
+     */
+    public function __construct(Context $context, FunctionObject $function, Value $recv)
+    {
+        $this->context = $context;
+        $this->function = $function;
+        $this->receiver = $recv;
+    }
+
+    /**
+     * @return Isolate
+     */
+    public function getIsolate(): Isolate
+    {
+    }
+
+    /**
+     * @return Context
+     */
+    public function getContext(): Context
+    {
+    }
+
+    /**
+     * @return FunctionObject
+     */
+    public function getFunction(): FunctionObject
+    {
+    }
+
+    /**
+     * @return Value
+     */
+    public function getReceiver(): Value
+    {
+    }
+
+    /**
+     * Calls bound function with given arguments, same as FunctionObject::callArgs().
+     *
+     * @param Value|int|float|string|bool|null ...$arguments
+     *
+     * @return Value|PrimitiveValue|ObjectValue|int|float|string|bool|null Scalar when context unwraps primitives
+     */
+    public function invoke(...$arguments)
+    {
+    }
+
+    /**
+     * Calls bound function once per arguments list while entering isolate and context only once. Stops on first
+     * exception, results of calls made before it are discarded.
+     *
+     * @param array[] $arg_lists List of arguments lists, each of Value objects or scalars
+     *
+     * @return array Results of each call, in the same order as arguments lists
+     */
+    public function invokeBatch(array $arg_lists): array
+    {
+    }
+}
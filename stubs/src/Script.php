@@ -50,9 +50,9 @@ class Script
      *
      * @param Context $context
      *
-     * @return Value|PrimitiveValue|ObjectValue
+     * @return Value|PrimitiveValue|ObjectValue|int|float|string|bool|null Scalar when context unwraps primitives
      */
-    public function run(Context $context): Value
+    public function run(Context $context)
     {
     }
 
@@ -17,6 +17,7 @@ namespace V8;
 
 
 use V8\ScriptCompiler\CachedData;
+use V8\ScriptCompiler\CodeCacheStoreInterface;
 use V8\ScriptCompiler\Source;
 
 
@@ -119,4 +120,27 @@ class ScriptCompiler
     public static function createCodeCache(UnboundScript $unbound_script, StringValue $source_string): CachedData
     {
     }
+
+    /**
+     * Set code cache store to be used by compile() and compileUnboundScript() for sources without cached data
+     * compiled with default options. Cached data is looked up by source, resource name and cached data version tag
+     * and consumed when found. When it is missed or rejected (rejected one is deleted from store), code cache is
+     * produced and stored after first script run (or right after compilation for unbound scripts).
+     *
+     * Store is reset at the end of each request.
+     *
+     * @param CodeCacheStoreInterface|null $store
+     *
+     * @return void
+     */
+    public static function setCodeCacheStore(?CodeCacheStoreInterface $store)
+    {
+    }
+
+    /**
+     * @return CodeCacheStoreInterface|null
+     */
+    public static function getCodeCacheStore(): ?CodeCacheStoreInterface
+    {
+    }
 }
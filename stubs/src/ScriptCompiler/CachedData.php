@@ -36,4 +36,49 @@ class CachedData
     public function isRejected(): bool
     {
     }
+
+    /**
+     * Map cached data file (as produced by CachedData::getData()) read-only into memory instead of reading it.
+     * Data pages are shared through the page cache between all processes that map the same file, and the file must
+     * not be changed while mapped.
+     *
+     * @param string $path
+     *
+     * @return CachedData
+     */
+    public static function fromFile(string $path): CachedData
+    {
+    }
+
+    /**
+     * Store copy of cached data under given name so that it survives current request and may be fetched by
+     * next requests in the same process. Previously persisted data with the same name is replaced.
+     *
+     * @param string $name
+     *
+     * @return void
+     */
+    public function persist(string $name)
+    {
+    }
+
+    /**
+     * Get cached data persisted under given name. Data produced by different V8 version or flags are dropped.
+     *
+     * @param string $name
+     *
+     * @return CachedData|null
+     */
+    public static function fetchPersisted(string $name): ?CachedData
+    {
+    }
+
+    /**
+     * @param string $name
+     *
+     * @return bool Whether there were cached data persisted under given name
+     */
+    public static function forgetPersisted(string $name): bool
+    {
+    }
 }
@@ -0,0 +1,50 @@
+<?php declare(strict_types=1);
+
+/**
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+
+namespace V8\ScriptCompiler;
+
+
+/**
+ * Storage for code cache used by V8\ScriptCompiler (see V8\ScriptCompiler::setCodeCacheStore()).
+ *
+ * Keys are hex strings which already include cached data version tag, so store doesn't need to care about
+ * V8 version changes.
+ */
+interface CodeCacheStoreInterface
+{
+    /**
+     * @param string $key
+     *
+     * @return CachedData|null
+     */
+    public function get(string $key): ?CachedData;
+
+    /**
+     * @param string     $key
+     * @param CachedData $cached_data
+     *
+     * @return void
+     */
+    public function set(string $key, CachedData $cached_data);
+
+    /**
+     * Called when cached data returned by store was rejected by V8
+     *
+     * @param string $key
+     *
+     * @return void
+     */
+    public function delete(string $key);
+}
@@ -0,0 +1,47 @@
+<?php declare(strict_types=1);
+
+/**
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+
+namespace V8\ScriptCompiler;
+
+
+/**
+ * Keeps code cache in files in given directory. Files are written atomically and read with CachedData::fromFile(),
+ * so they are memory-mapped and shared between processes.
+ */
+class DirectoryCodeCacheStore implements CodeCacheStoreInterface
+{
+    /**
+     * @param string $directory Existent directory
+     */
+    public function __construct(string $directory)
+    {
+    }
+
+    public function getDirectory(): string
+    {
+    }
+
+    public function get(string $key): ?CachedData
+    {
+    }
+
+    public function set(string $key, CachedData $cached_data)
+    {
+    }
+
+    public function delete(string $key)
+    {
+    }
+}
@@ -0,0 +1,36 @@
+<?php declare(strict_types=1);
+
+/**
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+
+namespace V8\ScriptCompiler;
+
+
+/**
+ * Keeps code cache in process memory, so it outlives request and is shared by all requests served by the same
+ * process. Cached data is stored the same way as with CachedData::persist().
+ */
+class MemoryCodeCacheStore implements CodeCacheStoreInterface
+{
+    public function get(string $key): ?CachedData
+    {
+    }
+
+    public function set(string $key, CachedData $cached_data)
+    {
+    }
+
+    public function delete(string $key)
+    {
+    }
+}
@@ -0,0 +1,39 @@
+<?php declare(strict_types=1);
+
+/**
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+
+namespace V8;
+
+/**
+ * Non-standard. Serializes values with the same algorithm that structured clone uses, so that they can be transferred
+ * between isolates or stored and later deserialized with Deserializer.
+ */
+class Serializer
+{
+    /**
+     * Serializes value into binary string.
+     *
+     * Objects with internal fields (see ObjectTemplate::setInternalFieldCount()) are host objects, which data is
+     * written by $host_object_writer. Without it host objects can't be serialized.
+     *
+     * @param Context       $context
+     * @param Value         $value
+     * @param callable|null $host_object_writer Callback with ObjectValue $object argument, which returns string
+     *
+     * @return string
+     */
+    public static function serialize(Context $context, Value $value, callable $host_object_writer = null): string
+    {
+    }
+}
@@ -33,6 +33,53 @@ class StartupData
     {
     }
 
+    /**
+     * Map startup blob file (as produced by StartupData::getData()) read-only into memory instead of reading it.
+     * Blob pages are shared through the page cache between all processes that map the same file. Only the blob
+     * header is checked here, so the file must not be changed while mapped.
+     *
+     * @param string $path
+     *
+     * @return StartupData
+     */
+    public static function fromFile(string $path): StartupData
+    {
+    }
+
+    /**
+     * Store startup data under given name so that it survives current request and may be fetched by next
+     * requests in the same process without copying blob again. Previously persisted data with the same name
+     * is replaced.
+     *
+     * @param string $name
+     *
+     * @return void
+     */
+    public function persist(string $name)
+    {
+    }
+
+    /**
+     * Get startup data persisted under given name. Data produced by different V8 version or flags, as well as
+     * data rejected by V8, are dropped.
+     *
+     * @param string $name
+     *
+     * @return StartupData|null
+     */
+    public static function fetchPersisted(string $name): ?StartupData
+    {
+    }
+
+    /**
+     * @param string $name
+     *
+     * @return bool Whether there were startup data persisted under given name
+     */
+    public static function forgetPersisted(string $name): bool
+    {
+    }
+
     /**
      * Runs v8::V8::CreateSnapshotDataBlob
      *
@@ -31,6 +31,21 @@ class StringValue extends NameValue
     {
     }
 
+    /**
+     * Create string that uses PHP string memory as is instead of copying it into V8 heap. PHP string is kept alive
+     * while V8 string is, and its size is reported to V8 as external memory.
+     *
+     * Only ASCII strings can be shared this way, other strings are copied as with constructor.
+     *
+     * @param Isolate $isolate
+     * @param string  $data
+     *
+     * @return StringValue
+     */
+    public static function external(Isolate $isolate, string $data): StringValue
+    {
+    }
+
     /**
      * @return string
      */
@@ -59,6 +74,15 @@ class StringValue extends NameValue
     {
     }
 
+    /**
+     * Whether string content lives outside of V8 heap, e.g. was created with StringValue::external()
+     *
+     * @return bool
+     */
+    public function isExternal(): bool
+    {
+    }
+
     /**
      * @return bool
      */
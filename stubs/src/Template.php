@@ -123,4 +123,55 @@ class Template extends Data
     public function setLazyDataProperty(NameValue $name, callable $getter, $attribute = PropertyAttribute::NONE): void
     {
     }
+
+    /**
+     * Non-standard. Sets a native data property which always returns given value. Value is converted
+     * to js natively on each access, no php function is called.
+     *
+     * @param NameValue $name       The name of the property.
+     * @param mixed     $value      Scalar, null or array value to return.
+     * @param int       $attributes The attributes of the property.
+     *
+     * @return void
+     */
+    public function bindConstant(NameValue $name, $value, int $attributes = PropertyAttribute::NONE): void
+    {
+    }
+
+    /**
+     * Non-standard. Sets a native data property which reads and writes given php object property natively,
+     * no php function is called unless object has magic __get()/__set() methods.
+     *
+     * Property is accessed with visibility of the scope where this method is called. Values are converted
+     * like Value::fromPhp() and Value::toPhp() do.
+     *
+     * @param NameValue   $name       The name of the property.
+     * @param object      $object     Object which property is bound.
+     * @param string|null $property   Name of the php property, js property name is used when not given.
+     * @param int         $attributes The attributes of the property, use PropertyAttribute::READ_ONLY to
+     *                                disallow writing.
+     *
+     * @return void
+     */
+    public function bindProperty(NameValue $name, $object, string $property = null, int $attributes = PropertyAttribute::NONE): void
+    {
+    }
+
+    /**
+     * Non-standard. Sets a native data property which reads and writes given array offset natively,
+     * no php function is called.
+     *
+     * Array is bound by reference, so further changes to it are visible from js and vice versa.
+     *
+     * @param NameValue       $name       The name of the property.
+     * @param array           $array      Array which offset is bound.
+     * @param int|string|null $offset     Array offset, js property name is used when not given.
+     * @param int             $attributes The attributes of the property, use PropertyAttribute::READ_ONLY to
+     *                                    disallow writing.
+     *
+     * @return void
+     */
+    public function bindArrayOffset(NameValue $name, array &$array, $offset = null, int $attributes = PropertyAttribute::NONE): void
+    {
+    }
 }
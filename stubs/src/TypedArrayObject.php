@@ -0,0 +1,32 @@
+<?php declare(strict_types=1);
+
+/**
+ * This file is part of the phpv8/php-v8 PHP extension.
+ *
+ * Copyright (c) 2015-2018 Bogdan Padalko <thepinepain@gmail.com>
+ *
+ * Licensed under the MIT license: http://opensource.org/licenses/MIT
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE file that was distributed with this source or visit
+ * http://opensource.org/licenses/MIT
+ */
+
+
+namespace V8;
+
+
+/**
+ * A base class for an instance of TypedArray series of constructors (ES6 draft 15.13.6).
+ */
+abstract class TypedArrayObject extends ArrayBufferViewObject
+{
+    /**
+     * Number of elements in this typed array (e.g. for Int16Array, |ByteLength|/2).
+     *
+     * @return int
+     */
+    public function length(): int
+    {
+    }
+}
@@ -631,4 +631,41 @@ abstract class Value extends Data
     public function instanceOf (Context $context, ObjectValue $object): bool
     {
     }
+
+    /**
+     * Convert php value to js value natively, in one go.
+     *
+     * Scalars and null are converted to their js counterparts, list arrays (sequential keys starting from 0) become
+     * js arrays and all other arrays become plain js objects. JsonSerializable objects are converted using
+     * jsonSerialize() result, other objects contribute their public properties. V8\Value instances are passed as is.
+     *
+     * @param Context $context
+     * @param mixed   $value
+     * @param int     $max_depth Maximum nesting level of arrays and objects
+     *
+     * @return Value
+     *
+     * @throws \V8\Exceptions\ValueException When value contains resources, circular references or is nested too deep
+     */
+    public static function fromPhp(Context $context, $value, int $max_depth = 512): Value
+    {
+    }
+
+    /**
+     * Convert js value to php value natively, in one go.
+     *
+     * Primitives are converted to php scalars and null (integral numbers that fit into int become int), js arrays
+     * become list arrays and plain js objects become associative arrays of their own enumerable properties.
+     * Functions, symbols and other objects that have no php counterpart are returned as V8\Value instances.
+     *
+     * @param Context $context
+     * @param int     $max_depth Maximum nesting level of arrays and objects
+     *
+     * @return mixed
+     *
+     * @throws \V8\Exceptions\ValueException When value contains circular references or is nested too deep
+     */
+    public function toPhp(Context $context, int $max_depth = 512)
+    {
+    }
 }
@@ -258,6 +258,10 @@ final class V8\RAILMode
     const PERFORMANCE_IDLE = 2
     const PERFORMANCE_LOAD = 3
 
+final class V8\CallbackFlags
+    const NONE = 0
+    const DIRECT_RETURN = 1
+
 class V8\Exceptions\Exception
     extends Exception
     implements Throwable
@@ -309,6 +313,8 @@ class V8\HeapStatistics
     private $does_zap_garbage
     private $number_of_native_contexts
     private $number_of_detached_contexts
+    private $array_buffer_allocated_size
+    private $peak_array_buffer_allocated_size
     public function __construct(float $total_heap_size, float $total_heap_size_executable, float $total_physical_size, float $total_available_size, float $used_heap_size, float $heap_size_limit, float $malloced_memory, float $peak_malloced_memory, bool $does_zap_garbage)
     public function getTotalHeapSize(): float
     public function getTotalHeapSizeExecutable(): float
@@ -321,11 +327,17 @@ class V8\HeapStatistics
     public function doesZapGarbage(): bool
     public function getNumberOfNativeContexts(): float
     public function getNumberOfDetachedContexts(): float
+    public function getArrayBufferAllocatedSize(): float
+    public function getPeakArrayBufferAllocatedSize(): float
 
 class V8\StartupData
     public function __construct(string $blob)
     public function getData(): string
     public function isRejected(): bool
+    public static function fromFile(string $path): V8\StartupData
+    public function persist(string $name)
+    public static function fetchPersisted(string $name): ?V8\StartupData
+    public static function forgetPersisted(string $name): bool
     public static function createFromSource(string $source): V8\StartupData
     public static function warmUpSnapshotDataBlob(V8\StartupData $cold_startup_data, string $warmup_source): V8\StartupData
 
@@ -333,11 +345,15 @@ class V8\Isolate
     const MEMORY_PRESSURE_LEVEL_NONE = 0
     const MEMORY_PRESSURE_LEVEL_MODERATE = 1
     const MEMORY_PRESSURE_LEVEL_CRITICAL = 2
-    public function __construct(?V8\StartupData $snapshot)
+    public function __construct(?V8\StartupData $snapshot, int $memory_limit_in_bytes)
     public function within(callable $callback)
     public function setTimeLimit(float $time_limit_in_seconds)
     public function getTimeLimit(): float
     public function isTimeLimitHit(): bool
+    public function getTimeLimitOvershoot(): float
+    public function setCpuTimeLimit(float $cpu_time_limit_in_seconds, bool $exclude_callbacks)
+    public function getCpuTimeLimit(): float
+    public function isCpuTimeLimitHit(): bool
     public function setMemoryLimit(int $memory_limit_in_bytes)
     public function getMemoryLimit(): int
     public function isMemoryLimitHit(): bool
@@ -356,6 +372,14 @@ class V8\Isolate
     public function isInUse(): bool
     public function setCaptureStackTraceForUncaughtExceptions(bool $capture, int $frame_limit)
 
+class V8\IsolatePool
+    public function __construct(string $name, ?V8\StartupData $snapshot, int $max_idle, int $max_heap_size)
+    public function getName(): string
+    public function acquire(): V8\Isolate
+    public function warmUp(int $count)
+    public function clear()
+    public function getStats(): array
+
 class V8\Context
     private $isolate
     public function __construct(V8\Isolate $isolate, ?V8\ObjectTemplate $global_template, ?V8\ObjectValue $global_object)
@@ -369,6 +393,8 @@ class V8\Context
     public function allowCodeGenerationFromStrings(bool $allow)
     public function isCodeGenerationFromStringsAllowed(): bool
     public function setErrorMessageForCodeGenerationFromStrings(V8\StringValue $message)
+    public function setUnwrapPrimitives(bool $unwrap)
+    public function getUnwrapPrimitives(): bool
 
 class V8\Script
     private $isolate
@@ -376,7 +402,7 @@ class V8\Script
     public function __construct(V8\Context $context, V8\StringValue $source, V8\ScriptOrigin $origin)
     public function getIsolate(): V8\Isolate
     public function getContext(): V8\Context
-    public function run(V8\Context $context): V8\Value
+    public function run(V8\Context $context)
     public function getUnboundScript(): V8\UnboundScript
 
 class V8\UnboundScript
@@ -394,6 +420,10 @@ class V8\ScriptCompiler\CachedData
     public function __construct(string $data)
     public function getData(): string
     public function isRejected(): bool
+    public static function fromFile(string $path): V8\ScriptCompiler\CachedData
+    public function persist(string $name)
+    public static function fetchPersisted(string $name): ?V8\ScriptCompiler\CachedData
+    public static function forgetPersisted(string $name): bool
 
 class V8\ScriptCompiler\Source
     private $source_string
@@ -413,6 +443,28 @@ class V8\ScriptCompiler
     public static function compile(V8\Context $context, V8\ScriptCompiler\Source $source, int $options): V8\Script
     public static function compileFunctionInContext(V8\Context $context, V8\ScriptCompiler\Source $source, array $arguments, array $context_extensions): V8\FunctionObject
     public static function createCodeCache(V8\UnboundScript $unbound_script, V8\StringValue $source_string): V8\ScriptCompiler\CachedData
+    public static function setCodeCacheStore(?V8\ScriptCompiler\CodeCacheStoreInterface $store)
+    public static function getCodeCacheStore(): ?V8\ScriptCompiler\CodeCacheStoreInterface
+
+interface V8\ScriptCompiler\CodeCacheStoreInterface
+    abstract public function get(string $key): ?V8\ScriptCompiler\CachedData
+    abstract public function set(string $key, V8\ScriptCompiler\CachedData $cached_data)
+    abstract public function delete(string $key)
+
+class V8\ScriptCompiler\MemoryCodeCacheStore
+    implements V8\ScriptCompiler\CodeCacheStoreInterface
+    public function get(string $key): ?V8\ScriptCompiler\CachedData
+    public function set(string $key, V8\ScriptCompiler\CachedData $cached_data)
+    public function delete(string $key)
+
+class V8\ScriptCompiler\DirectoryCodeCacheStore
+    implements V8\ScriptCompiler\CodeCacheStoreInterface
+    private $directory
+    public function __construct(string $directory)
+    public function getDirectory(): string
+    public function get(string $key): ?V8\ScriptCompiler\CachedData
+    public function set(string $key, V8\ScriptCompiler\CachedData $cached_data)
+    public function delete(string $key)
 
 class V8\ExceptionManager
     public static function createRangeError(V8\Context $context, V8\StringValue $message): V8\ObjectValue
@@ -607,6 +659,8 @@ abstract class V8\Value
     public function sameValue(V8\Value $that): bool
     public function typeOf(): V8\StringValue
     public function instanceOf(V8\Context $context, V8\ObjectValue $object): bool
+    public static function fromPhp(V8\Context $context, $value, int $max_depth): V8\Value
+    public function toPhp(V8\Context $context, int $max_depth)
 
 abstract class V8\PrimitiveValue
     extends V8\Value
@@ -635,10 +689,12 @@ class V8\StringValue
     extends V8\NameValue
     const MAX_LENGTH = 1073741799
     public function __construct(V8\Isolate $isolate, $data)
+    public static function external(V8\Isolate $isolate, string $data): V8\StringValue
     public function value(): string
     public function length(): int
     public function utf8Length(): int
     public function isOneByte(): bool
+    public function isExternal(): bool
     public function containsOnlyOneByte(): bool
 
 class V8\SymbolValue
@@ -686,9 +742,11 @@ class V8\ObjectValue
     public function __construct(V8\Context $context)
     public function getContext(): V8\Context
     public function set(V8\Context $context, V8\Value $key, V8\Value $value)
+    public function setMany(V8\Context $context, array $properties): bool
     public function createDataProperty(V8\Context $context, V8\NameValue $key, V8\Value $value): bool
     public function defineOwnProperty(V8\Context $context, V8\NameValue $key, V8\Value $value, $attributes): bool
-    public function get(V8\Context $context, V8\Value $key): V8\Value
+    public function get(V8\Context $context, V8\Value $key)
+    public function getMany(V8\Context $context, array $keys, bool $scalars): array
     public function getPropertyAttributes(V8\Context $context, V8\StringValue $key): int
     public function getOwnPropertyDescriptor(V8\Context $context, V8\StringValue $key): V8\Value
     public function has(V8\Context $context, V8\Value $key): bool
@@ -727,9 +785,10 @@ class V8\ObjectValue
 class V8\FunctionObject
     extends V8\ObjectValue
     implements V8\AdjustableExternalMemoryInterface
-    public function __construct(V8\Context $context, callable $callback, int $length)
+    public function __construct(V8\Context $context, callable $callback, int $length, int $behavior, int $flags)
     public function newInstance(V8\Context $context, array $arguments): V8\ObjectValue
-    public function call(V8\Context $context, V8\Value $recv, array $arguments): V8\Value
+    public function call(V8\Context $context, V8\Value $recv, array $arguments)
+    public function callArgs(V8\Context $context, V8\Value $recv, ...$arguments)
     public function setName(V8\StringValue $name)
     public function getName(): V8\Value
     public function getInferredName(): V8\Value
@@ -822,6 +881,79 @@ class V8\ProxyObject
     public function isRevoked(): bool
     public function revoke()
 
+class V8\ArrayBufferObject
+    extends V8\ObjectValue
+    implements V8\AdjustableExternalMemoryInterface
+    public function __construct(V8\Context $context, int $byte_length)
+    public static function fromString(V8\Context $context, string $data): V8\ArrayBufferObject
+    public function byteLength(): int
+    public function isExternal(): bool
+    public function getContents(): string
+
+abstract class V8\ArrayBufferViewObject
+    extends V8\ObjectValue
+    implements V8\AdjustableExternalMemoryInterface
+    public function buffer(): V8\ArrayBufferObject
+    public function byteOffset(): int
+    public function byteLength(): int
+    public function hasBuffer(): bool
+    public function getContents(): string
+
+abstract class V8\TypedArrayObject
+    extends V8\ArrayBufferViewObject
+    implements V8\AdjustableExternalMemoryInterface
+    public function length(): int
+
+class V8\Uint8ArrayObject
+    extends V8\TypedArrayObject
+    implements V8\AdjustableExternalMemoryInterface
+    public function __construct(V8\Context $context, V8\ArrayBufferObject $buffer, int $byte_offset, ?int $length)
+
+class V8\Uint8ClampedArrayObject
+    extends V8\TypedArrayObject
+    implements V8\AdjustableExternalMemoryInterface
+    public function __construct(V8\Context $context, V8\ArrayBufferObject $buffer, int $byte_offset, ?int $length)
+
+class V8\Int8ArrayObject
+    extends V8\TypedArrayObject
+    implements V8\AdjustableExternalMemoryInterface
+    public function __construct(V8\Context $context, V8\ArrayBufferObject $buffer, int $byte_offset, ?int $length)
+
+class V8\Uint16ArrayObject
+    extends V8\TypedArrayObject
+    implements V8\AdjustableExternalMemoryInterface
+    public function __construct(V8\Context $context, V8\ArrayBufferObject $buffer, int $byte_offset, ?int $length)
+
+class V8\Int16ArrayObject
+    extends V8\TypedArrayObject
+    implements V8\AdjustableExternalMemoryInterface
+    public function __construct(V8\Context $context, V8\ArrayBufferObject $buffer, int $byte_offset, ?int $length)
+
+class V8\Uint32ArrayObject
+    extends V8\TypedArrayObject
+    implements V8\AdjustableExternalMemoryInterface
+    public function __construct(V8\Context $context, V8\ArrayBufferObject $buffer, int $byte_offset, ?int $length)
+
+class V8\Int32ArrayObject
+    extends V8\TypedArrayObject
+    implements V8\AdjustableExternalMemoryInterface
+    public function __construct(V8\Context $context, V8\ArrayBufferObject $buffer, int $byte_offset, ?int $length)
+
+class V8\Float32ArrayObject
+    extends V8\TypedArrayObject
+    implements V8\AdjustableExternalMemoryInterface
+    public function __construct(V8\Context $context, V8\ArrayBufferObject $buffer, int $byte_offset, ?int $length)
+
+class V8\Float64ArrayObject
+    extends V8\TypedArrayObject
+    implements V8\AdjustableExternalMemoryInterface
+    public function __construct(V8\Context $context, V8\ArrayBufferObject $buffer, int $byte_offset, ?int $length)
+
+class V8\DataViewObject
+    extends V8\ArrayBufferViewObject
+    implements V8\AdjustableExternalMemoryInterface
+    public function __construct(V8\Context $context, V8\ArrayBufferObject $buffer, int $byte_offset, ?int $byte_length)
+
 class V8\NumberObject
     extends V8\ObjectValue
     implements V8\AdjustableExternalMemoryInterface
@@ -846,6 +978,19 @@ class V8\SymbolObject
     public function __construct(V8\Context $context, V8\SymbolValue $value)
     public function valueOf(): V8\SymbolValue
 
+class V8\PreparedCall
+    private $isolate
+    private $context
+    private $function
+    private $receiver
+    public function __construct(V8\Context $context, V8\FunctionObject $function, V8\Value $recv)
+    public function getIsolate(): V8\Isolate
+    public function getContext(): V8\Context
+    public function getFunction(): V8\FunctionObject
+    public function getReceiver(): V8\Value
+    public function invoke(...$arguments)
+    public function invokeBatch(array $arg_lists): array
+
 abstract class V8\Template
     extends V8\Data
     private $isolate
@@ -854,6 +999,9 @@ abstract class V8\Template
     abstract public function setAccessorProperty(V8\NameValue $name, V8\FunctionTemplate $getter, V8\FunctionTemplate $setter, int $attributes, int $settings)
     abstract public function setNativeDataProperty(V8\NameValue $name, callable $getter, ?callable $setter, int $attributes, ?V8\FunctionTemplate $receiver, int $settings)
     abstract public function setLazyDataProperty(V8\NameValue $name, callable $getter, int $attributes)
+    abstract public function bindConstant(V8\NameValue $name, $value, int $attributes)
+    abstract public function bindProperty(V8\NameValue $name, object $object, ?string $property, int $attributes)
+    abstract public function bindArrayOffset(V8\NameValue $name, array $array, $offset, int $attributes)
 
 class V8\ObjectTemplate
     extends V8\Template
@@ -864,25 +1012,33 @@ class V8\ObjectTemplate
     public function setAccessorProperty(V8\NameValue $name, V8\FunctionTemplate $getter, V8\FunctionTemplate $setter, int $attributes, int $settings)
     public function setNativeDataProperty(V8\NameValue $name, callable $getter, ?callable $setter, int $attributes, ?V8\FunctionTemplate $receiver, int $settings)
     public function setLazyDataProperty(V8\NameValue $name, callable $getter, int $attributes)
+    public function bindConstant(V8\NameValue $name, $value, int $attributes)
+    public function bindProperty(V8\NameValue $name, object $object, ?string $property, int $attributes)
+    public function bindArrayOffset(V8\NameValue $name, array $array, $offset, int $attributes)
     public function newInstance(V8\Context $value): V8\ObjectValue
-    public function setAccessor(V8\NameValue $name, callable $getter, ?callable $setter, int $settings, int $attributes, ?V8\FunctionTemplate $receiver)
+    public function setAccessor(V8\NameValue $name, callable $getter, ?callable $setter, int $settings, int $attributes, ?V8\FunctionTemplate $receiver, int $flags)
     public function setHandlerForNamedProperty(V8\NamedPropertyHandlerConfiguration $configuration)
     public function setHandlerForIndexedProperty(V8\IndexedPropertyHandlerConfiguration $configuration)
     public function setCallAsFunctionHandler($callback)
     public function isImmutableProto(): bool
     public function setImmutableProto()
+    public function internalFieldCount(): int
+    public function setInternalFieldCount(int $value)
     public function adjustExternalAllocatedMemory(int $change_in_bytes): int
     public function getExternalAllocatedMemory(): int
 
 class V8\FunctionTemplate
     extends V8\Template
     implements V8\AdjustableExternalMemoryInterface
-    public function __construct(V8\Isolate $isolate, ?callable $callback, ?V8\FunctionTemplate $receiver, int $length, int $behavior)
+    public function __construct(V8\Isolate $isolate, ?callable $callback, ?V8\FunctionTemplate $receiver, int $length, int $behavior, int $flags)
     public function getIsolate(): V8\Isolate
     public function set(V8\NameValue $name, V8\Data $value, int $attributes)
     public function setAccessorProperty(V8\NameValue $name, V8\FunctionTemplate $getter, V8\FunctionTemplate $setter, int $attributes, int $settings)
     public function setNativeDataProperty(V8\NameValue $name, callable $getter, ?callable $setter, int $attributes, ?V8\FunctionTemplate $receiver, int $settings)
     public function setLazyDataProperty(V8\NameValue $name, callable $getter, int $attributes)
+    public function bindConstant(V8\NameValue $name, $value, int $attributes)
+    public function bindProperty(V8\NameValue $name, object $object, ?string $property, int $attributes)
+    public function bindArrayOffset(V8\NameValue $name, array $array, $offset, int $attributes)
     public function getFunction(V8\Context $context): V8\FunctionObject
     public function setCallHandler(callable $callback)
     public function setLength(int $length)
@@ -937,14 +1093,6 @@ class V8\PropertyCallbackInfo
 
 class V8\FunctionCallbackInfo
     implements V8\CallbackInfoInterface
-    private $isolate
-    private $context
-    private $this
-    private $holder
-    private $return_value
-    private $arguments
-    private $new_target
-    private $is_constructor_call
     public function getIsolate(): V8\Isolate
     public function getContext(): V8\Context
     public function this(): V8\ObjectValue
@@ -952,6 +1100,7 @@ class V8\FunctionCallbackInfo
     public function getReturnValue(): V8\ReturnValue
     public function length(): int
     public function arguments(): array
+    public function argument(int $index): V8\Value
     public function newTarget(): V8\Value
     public function isConstructCall(): bool
 
@@ -964,3 +1113,10 @@ class V8\IndexedPropertyHandlerConfiguration
 class V8\JSON
     public static function parse(V8\Context $context, V8\StringValue $json_string): V8\Value
     public static function stringify(V8\Context $context, V8\Value $json_value, ?V8\StringValue $gap): string
+
+class V8\Serializer
+    public static function serialize(V8\Context $context, V8\Value $value, ?callable $host_object_writer): string
+
+class V8\Deserializer
+    public static function deserialize(V8\Context $context, string $data, ?callable $host_object_reader): V8\Value
+    public static function decode(string $data, ?callable $host_object_decoder)
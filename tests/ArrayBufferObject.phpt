@@ -0,0 +1,128 @@
+--TEST--
+V8\ArrayBufferObject
+--SKIPIF--
+<?php if (!extension_loaded("v8")) print "skip"; ?>
+--FILE--
+<?php
+
+/** @var \Phpv8Testsuite $helper */
+$helper = require '.testsuite.php';
+
+require '.v8-helpers.php';
+$v8_helper = new \PhpV8Helpers($helper);
+
+$isolate = new \V8\Isolate();
+$context = new \V8\Context($isolate);
+$global = $context->globalObject();
+
+$helper->header('Constructor');
+$buffer = new \V8\ArrayBufferObject($context, 4);
+$helper->assert('ArrayBuffer is ArrayBufferObject', $buffer instanceof \V8\ArrayBufferObject);
+$helper->assert('Buffer is ArrayBuffer', $buffer->isArrayBuffer());
+$helper->pretty_dump('Byte length', $buffer->byteLength());
+$helper->pretty_dump('Is external', $buffer->isExternal());
+$helper->pretty_dump('Contents', bin2hex($buffer->getContents()));
+$helper->pretty_dump('Empty buffer contents', (new \V8\ArrayBufferObject($context))->getContents());
+$helper->line();
+
+$helper->header('From string');
+$data = str_repeat("\x01\x02", 4);
+$buffer = \V8\ArrayBufferObject::fromString($context, $data);
+
+$helper->pretty_dump('Byte length', $buffer->byteLength());
+$helper->pretty_dump('Is external', $buffer->isExternal());
+$helper->assert('Contents are the same', $buffer->getContents() === $data);
+
+$global->set($context, new \V8\StringValue($isolate, 'shared_buffer'), $buffer);
+$v8_helper->CompileRun($context, 'new Uint8Array(shared_buffer)[0] = 0x41');
+$helper->pretty_dump('String is not changed from js', bin2hex($data));
+$helper->pretty_dump('Contents', bin2hex($buffer->getContents()));
+$helper->line();
+
+$helper->header('From unreferenced string');
+$buffer = \V8\ArrayBufferObject::fromString($context, str_repeat("\x01\x02", 4));
+$global->set($context, new \V8\StringValue($isolate, 'buffer'), $buffer);
+
+$helper->pretty_dump('Byte length', $buffer->byteLength());
+$helper->pretty_dump('Is external', $buffer->isExternal());
+$helper->pretty_dump('Seen from js', $v8_helper->CompileRun($context, 'Array.prototype.join.call(new Uint8Array(buffer), ",")')->value());
+$helper->assert('Same wrapper returned from js', $v8_helper->CompileRun($context, 'buffer') === $buffer);
+
+$contents = $buffer->getContents();
+$v8_helper->CompileRun($context, 'new Uint8Array(buffer)[0] = 0x41');
+$helper->pretty_dump('Contents are copied', bin2hex($contents));
+$helper->pretty_dump('Contents', bin2hex($buffer->getContents()));
+$helper->line();
+
+$helper->header('String outlives wrapper');
+$buffer = null;
+$helper->pretty_dump('Seen from js', $v8_helper->CompileRun($context, 'Array.prototype.join.call(new Uint8Array(buffer), ",")')->value());
+$helper->pretty_dump('Contents', bin2hex($v8_helper->CompileRun($context, 'buffer')->getContents()));
+$helper->line();
+
+$helper->header('From interned string');
+$buffer = \V8\ArrayBufferObject::fromString($context, 'foo');
+$helper->pretty_dump('Is external', $buffer->isExternal());
+$helper->pretty_dump('Contents', $buffer->getContents());
+$helper->line();
+
+$helper->header('Created in js');
+$buffer = $v8_helper->CompileRun($context, 'var b = new ArrayBuffer(3); new Uint8Array(b).set([0x61, 0x62, 0x63]); b');
+$helper->assert('ArrayBuffer is ArrayBufferObject', $buffer instanceof \V8\ArrayBufferObject);
+$helper->pretty_dump('Contents', $buffer->getContents());
+$helper->line();
+
+$helper->header('Errors');
+
+try {
+    new \V8\ArrayBufferObject($context, -1);
+} catch (\Throwable $e) {
+    $helper->exception_export($e);
+}
+
+?>
+--EXPECT--
+Constructor:
+------------
+ArrayBuffer is ArrayBufferObject: ok
+Buffer is ArrayBuffer: ok
+Byte length: int(4)
+Is external: bool(false)
+Contents: string(8) "00000000"
+Empty buffer contents: string(0) ""
+
+From string:
+------------
+Byte length: int(8)
+Is external: bool(false)
+Contents are the same: ok
+String is not changed from js: string(16) "0102010201020102"
+Contents: string(16) "4102010201020102"
+
+From unreferenced string:
+-------------------------
+Byte length: int(8)
+Is external: bool(true)
+Seen from js: string(15) "1,2,1,2,1,2,1,2"
+Same wrapper returned from js: ok
+Contents are copied: string(16) "0102010201020102"
+Contents: string(16) "4102010201020102"
+
+String outlives wrapper:
+------------------------
+Seen from js: string(16) "65,2,1,2,1,2,1,2"
+Contents: string(16) "4102010201020102"
+
+From interned string:
+---------------------
+Is external: bool(false)
+Contents: string(3) "foo"
+
+Created in js:
+--------------
+ArrayBuffer is ArrayBufferObject: ok
+Contents: string(3) "abc"
+
+Errors:
+-------
+V8\Exceptions\ValueException: Byte length is out of range
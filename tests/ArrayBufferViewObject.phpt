@@ -0,0 +1,165 @@
+--TEST--
+V8\ArrayBufferViewObject, V8\TypedArrayObject and V8\DataViewObject
+--SKIPIF--
+<?php if (!extension_loaded("v8")) print "skip"; ?>
+--FILE--
+<?php
+
+/** @var \Phpv8Testsuite $helper */
+$helper = require '.testsuite.php';
+
+require '.v8-helpers.php';
+$v8_helper = new \PhpV8Helpers($helper);
+
+$isolate = new \V8\Isolate();
+$context = new \V8\Context($isolate);
+$global = $context->globalObject();
+
+$data = str_repeat("\x01\x00\x02\x00", 4);
+$buffer = \V8\ArrayBufferObject::fromString($context, $data);
+
+$helper->header('Typed arrays');
+$classes = [
+    \V8\Uint8ArrayObject::class,
+    \V8\Uint8ClampedArrayObject::class,
+    \V8\Int8ArrayObject::class,
+    \V8\Uint16ArrayObject::class,
+    \V8\Int16ArrayObject::class,
+    \V8\Uint32ArrayObject::class,
+    \V8\Int32ArrayObject::class,
+    \V8\Float32ArrayObject::class,
+    \V8\Float64ArrayObject::class,
+];
+
+foreach ($classes as $class) {
+    /** @var \V8\TypedArrayObject $array */
+    $array = new $class($context, $buffer);
+    $global->set($context, new \V8\StringValue($isolate, 'arr'), $array);
+    $helper->assert("{$class} is typed array", $array->isTypedArray() && $v8_helper->CompileRun($context, 'arr') === $array);
+    $helper->pretty_dump("{$class} length", $array->length());
+}
+$helper->line();
+
+$helper->header('Ranges');
+$array = new \V8\Uint16ArrayObject($context, $buffer, 4, 2);
+$global->set($context, new \V8\StringValue($isolate, 'arr'), $array);
+$helper->pretty_dump('Seen from js', $v8_helper->CompileRun($context, 'Array.prototype.join.call(arr, ",")')->value());
+$helper->pretty_dump('Length', $array->length());
+$helper->pretty_dump('Byte offset', $array->byteOffset());
+$helper->pretty_dump('Byte length', $array->byteLength());
+$helper->pretty_dump('Has buffer', $array->hasBuffer());
+$helper->assert('Buffer is the same', $array->buffer() === $buffer);
+$helper->pretty_dump('Contents', bin2hex($array->getContents()));
+$helper->assert('Whole view contents are the same', (new \V8\Uint8ArrayObject($context, $buffer))->getContents() === $data);
+$helper->line();
+
+$helper->header('DataView');
+$view = new \V8\DataViewObject($context, $buffer, 2);
+$global->set($context, new \V8\StringValue($isolate, 'view'), $view);
+$helper->assert('DataView is DataViewObject', $view->isDataView() && $v8_helper->CompileRun($context, 'view') === $view);
+$helper->pretty_dump('Byte length', $view->byteLength());
+$helper->pretty_dump('Seen from js', $v8_helper->CompileRun($context, 'view.getUint16(0, true)')->value());
+$helper->line();
+
+$helper->header('Created in js');
+$array = $v8_helper->CompileRun($context, 'new Int16Array([1, -1])');
+$helper->pretty_dump('Class', get_class($array));
+$helper->pretty_dump('Contents', bin2hex($array->getContents()));
+$helper->pretty_dump('Class', get_class($v8_helper->CompileRun($context, 'new DataView(new ArrayBuffer(2))')));
+$helper->line();
+
+$helper->header('Errors');
+
+try {
+    new \V8\Uint16ArrayObject($context, $buffer, 1);
+} catch (\Throwable $e) {
+    $helper->exception_export($e);
+}
+
+try {
+    new \V8\Uint8ArrayObject($context, $buffer, 17);
+} catch (\Throwable $e) {
+    $helper->exception_export($e);
+}
+
+try {
+    new \V8\Uint32ArrayObject($context, $buffer, 8, 3);
+} catch (\Throwable $e) {
+    $helper->exception_export($e);
+}
+
+try {
+    new \V8\Float64ArrayObject($context, new \V8\ArrayBufferObject($context, 12));
+} catch (\Throwable $e) {
+    $helper->exception_export($e);
+}
+
+try {
+    new \V8\DataViewObject($context, $buffer, 0, 17);
+} catch (\Throwable $e) {
+    $helper->exception_export($e);
+}
+
+try {
+    $isolate2 = new \V8\Isolate();
+    $context2 = new \V8\Context($isolate2);
+
+    new \V8\Uint8ArrayObject($context2, $buffer);
+} catch (\Throwable $e) {
+    $helper->exception_export($e);
+}
+
+?>
+--EXPECT--
+Typed arrays:
+-------------
+V8\Uint8ArrayObject is typed array: ok
+V8\Uint8ArrayObject length: int(16)
+V8\Uint8ClampedArrayObject is typed array: ok
+V8\Uint8ClampedArrayObject length: int(16)
+V8\Int8ArrayObject is typed array: ok
+V8\Int8ArrayObject length: int(16)
+V8\Uint16ArrayObject is typed array: ok
+V8\Uint16ArrayObject length: int(8)
+V8\Int16ArrayObject is typed array: ok
+V8\Int16ArrayObject length: int(8)
+V8\Uint32ArrayObject is typed array: ok
+V8\Uint32ArrayObject length: int(4)
+V8\Int32ArrayObject is typed array: ok
+V8\Int32ArrayObject length: int(4)
+V8\Float32ArrayObject is typed array: ok
+V8\Float32ArrayObject length: int(4)
+V8\Float64ArrayObject is typed array: ok
+V8\Float64ArrayObject length: int(2)
+
+Ranges:
+-------
+Seen from js: string(3) "1,2"
+Length: int(2)
+Byte offset: int(4)
+Byte length: int(4)
+Has buffer: bool(true)
+Buffer is the same: ok
+Contents: string(8) "01000200"
+Whole view contents are the same: ok
+
+DataView:
+---------
+DataView is DataViewObject: ok
+Byte length: int(14)
+Seen from js: int(2)
+
+Created in js:
+--------------
+Class: string(19) "V8\Int16ArrayObject"
+Contents: string(8) "0100ffff"
+Class: string(17) "V8\DataViewObject"
+
+Errors:
+-------
+V8\Exceptions\ValueException: Byte offset should be a multiple of 2
+V8\Exceptions\ValueException: Byte offset is out of range
+V8\Exceptions\ValueException: Length is out of range
+V8\Exceptions\ValueException: Byte length of buffer should be a multiple of 8
+V8\Exceptions\ValueException: Length is out of range
+V8\Exceptions\Exception: Isolates mismatch
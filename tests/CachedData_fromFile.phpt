@@ -0,0 +1,67 @@
+--TEST--
+V8\ScriptCompiler\CachedData::fromFile()
+--SKIPIF--
+<?php if (!extension_loaded("v8")) print "skip"; ?>
+--FILE--
+<?php
+
+/** @var \Phpv8Testsuite $helper */
+$helper = require '.testsuite.php';
+
+use V8\ScriptCompiler\CachedData;
+
+
+$file = tempnam(sys_get_temp_dir(), 'php-v8-cached-data');
+
+$isolate = new V8\Isolate();
+$context = new V8\Context($isolate);
+
+$source_string = new V8\StringValue($isolate, "function f() { return 'abc'; }; f() + 'def'");
+$source        = new \V8\ScriptCompiler\Source($source_string);
+$unbound       = V8\ScriptCompiler::compileUnboundScript($context, $source);
+
+file_put_contents($file, V8\ScriptCompiler::createCodeCache($unbound, $source_string)->getData());
+
+$cache_data = CachedData::fromFile($file);
+$helper->assert('Mapped cache data is the same as written', $cache_data->getData() === file_get_contents($file));
+
+$source = new \V8\ScriptCompiler\Source($source_string, null, $cache_data);
+$test_unbound = V8\ScriptCompiler::compileUnboundScript($context, $source, V8\ScriptCompiler::OPTION_CONSUME_CODE_CACHE);
+$helper->assert('Mapped cache data is not rejected', $cache_data->isRejected() === false);
+$helper->pretty_dump('Script result', $test_unbound->bindToContext($context)->run($context)->toString($context)->value());
+$helper->line();
+
+$cache_data->persist('test');
+$helper->assert('Mapped cache data persisted as is', CachedData::fetchPersisted('test')->getData() === file_get_contents($file));
+CachedData::forgetPersisted('test');
+$helper->line();
+
+// replace file rather than truncate it, as it is still mapped by cache data above
+unlink($file);
+file_put_contents($file, 'garbage');
+
+$cache_data = CachedData::fromFile($file);
+$source = new \V8\ScriptCompiler\Source($source_string, null, $cache_data);
+V8\ScriptCompiler::compileUnboundScript($context, $source, V8\ScriptCompiler::OPTION_CONSUME_CODE_CACHE);
+$helper->assert('Mapped garbage is rejected', $cache_data->isRejected() === true);
+$helper->line();
+
+unlink($file);
+
+try {
+    CachedData::fromFile($file);
+} catch (\V8\Exceptions\Exception $e) {
+    $helper->exception_export($e);
+}
+
+?>
+--EXPECTF--
+Mapped cache data is the same as written: ok
+Mapped cache data is not rejected: ok
+Script result: string(6) "abcdef"
+
+Mapped cache data persisted as is: ok
+
+Mapped garbage is rejected: ok
+
+V8\Exceptions\Exception: Unable to map cached data file '%s': No such file or directory
@@ -0,0 +1,77 @@
+--TEST--
+V8\ScriptCompiler\CachedData::persist()
+--SKIPIF--
+<?php if (!extension_loaded("v8")) print "skip"; ?>
+--FILE--
+<?php
+
+/** @var \Phpv8Testsuite $helper */
+$helper = require '.testsuite.php';
+
+use V8\ScriptCompiler\CachedData;
+
+
+$isolate = new V8\Isolate();
+$context = new V8\Context($isolate);
+
+$source_string = new V8\StringValue($isolate, "function f() { return 'abc'; }; f() + 'def'");
+$source        = new \V8\ScriptCompiler\Source($source_string);
+$unbound       = V8\ScriptCompiler::compileUnboundScript($context, $source);
+
+$cache_data = V8\ScriptCompiler::createCodeCache($unbound, $source_string);
+
+$helper->assert('Nothing persisted under unknown name', CachedData::fetchPersisted('test') === null);
+$helper->assert('Nothing to forget under unknown name', CachedData::forgetPersisted('test') === false);
+$helper->line();
+
+$cache_data->persist('test');
+$helper->assert('Persisted cache data still usable', strlen($cache_data->getData()) > 1);
+
+$persisted = CachedData::fetchPersisted('test');
+$helper->assert('Persisted cache data fetched', $persisted instanceof CachedData);
+$helper->assert('Fetched cache data is not the same object', $persisted !== $cache_data);
+$helper->assert('Fetched cache data is the same', $persisted->getData() === $cache_data->getData());
+$cache_data = null;
+$helper->line();
+
+$source = new \V8\ScriptCompiler\Source($source_string, null, $persisted);
+$test_unbound = V8\ScriptCompiler::compileUnboundScript($context, $source, V8\ScriptCompiler::OPTION_CONSUME_CODE_CACHE);
+$helper->assert('Fetched cache data is not rejected', $source->getCachedData()->isRejected() === false);
+$helper->pretty_dump('Script result', $test_unbound->bindToContext($context)->run($context)->toString($context)->value());
+$helper->line();
+
+$rejected = new CachedData('garbage');
+$source = new \V8\ScriptCompiler\Source($source_string, null, $rejected);
+V8\ScriptCompiler::compileUnboundScript($context, $source, V8\ScriptCompiler::OPTION_CONSUME_CODE_CACHE);
+
+try {
+    $rejected->persist('test');
+} catch (\V8\Exceptions\Exception $e) {
+    $helper->exception_export($e);
+}
+$helper->assert('Previously persisted cache data kept', CachedData::fetchPersisted('test')->getData() === $persisted->getData());
+$helper->line();
+
+$helper->assert('Persisted cache data forgotten', CachedData::forgetPersisted('test') === true);
+$helper->assert('Forgotten cache data can not be fetched', CachedData::fetchPersisted('test') === null);
+$helper->assert('Previously fetched cache data still usable', strlen($persisted->getData()) > 1);
+
+?>
+--EXPECT--
+Nothing persisted under unknown name: ok
+Nothing to forget under unknown name: ok
+
+Persisted cache data still usable: ok
+Persisted cache data fetched: ok
+Fetched cache data is not the same object: ok
+Fetched cache data is the same: ok
+
+Fetched cache data is not rejected: ok
+Script result: string(6) "abcdef"
+
+V8\Exceptions\Exception: Unable to persist rejected cached data
+Previously persisted cache data kept: ok
+
+Persisted cache data forgotten: ok
+Forgotten cache data can not be fetched: ok
+Previously fetched cache data still usable: ok
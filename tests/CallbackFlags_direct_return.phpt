@@ -0,0 +1,130 @@
+--TEST--
+V8\CallbackFlags::DIRECT_RETURN
+--SKIPIF--
+<?php if (!extension_loaded("v8")) print "skip"; ?>
+--FILE--
+<?php
+
+/** @var \Phpv8Testsuite $helper */
+$helper = require '.testsuite.php';
+
+require '.v8-helpers.php';
+$v8_helper = new \PhpV8Helpers($helper);
+
+$isolate = new \V8\Isolate();
+$context = new \V8\Context($isolate);
+$global = $context->globalObject();
+
+$returns = [
+    'null'   => null,
+    'bool'   => true,
+    'int'    => 42,
+    'long'   => 2147483648,
+    'float'  => 1.5,
+    'string' => 'foo',
+    'array'  => ['foo' => [1, 2], 'bar' => 'baz'],
+    'value'  => new \V8\StringValue($isolate, 'bar'),
+];
+
+$current = null;
+
+$func = new \V8\FunctionObject($context, function (\V8\FunctionCallbackInfo $info) use (&$current) {
+    return $current;
+}, 0, \V8\ConstructorBehavior::ALLOW, \V8\CallbackFlags::DIRECT_RETURN);
+$global->set($context, new \V8\StringValue($isolate, 'func'), $func);
+
+$helper->header('FunctionObject');
+foreach ($returns as $name => $current) {
+    $helper->pretty_dump($name, $v8_helper->CompileRun($context, 'typeof func() + ":" + JSON.stringify(func())')->value());
+}
+$helper->line();
+
+
+$helper->header('FunctionTemplate');
+$tpl = new \V8\FunctionTemplate($isolate, function (\V8\FunctionCallbackInfo $info) {
+    return $info->argument(0)->value() * 2;
+}, null, 0, \V8\ConstructorBehavior::ALLOW, \V8\CallbackFlags::DIRECT_RETURN);
+$global->set($context, new \V8\StringValue($isolate, 'twice'), $tpl->getFunction($context));
+$helper->pretty_dump('Result', $v8_helper->CompileRun($context, 'twice(21)')->value());
+
+$tpl = new \V8\FunctionTemplate($isolate, function (\V8\FunctionCallbackInfo $info) {
+    return 'ignored';
+});
+$global->set($context, new \V8\StringValue($isolate, 'ignored'), $tpl->getFunction($context));
+$helper->pretty_dump('Without flag', $v8_helper->CompileRun($context, 'typeof ignored()')->value());
+$helper->line();
+
+
+$helper->header('Null keeps ReturnValue result');
+$mixed = new \V8\FunctionObject($context, function (\V8\FunctionCallbackInfo $info) {
+    $info->getReturnValue()->set(new \V8\StringValue($info->getIsolate(), 'set via ReturnValue'));
+}, 0, \V8\ConstructorBehavior::ALLOW, \V8\CallbackFlags::DIRECT_RETURN);
+$global->set($context, new \V8\StringValue($isolate, 'mixed'), $mixed);
+$helper->pretty_dump('Result', $v8_helper->CompileRun($context, 'mixed()')->value());
+$helper->line();
+
+
+$helper->header('ObjectTemplate::setAccessor()');
+$obj_tpl = new \V8\ObjectTemplate($isolate);
+$obj_tpl->setAccessor(new \V8\StringValue($isolate, 'answer'), function (\V8\NameValue $name, \V8\PropertyCallbackInfo $info) {
+    return $name->value() . ' is 42';
+}, null, \V8\AccessControl::DEFAULT_ACCESS, \V8\PropertyAttribute::NONE, null, \V8\CallbackFlags::DIRECT_RETURN);
+$global->set($context, new \V8\StringValue($isolate, 'obj'), $obj_tpl->newInstance($context));
+$helper->pretty_dump('Result', $v8_helper->CompileRun($context, 'obj.answer')->value());
+$helper->line();
+
+
+$helper->header('Errors');
+$bad = new \V8\FunctionObject($context, function (\V8\FunctionCallbackInfo $info) {
+    return fopen('php://memory', 'r');
+}, 0, \V8\ConstructorBehavior::ALLOW, \V8\CallbackFlags::DIRECT_RETURN);
+$global->set($context, new \V8\StringValue($isolate, 'bad'), $bad);
+
+try {
+    $v8_helper->CompileRun($context, 'bad()');
+} catch (\Throwable $e) {
+    $helper->exception_export($e);
+}
+
+$isolate2 = new \V8\Isolate();
+$foreign = new \V8\FunctionObject($context, function (\V8\FunctionCallbackInfo $info) use ($isolate2) {
+    return new \V8\StringValue($isolate2, 'foreign');
+}, 0, \V8\ConstructorBehavior::ALLOW, \V8\CallbackFlags::DIRECT_RETURN);
+$global->set($context, new \V8\StringValue($isolate, 'foreign'), $foreign);
+
+try {
+    $v8_helper->CompileRun($context, 'foreign()');
+} catch (\Throwable $e) {
+    $helper->exception_export($e);
+}
+
+?>
+--EXPECT--
+FunctionObject:
+---------------
+null: string(19) "undefined:undefined"
+bool: string(12) "boolean:true"
+int: string(9) "number:42"
+long: string(17) "number:2147483648"
+float: string(10) "number:1.5"
+string: string(12) "string:"foo""
+array: string(32) "object:{"foo":[1,2],"bar":"baz"}"
+value: string(12) "string:"bar""
+
+FunctionTemplate:
+-----------------
+Result: int(42)
+Without flag: string(9) "undefined"
+
+Null keeps ReturnValue result:
+------------------------------
+Result: string(19) "set via ReturnValue"
+
+ObjectTemplate::setAccessor():
+------------------------------
+Result: string(12) "answer is 42"
+
+Errors:
+-------
+V8\Exceptions\ValueException: Unable to convert value of type resource
+V8\Exceptions\Exception: Isolates mismatch
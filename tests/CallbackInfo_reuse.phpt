@@ -0,0 +1,107 @@
+--TEST--
+V8\FunctionCallbackInfo and V8\PropertyCallbackInfo objects are reused between callback invocations
+--SKIPIF--
+<?php if (!extension_loaded("v8")) print "skip"; ?>
+--FILE--
+<?php
+
+/** @var \Phpv8Testsuite $helper */
+$helper = require '.testsuite.php';
+
+require '.v8-helpers.php';
+$v8_helper = new PhpV8Helpers($helper);
+
+$isolate = new \V8\Isolate();
+$context = new \V8\Context($isolate);
+
+$ids = [];
+$kept = null;
+
+$func = new \V8\FunctionObject($context, function (\V8\FunctionCallbackInfo $info) use (&$ids, &$kept) {
+    $ids[] = spl_object_id($info);
+
+    if ($info->length() && $info->arguments()[0]->value() === 'keep') {
+        $kept = $info;
+    }
+
+    $info->getReturnValue()->setInteger(count($ids));
+});
+
+$context->globalObject()->set($context, new \V8\StringValue($isolate, 'func'), $func);
+
+$res = $v8_helper->CompileRun($context, 'func(); func(); func("keep"); func(); func()');
+
+$helper->header('Function callback');
+$helper->pretty_dump('Last result', $res->value());
+$helper->assert('Unreferenced callback info is reused', $ids[0] === $ids[1]);
+$helper->assert('Referenced callback info is not reused', $ids[2] !== $ids[3]);
+$helper->assert('Callback info is reused again after referenced one released', $ids[3] === $ids[4]);
+$helper->assert('Referenced callback info keeps its arguments', $kept->arguments()[0]->value() === 'keep');
+$helper->assert('Referenced callback info keeps its context', $kept->getContext() === $context);
+
+try {
+    $kept->getReturnValue()->setInteger(42);
+} catch (\V8\Exceptions\Exception $e) {
+    $helper->exception_export($e);
+}
+$helper->line();
+
+
+$ids = [];
+
+$nested = new \V8\FunctionObject($context, function (\V8\FunctionCallbackInfo $info) use (&$ids, $v8_helper) {
+    $ids[] = spl_object_id($info);
+
+    if ($info->length()) {
+        $v8_helper->CompileRun($info->getContext(), 'nested()');
+        $ids[] = spl_object_id($info);
+    }
+});
+
+$context->globalObject()->set($context, new \V8\StringValue($isolate, 'nested'), $nested);
+$v8_helper->CompileRun($context, 'nested(true)');
+
+$helper->header('Nested function callback');
+$helper->assert('Nested callback gets its own callback info', $ids[0] !== $ids[1]);
+$helper->assert('Outer callback info is untouched by nested call', $ids[0] === $ids[2]);
+$helper->line();
+
+
+$ids = [];
+$obj = new \V8\ObjectValue($context);
+
+$obj->setAccessor($context, new \V8\StringValue($isolate, 'test'), function (\V8\NameValue $name, \V8\PropertyCallbackInfo $info) use (&$ids, $isolate) {
+    $ids[] = spl_object_id($info);
+
+    $info->getReturnValue()->set(new \V8\StringValue($isolate, $name->value() . ' ' . count($ids)));
+});
+
+$context->globalObject()->set($context, new \V8\StringValue($isolate, 'obj'), $obj);
+
+$res = $v8_helper->CompileRun($context, 'obj.test + ", " + obj.test');
+
+$helper->header('Property callback');
+$helper->pretty_dump('Result', $res->value());
+$helper->assert('Unreferenced callback info is reused', $ids[0] === $ids[1]);
+
+?>
+--EXPECT--
+Function callback:
+------------------
+Last result: int(5)
+Unreferenced callback info is reused: ok
+Referenced callback info is not reused: ok
+Callback info is reused again after referenced one released: ok
+Referenced callback info keeps its arguments: ok
+Referenced callback info keeps its context: ok
+V8\Exceptions\Exception: Attempt to use return value out of calling function context
+
+Nested function callback:
+-------------------------
+Nested callback gets its own callback info: ok
+Outer callback info is untouched by nested call: ok
+
+Property callback:
+------------------
+Result: string(14) "test 1, test 2"
+Unreferenced callback info is reused: ok
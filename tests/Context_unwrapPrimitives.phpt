@@ -0,0 +1,79 @@
+--TEST--
+V8\Context::setUnwrapPrimitives()
+--SKIPIF--
+<?php if (!extension_loaded("v8")) print "skip"; ?>
+--FILE--
+<?php
+
+/** @var \Phpv8Testsuite $helper */
+$helper = require '.testsuite.php';
+
+require '.v8-helpers.php';
+$v8_helper = new PhpV8Helpers($helper);
+
+$isolate = new \V8\Isolate();
+$context = new V8\Context($isolate);
+
+$helper->method_matches_with_output($context, 'getUnwrapPrimitives', false);
+$helper->line();
+
+$object = $v8_helper->CompileRun($context, '({
+    string: "test",
+    int: 42,
+    float: 4.2,
+    bool: true,
+    nil: null,
+    symbol: Symbol("foo"),
+    nested: {},
+    add: function (a, b) { return a + b; },
+})');
+
+$helper->value_instanceof($object->get($context, new \V8\StringValue($isolate, 'int')), V8\Int32Value::class);
+$helper->value_instanceof($v8_helper->CompileRun($context, '"test"'), V8\StringValue::class);
+$helper->line();
+
+$context->setUnwrapPrimitives(true);
+$helper->method_matches_with_output($context, 'getUnwrapPrimitives', true);
+$helper->line();
+
+foreach (['string', 'int', 'float', 'bool', 'nil', 'missing'] as $key) {
+    $helper->pretty_dump($key, $object->get($context, new \V8\StringValue($isolate, $key)));
+}
+$helper->value_instanceof($object->get($context, new \V8\StringValue($isolate, 'symbol')), V8\SymbolValue::class);
+$helper->value_instanceof($object->get($context, new \V8\StringValue($isolate, 'nested')), V8\ObjectValue::class);
+$helper->line();
+
+$add = $object->get($context, new \V8\StringValue($isolate, 'add'));
+$helper->value_instanceof($add, V8\FunctionObject::class);
+$helper->pretty_dump('Function call', $add->call($context, $object, [new \V8\Int32Value($isolate, 2), new \V8\Int32Value($isolate, 3)]));
+$helper->pretty_dump('Script run', $v8_helper->CompileRun($context, '"te" + "st"'));
+$helper->pretty_dump('Script run undefined', $v8_helper->CompileRun($context, 'undefined'));
+$helper->line();
+
+$other = new V8\Context($isolate);
+$helper->value_instanceof($object->get($other, new \V8\StringValue($isolate, 'int')), V8\Int32Value::class);
+
+?>
+--EXPECT--
+V8\Context::getUnwrapPrimitives() matches expected false
+
+Value is instance of V8\Int32Value
+Value is instance of V8\StringValue
+
+V8\Context::getUnwrapPrimitives() matches expected true
+
+string: string(4) "test"
+int: int(42)
+float: float(4.2)
+bool: bool(true)
+nil: NULL
+missing: NULL
+Value is instance of V8\SymbolValue
+Value is instance of V8\ObjectValue
+
+Value is instance of V8\FunctionObject
+Function call: int(5)
+Script run: string(4) "test"
+Script run undefined: NULL
+
+Value is instance of V8\Int32Value
@@ -0,0 +1,180 @@
+--TEST--
+V8\Deserializer::decode()
+--SKIPIF--
+<?php if (!extension_loaded("v8")) print "skip"; ?>
+--FILE--
+<?php
+
+/** @var \Phpv8Testsuite $helper */
+$helper = require '.testsuite.php';
+
+require '.v8-helpers.php';
+$v8_helper = new PhpV8Helpers($helper);
+
+// Tests:
+
+$isolate = new V8\Isolate();
+$context = new V8\Context($isolate);
+
+$serialize = function (string $source) use ($v8_helper, $context) {
+    return V8\Serializer::serialize($context, $v8_helper->CompileRun($context, $source));
+};
+
+$decode = function (string $source) use ($serialize) {
+    return V8\Deserializer::decode($serialize($source));
+};
+
+$helper->header('Primitives');
+$helper->pretty_dump('undefined', $decode('undefined'));
+$helper->pretty_dump('null', $decode('null'));
+$helper->pretty_dump('true', $decode('true'));
+$helper->pretty_dump('int', $decode('42'));
+$helper->pretty_dump('negative int', $decode('-42'));
+$helper->pretty_dump('double', $decode('4.2'));
+$helper->pretty_dump('one-byte string', $decode('"ünïcödé"'));
+$helper->pretty_dump('two-byte string', $decode('"фу\u{1F600}"'));
+$helper->pretty_dump('lone surrogate', $decode('"\uD800"'));
+$helper->space();
+
+$helper->header('Arrays and objects');
+$helper->assert('Array', [1, 'two', null, null] === $decode('[1, "two", null, undefined]'));
+$helper->assert('Array with holes', [0 => 1, 2 => 3] === $decode('[1, , 3]'));
+$helper->assert('Object', ['foo' => 'bar', 'nested' => ['list' => [1, 2]]] === $decode('({foo: "bar", nested: {list: [1, 2]}})'));
+$helper->assert('Object with index keys', [1 => 'one', 'two' => 2] === $decode('({1: "one", two: 2})'));
+$helper->assert('Shared objects are copied', [[], []] === $decode('var shared = {}; [shared, shared]'));
+$helper->space();
+
+$helper->header('Built-in objects');
+$helper->assert('Date', 1500000000000.0 === $decode('new Date(1500000000000)'));
+$helper->assert('RegExp', '/foo/gi' === $decode('/foo/ig'));
+$helper->assert('Map', [['key', 'value'], [1, [2]]] === $decode('new Map([["key", "value"], [1, [2]]])'));
+$helper->assert('Set', [1, 'two'] === $decode('new Set([1, "two"])'));
+$helper->assert('Boxed primitives', [false, 4.5, 'str'] === $decode('[new Boolean(false), new Number(4.5), new String("str")]'));
+$helper->space();
+
+$helper->header('Buffers and views');
+$helper->assert('ArrayBuffer', 'hi' === $decode('new Uint8Array([104, 105]).buffer'));
+$helper->assert('DataView', 'i' === $decode('new DataView(new Uint8Array([104, 105]).buffer, 1)'));
+$helper->assert('Uint8Array', [1, 2, 255] === $decode('new Uint8Array([1, 2, 255])'));
+$helper->assert('Int16Array', [-1, 32767] === $decode('new Int16Array([-1, 32767])'));
+$helper->assert('Uint32Array', [4294967295] === $decode('new Uint32Array([4294967295])'));
+$helper->assert('Float64Array', [0.5, -1.25] === $decode('new Float64Array([0.5, -1.25])'));
+$helper->assert('Views share buffer', [[1, 2, 3, 4], [3, 4]] === $decode('var b = new Uint8Array([1, 2, 3, 4]); [b, new Uint8Array(b.buffer, 2)]'));
+$helper->space();
+
+$helper->header('Host objects');
+
+$template = new V8\ObjectTemplate($isolate);
+$template->setInternalFieldCount(1);
+
+$data = V8\Serializer::serialize($context, $template->newInstance($context), function () {
+    return 'host data';
+});
+
+$helper->assert('Host object data returned as is', 'host data' === V8\Deserializer::decode($data));
+$helper->assert('Host object data decoded with callback', ['decoded' => 'host data'] === V8\Deserializer::decode($data, function (string $data) {
+    return ['decoded' => $data];
+}));
+$helper->space();
+
+$helper->header('Errors');
+
+try {
+    V8\Deserializer::decode('garbage');
+} catch (V8\Exceptions\ValueException $e) {
+    $helper->exception_export($e);
+}
+
+try {
+    V8\Deserializer::decode(substr($serialize('({foo: "bar"})'), 0, -1));
+} catch (V8\Exceptions\ValueException $e) {
+    $helper->exception_export($e);
+}
+
+try {
+    $decode('var o = {}; o.self = o; o');
+} catch (V8\Exceptions\ValueException $e) {
+    $helper->exception_export($e);
+}
+
+try {
+    $decode('var a = []; for (var i = 0; i < 600; i++) { a = [a]; } a');
+} catch (V8\Exceptions\ValueException $e) {
+    $helper->exception_export($e);
+}
+
+$helper->pretty_dump('Long run of object count tags', V8\Deserializer::decode("\xFF\x0D" . str_repeat("?\x00", 1000000) . '_'));
+
+try {
+    V8\Deserializer::decode("\xFF\x0D" . str_repeat("?\x00", 1000000));
+} catch (V8\Exceptions\ValueException $e) {
+    $helper->exception_export($e);
+}
+
+try {
+    V8\Deserializer::decode($data, function () {
+        throw new RuntimeException('Decoder failed');
+    });
+} catch (RuntimeException $e) {
+    $helper->exception_export($e);
+}
+
+?>
+--EXPECT--
+Primitives:
+-----------
+undefined: NULL
+null: NULL
+true: bool(true)
+int: int(42)
+negative int: int(-42)
+double: float(4.2)
+one-byte string: string(11) "ünïcödé"
+two-byte string: string(8) "фу😀"
+lone surrogate: string(3) "�"
+
+
+Arrays and objects:
+-------------------
+Array: ok
+Array with holes: ok
+Object: ok
+Object with index keys: ok
+Shared objects are copied: ok
+
+
+Built-in objects:
+-----------------
+Date: ok
+RegExp: ok
+Map: ok
+Set: ok
+Boxed primitives: ok
+
+
+Buffers and views:
+------------------
+ArrayBuffer: ok
+DataView: ok
+Uint8Array: ok
+Int16Array: ok
+Uint32Array: ok
+Float64Array: ok
+Views share buffer: ok
+
+
+Host objects:
+-------------
+Host object data returned as is: ok
+Host object data decoded with callback: ok
+
+
+Errors:
+-------
+V8\Exceptions\ValueException: Serialized data has no version header
+V8\Exceptions\ValueException: Unexpected end of serialized data
+V8\Exceptions\ValueException: Unable to decode circular structure
+V8\Exceptions\ValueException: Maximum nesting depth of 512 exceeded
+Long run of object count tags: NULL
+V8\Exceptions\ValueException: Unexpected end of serialized data
+RuntimeException: Decoder failed
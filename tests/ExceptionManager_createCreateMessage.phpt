@@ -88,7 +88,7 @@ Message created from thrown value:
 V8\Message->get(): string(18) "Uncaught #<Object>"
 V8\Message->getSourceLine(): string(24) "        test(exception);"
 V8\Message->getScriptOrigin():
-    object(V8\ScriptOrigin)#15 (6) {
+    object(V8\ScriptOrigin)#%d (6) {
       ["resource_name":"V8\ScriptOrigin":private]=>
       string(7) "test.js"
       ["resource_line_offset":"V8\ScriptOrigin":private]=>
@@ -100,7 +100,7 @@ V8\Message->getScriptOrigin():
       ["source_map_url":"V8\ScriptOrigin":private]=>
       string(0) ""
       ["options":"V8\ScriptOrigin":private]=>
-      object(V8\ScriptOriginOptions)#13 (1) {
+      object(V8\ScriptOriginOptions)#%d (1) {
         ["flags":"V8\ScriptOriginOptions":private]=>
         int(0)
       }
@@ -119,7 +119,7 @@ Message created from created value:
 V8\Message->get(): string(13) "Uncaught test"
 V8\Message->getSourceLine(): string(24) "        test(exception);"
 V8\Message->getScriptOrigin():
-    object(V8\ScriptOrigin)#34 (6) {
+    object(V8\ScriptOrigin)#%d (6) {
       ["resource_name":"V8\ScriptOrigin":private]=>
       string(7) "test.js"
       ["resource_line_offset":"V8\ScriptOrigin":private]=>
@@ -131,7 +131,7 @@ V8\Message->getScriptOrigin():
       ["source_map_url":"V8\ScriptOrigin":private]=>
       string(0) ""
       ["options":"V8\ScriptOrigin":private]=>
-      object(V8\ScriptOriginOptions)#33 (1) {
+      object(V8\ScriptOriginOptions)#%d (1) {
         ["flags":"V8\ScriptOriginOptions":private]=>
         int(0)
       }
@@ -15,6 +15,12 @@ $global_template = new V8\ObjectTemplate($isolate);
 $context = new V8\Context($isolate, $global_template);
 
 $helper->assert("FunctionCallbackInfo implements CallbackInfoInterface", new V8\FunctionCallbackInfo() instanceof V8\CallbackInfoInterface);
+
+try {
+    (new V8\FunctionCallbackInfo())->length();
+} catch (\V8\Exceptions\Exception $e) {
+    $helper->exception_export($e);
+}
 $helper->line();
 
 // TEST: Pass context instead of isolate to FunctionTemplate
@@ -41,6 +47,12 @@ $func = new v8Tests\TrackingDtors\FunctionObject($context, function (V8\Function
 
     $helper->assert('Scalars hold no info about their zval, so that their zvals are recreated on each access', $scalar !== $info->arguments()[0]);
     $helper->assert("Objects can hold info about their zval and keep it until zval's get free() ", $object === $info->arguments()[1]);
+
+    $helper->assert('Arguments array is created once', $info->arguments() === $info->arguments());
+    $helper->assert('Argument by index matches arguments()', $info->argument(1) === $info->arguments()[1]);
+    $helper->assert('Out of range argument is undefined', $info->argument(2) instanceof \V8\UndefinedValue && $info->argument(-1) instanceof \V8\UndefinedValue);
+    $helper->assert('This is the same object on each access', $info->this() === $info->this());
+    $helper->assert('Holder is the same as this for plain call', $info->holder() === $info->this());
 });
 
 $context->globalObject()->set($context, new \V8\StringValue($isolate, 'print'), $func);
@@ -69,91 +81,27 @@ $helper->header('Object representation (outside of context)');
 $helper->dump($callback_info);
 $helper->space();
 
+$helper->assert('Callback info keeps its arguments', $callback_info->length() === 2 && $callback_info->argument(0)->value() === 'test');
+$helper->assert('Callback info keeps its argument objects', $callback_info->argument(1) === $object);
+$helper->assert('Out of range argument is undefined', $callback_info->argument(2) instanceof \V8\UndefinedValue);
+$helper->assert('Callback info keeps this', $callback_info->this() instanceof \V8\ObjectValue);
+$helper->assert('Callback info keeps holder', $callback_info->holder() === $callback_info->this());
+$helper->assert('Callback info keeps new target', $callback_info->newTarget() instanceof \V8\UndefinedValue);
+$helper->assert('Callback info keeps construct call flag', $callback_info->isConstructCall() === false);
+$helper->line();
+
 
 echo 'We are done for now', PHP_EOL;
 
 ?>
---EXPECT--
+--EXPECTF--
 FunctionCallbackInfo implements CallbackInfoInterface: ok
+V8\Exceptions\Exception: FunctionCallbackInfo is empty. Forgot to call parent::__construct()?
 
 Function called
 Object representation:
 ----------------------
-object(V8\FunctionCallbackInfo)#10 (8) {
-  ["isolate":"V8\FunctionCallbackInfo":private]=>
-  object(v8Tests\TrackingDtors\Isolate)#2 (0) {
-  }
-  ["context":"V8\FunctionCallbackInfo":private]=>
-  object(V8\Context)#4 (1) {
-    ["isolate":"V8\Context":private]=>
-    object(v8Tests\TrackingDtors\Isolate)#2 (0) {
-    }
-  }
-  ["this":"V8\FunctionCallbackInfo":private]=>
-  object(V8\ObjectValue)#11 (2) {
-    ["isolate":"V8\Value":private]=>
-    object(v8Tests\TrackingDtors\Isolate)#2 (0) {
-    }
-    ["context":"V8\ObjectValue":private]=>
-    object(V8\Context)#4 (1) {
-      ["isolate":"V8\Context":private]=>
-      object(v8Tests\TrackingDtors\Isolate)#2 (0) {
-      }
-    }
-  }
-  ["holder":"V8\FunctionCallbackInfo":private]=>
-  object(V8\ObjectValue)#11 (2) {
-    ["isolate":"V8\Value":private]=>
-    object(v8Tests\TrackingDtors\Isolate)#2 (0) {
-    }
-    ["context":"V8\ObjectValue":private]=>
-    object(V8\Context)#4 (1) {
-      ["isolate":"V8\Context":private]=>
-      object(v8Tests\TrackingDtors\Isolate)#2 (0) {
-      }
-    }
-  }
-  ["return_value":"V8\FunctionCallbackInfo":private]=>
-  object(V8\ReturnValue)#12 (2) {
-    ["isolate":"V8\ReturnValue":private]=>
-    object(v8Tests\TrackingDtors\Isolate)#2 (0) {
-    }
-    ["context":"V8\ReturnValue":private]=>
-    object(V8\Context)#4 (1) {
-      ["isolate":"V8\Context":private]=>
-      object(v8Tests\TrackingDtors\Isolate)#2 (0) {
-      }
-    }
-  }
-  ["arguments":"V8\FunctionCallbackInfo":private]=>
-  array(2) {
-    [0]=>
-    object(V8\StringValue)#13 (1) {
-      ["isolate":"V8\Value":private]=>
-      object(v8Tests\TrackingDtors\Isolate)#2 (0) {
-      }
-    }
-    [1]=>
-    object(V8\ObjectValue)#6 (2) {
-      ["isolate":"V8\Value":private]=>
-      object(v8Tests\TrackingDtors\Isolate)#2 (0) {
-      }
-      ["context":"V8\ObjectValue":private]=>
-      object(V8\Context)#4 (1) {
-        ["isolate":"V8\Context":private]=>
-        object(v8Tests\TrackingDtors\Isolate)#2 (0) {
-        }
-      }
-    }
-  }
-  ["new_target":"V8\FunctionCallbackInfo":private]=>
-  object(V8\UndefinedValue)#14 (1) {
-    ["isolate":"V8\Value":private]=>
-    object(v8Tests\TrackingDtors\Isolate)#2 (0) {
-    }
-  }
-  ["is_constructor_call":"V8\FunctionCallbackInfo":private]=>
-  bool(false)
+object(V8\FunctionCallbackInfo)#%d (0) {
 }
 
 
@@ -163,10 +111,15 @@ Callback info holds original isolate object: ok
 Callback info holds original isolate object: ok
 Scalars hold no info about their zval, so that their zvals are recreated on each access: ok
 Objects can hold info about their zval and keep it until zval's get free() : ok
+Arguments array is created once: ok
+Argument by index matches arguments(): ok
+Out of range argument is undefined: ok
+This is the same object on each access: ok
+Holder is the same as this for plain call: ok
 string(11) "Script done"
 
 
-object(V8\ReturnValue)#12 (2) {
+object(V8\ReturnValue)#%d (2) {
   ["isolate":"V8\ReturnValue":private]=>
   object(v8Tests\TrackingDtors\Isolate)#2 (0) {
   }
@@ -180,84 +133,18 @@ object(V8\ReturnValue)#12 (2) {
 
 Object representation (outside of context):
 -------------------------------------------
-object(V8\FunctionCallbackInfo)#10 (8) {
-  ["isolate":"V8\FunctionCallbackInfo":private]=>
-  object(v8Tests\TrackingDtors\Isolate)#2 (0) {
-  }
-  ["context":"V8\FunctionCallbackInfo":private]=>
-  object(V8\Context)#4 (1) {
-    ["isolate":"V8\Context":private]=>
-    object(v8Tests\TrackingDtors\Isolate)#2 (0) {
-    }
-  }
-  ["this":"V8\FunctionCallbackInfo":private]=>
-  object(V8\ObjectValue)#11 (2) {
-    ["isolate":"V8\Value":private]=>
-    object(v8Tests\TrackingDtors\Isolate)#2 (0) {
-    }
-    ["context":"V8\ObjectValue":private]=>
-    object(V8\Context)#4 (1) {
-      ["isolate":"V8\Context":private]=>
-      object(v8Tests\TrackingDtors\Isolate)#2 (0) {
-      }
-    }
-  }
-  ["holder":"V8\FunctionCallbackInfo":private]=>
-  object(V8\ObjectValue)#11 (2) {
-    ["isolate":"V8\Value":private]=>
-    object(v8Tests\TrackingDtors\Isolate)#2 (0) {
-    }
-    ["context":"V8\ObjectValue":private]=>
-    object(V8\Context)#4 (1) {
-      ["isolate":"V8\Context":private]=>
-      object(v8Tests\TrackingDtors\Isolate)#2 (0) {
-      }
-    }
-  }
-  ["return_value":"V8\FunctionCallbackInfo":private]=>
-  object(V8\ReturnValue)#12 (2) {
-    ["isolate":"V8\ReturnValue":private]=>
-    object(v8Tests\TrackingDtors\Isolate)#2 (0) {
-    }
-    ["context":"V8\ReturnValue":private]=>
-    object(V8\Context)#4 (1) {
-      ["isolate":"V8\Context":private]=>
-      object(v8Tests\TrackingDtors\Isolate)#2 (0) {
-      }
-    }
-  }
-  ["arguments":"V8\FunctionCallbackInfo":private]=>
-  array(2) {
-    [0]=>
-    object(V8\StringValue)#13 (1) {
-      ["isolate":"V8\Value":private]=>
-      object(v8Tests\TrackingDtors\Isolate)#2 (0) {
-      }
-    }
-    [1]=>
-    object(V8\ObjectValue)#6 (2) {
-      ["isolate":"V8\Value":private]=>
-      object(v8Tests\TrackingDtors\Isolate)#2 (0) {
-      }
-      ["context":"V8\ObjectValue":private]=>
-      object(V8\Context)#4 (1) {
-        ["isolate":"V8\Context":private]=>
-        object(v8Tests\TrackingDtors\Isolate)#2 (0) {
-        }
-      }
-    }
-  }
-  ["new_target":"V8\FunctionCallbackInfo":private]=>
-  object(V8\UndefinedValue)#14 (1) {
-    ["isolate":"V8\Value":private]=>
-    object(v8Tests\TrackingDtors\Isolate)#2 (0) {
-    }
-  }
-  ["is_constructor_call":"V8\FunctionCallbackInfo":private]=>
-  bool(false)
+object(V8\FunctionCallbackInfo)#%d (0) {
 }
 
 
+Callback info keeps its arguments: ok
+Callback info keeps its argument objects: ok
+Out of range argument is undefined: ok
+Callback info keeps this: ok
+Callback info keeps holder: ok
+Callback info keeps new target: ok
+Callback info keeps construct call flag: ok
+
 We are done for now
 FunctionObject dies now!
 Isolate dies now!
@@ -60,7 +60,7 @@ $helper->assert('Function from script holds script id', $fnc2->getScriptId() !==
 echo 'We are done for now', PHP_EOL;
 
 ?>
---EXPECT--
+--EXPECTF--
 Object representation:
 ----------------------
 object(v8Tests\TrackingDtors\FunctionObject)#6 (2) {
@@ -144,7 +144,7 @@ string(11) "Script done"
 Function created from php still holds no script id after been passed to script: ok
 
 v8Tests\TrackingDtors\FunctionObject(V8\FunctionObject)->getScriptOrigin():
-    object(V8\ScriptOrigin)#132 (6) {
+    object(V8\ScriptOrigin)#%d (6) {
       ["resource_name":"V8\ScriptOrigin":private]=>
       string(0) ""
       ["resource_line_offset":"V8\ScriptOrigin":private]=>
@@ -156,7 +156,7 @@ v8Tests\TrackingDtors\FunctionObject(V8\FunctionObject)->getScriptOrigin():
       ["source_map_url":"V8\ScriptOrigin":private]=>
       string(0) ""
       ["options":"V8\ScriptOrigin":private]=>
-      object(V8\ScriptOriginOptions)#136 (1) {
+      object(V8\ScriptOriginOptions)#%d (1) {
         ["flags":"V8\ScriptOriginOptions":private]=>
         int(0)
       }
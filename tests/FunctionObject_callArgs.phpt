@@ -0,0 +1,106 @@
+--TEST--
+V8\FunctionObject::callArgs()
+--SKIPIF--
+<?php if (!extension_loaded("v8")) print "skip"; ?>
+--FILE--
+<?php
+
+/** @var \Phpv8Testsuite $helper */
+$helper = require '.testsuite.php';
+
+require '.v8-helpers.php';
+$v8_helper = new \PhpV8Helpers($helper);
+
+$isolate = new \V8\Isolate();
+$context = new \V8\Context($isolate);
+
+$v8_helper->CompileRun($context, '
+function dump() {
+    var result = [];
+    for (var i = 0; i < arguments.length; i++) {
+        result.push(typeof arguments[i] + ":" + String(arguments[i]));
+    }
+    return result.join(", ");
+}
+');
+
+/** @var \V8\FunctionObject $dump */
+$dump = $context->globalObject()->get($context, new \V8\StringValue($isolate, 'dump'));
+$recv = $context->globalObject();
+
+$helper->header('No arguments');
+$helper->pretty_dump('Result', $dump->callArgs($context, $recv)->value());
+$helper->line();
+
+$helper->header('Scalars and values');
+$helper->pretty_dump('Result', $dump->callArgs($context, $recv, null, true, 42, 2147483648, 1.5, 'foo', new \V8\StringValue($isolate, 'bar'))->value());
+$helper->line();
+
+$helper->header('More arguments than fit inline');
+$helper->pretty_dump('Result', $dump->callArgs($context, $recv, ...range(1, 12))->value());
+$helper->line();
+
+$helper->header('Same as call()');
+$args = [new \V8\NumberValue($isolate, 1), new \V8\StringValue($isolate, 'two')];
+$helper->assert('callArgs() result matches call()', $dump->callArgs($context, $recv, ...$args)->value() === $dump->call($context, $recv, $args)->value());
+$helper->line();
+
+$helper->header('Bad arguments');
+
+try {
+    $dump->callArgs($context, $recv, 1, [1]);
+} catch(Throwable $e) {
+    $helper->exception_export($e);
+}
+
+try {
+    $dump->callArgs($context, $recv, new stdClass());
+} catch(Throwable $e) {
+    $helper->exception_export($e);
+}
+
+try {
+    $arg = new class extends \V8\Value {
+        public function __construct()
+        {
+            //parent::__construct($isolate); // yes, we don't invoke parent constructor
+        }
+    };
+
+    $dump->callArgs($context, $recv, $arg);
+} catch(Throwable $e) {
+    $helper->exception_export($e);
+}
+
+try {
+    $isolate2 = new \V8\Isolate();
+
+    $dump->callArgs($context, $recv, 'foo', new \V8\StringValue($isolate2));
+} catch(Throwable $e) {
+    $helper->exception_export($e);
+}
+
+?>
+--EXPECT--
+No arguments:
+-------------
+Result: string(0) ""
+
+Scalars and values:
+-------------------
+Result: string(91) "object:null, boolean:true, number:42, number:2147483648, number:1.5, string:foo, string:bar"
+
+More arguments than fit inline:
+-------------------------------
+Result: string(121) "number:1, number:2, number:3, number:4, number:5, number:6, number:7, number:8, number:9, number:10, number:11, number:12"
+
+Same as call():
+---------------
+callArgs() result matches call(): ok
+
+Bad arguments:
+--------------
+TypeError: Argument 4 passed to V8\FunctionObject::callArgs() must be an instance of \V8\Value or scalar, array given
+TypeError: Argument 3 passed to V8\FunctionObject::callArgs() must be an instance of \V8\Value or scalar, instance of stdClass given
+V8\Exceptions\Exception: Value is empty. Forgot to call parent::__construct()?: argument 3 passed to V8\FunctionObject::callArgs()
+V8\Exceptions\Exception: Isolates mismatch: argument 4 passed to V8\FunctionObject::callArgs()
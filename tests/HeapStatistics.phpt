@@ -8,7 +8,7 @@ V8\HeapStatistics
 /** @var \Phpv8Testsuite $helper */
 $helper = require '.testsuite.php';
 
-$hs = new \V8\HeapStatistics(1, 2, 3, 4, 5, 6, 7, 8, true, 9, 10);
+$hs = new \V8\HeapStatistics(1, 2, 3, 4, 5, 6, 7, 8, true, 9, 10, 11, 12);
 
 $helper->header('Object representation');
 $helper->dump($hs);
@@ -20,7 +20,7 @@ $helper->dump_object_methods($hs);
 --EXPECT--
 Object representation:
 ----------------------
-object(V8\HeapStatistics)#2 (11) {
+object(V8\HeapStatistics)#2 (13) {
   ["total_heap_size":"V8\HeapStatistics":private]=>
   float(1)
   ["total_heap_size_executable":"V8\HeapStatistics":private]=>
@@ -43,6 +43,10 @@ object(V8\HeapStatistics)#2 (11) {
   float(9)
   ["number_of_detached_contexts":"V8\HeapStatistics":private]=>
   float(10)
+  ["array_buffer_allocated_size":"V8\HeapStatistics":private]=>
+  float(11)
+  ["peak_array_buffer_allocated_size":"V8\HeapStatistics":private]=>
+  float(12)
 }
 
 V8\HeapStatistics->getTotalHeapSize(): float(1)
@@ -56,3 +60,5 @@ V8\HeapStatistics->getPeakMallocedMemory(): float(8)
 V8\HeapStatistics->doesZapGarbage(): bool(true)
 V8\HeapStatistics->getNumberOfNativeContexts(): float(9)
 V8\HeapStatistics->getNumberOfDetachedContexts(): float(10)
+V8\HeapStatistics->getArrayBufferAllocatedSize(): float(11)
+V8\HeapStatistics->getPeakArrayBufferAllocatedSize(): float(12)
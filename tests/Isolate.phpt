@@ -77,7 +77,7 @@ V8\Isolate::MEMORY_PRESSURE_LEVEL_MODERATE = 1
 V8\Isolate::MEMORY_PRESSURE_LEVEL_CRITICAL = 2
 
 V8\Isolate->getHeapStatistics():
-    object(V8\HeapStatistics)#29 (11) {
+    object(V8\HeapStatistics)#29 (13) {
       ["total_heap_size":"V8\HeapStatistics":private]=>
       float(%f)
       ["total_heap_size_executable":"V8\HeapStatistics":private]=>
@@ -100,6 +100,10 @@ V8\Isolate->getHeapStatistics():
       float(%f)
       ["number_of_detached_contexts":"V8\HeapStatistics":private]=>
       float(%f)
+      ["array_buffer_allocated_size":"V8\HeapStatistics":private]=>
+      float(%f)
+      ["peak_array_buffer_allocated_size":"V8\HeapStatistics":private]=>
+      float(%f)
     }
 
 V8\Exceptions\ValueException: Invalid memory pressure level given. See V8\Isolate MEMORY_PRESSURE_LEVEL_* class constants for available levels.
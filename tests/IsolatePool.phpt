@@ -0,0 +1,150 @@
+--TEST--
+V8\IsolatePool
+--SKIPIF--
+<?php if (!extension_loaded("v8")) print "skip"; ?>
+--FILE--
+<?php
+
+/** @var \Phpv8Testsuite $helper */
+$helper = require '.testsuite.php';
+
+require '.v8-helpers.php';
+$v8_helper = new PhpV8Helpers($helper);
+
+// Tests:
+
+$pool = new V8\IsolatePool('test', null, 2);
+
+$helper->method_matches($pool, 'getName', 'test');
+$helper->dump($pool->getStats());
+$helper->line();
+
+$isolate = $pool->acquire();
+$helper->assert('Pool returns isolate', $isolate instanceof V8\Isolate);
+
+$isolate->setTimeLimit(10);
+$context = new V8\Context($isolate);
+$v8_helper->ExpectString($context, 'var foo = "bar"; foo', 'bar');
+
+$helper->assert('Isolate is in use', 1 === $pool->getStats()['in_use']);
+
+$context = null;
+$isolate = null;
+
+$helper->assert('Isolate is back to pool', 1 === $pool->getStats()['idle']);
+
+$isolate = $pool->acquire();
+$context = new V8\Context($isolate);
+
+$helper->assert('Acquired isolate has limits reset', 0.0 === $isolate->getTimeLimit());
+$v8_helper->ExpectString($context, 'typeof foo', 'undefined');
+$helper->line();
+
+$context = null;
+$isolate = null;
+
+$helper->header('Warm up');
+$pool->warmUp(5);
+$helper->dump($pool->getStats());
+$helper->line();
+
+$helper->header('Pool with the same name');
+$other = new V8\IsolatePool('test');
+$isolates = [$other->acquire(), $other->acquire(), $other->acquire()];
+$isolates = null;
+$helper->dump($pool->getStats());
+$helper->line();
+
+$helper->header('Eviction by heap size');
+$pool = new V8\IsolatePool('test', null, 2, 1);
+$isolate = $pool->acquire();
+$isolate = null;
+$helper->dump($pool->getStats());
+
+$pool->clear();
+$helper->assert('Pool cleared', 0 === $pool->getStats()['idle']);
+
+?>
+--EXPECT--
+V8\IsolatePool::getName() matches expected value
+array(7) {
+  ["hits"]=>
+  int(0)
+  ["misses"]=>
+  int(0)
+  ["creations"]=>
+  int(0)
+  ["evictions"]=>
+  int(0)
+  ["discards"]=>
+  int(0)
+  ["idle"]=>
+  int(0)
+  ["in_use"]=>
+  int(0)
+}
+
+Pool returns isolate: ok
+Expected 'bar' value is identical to actual value 'bar'
+Isolate is in use: ok
+Isolate is back to pool: ok
+Acquired isolate has limits reset: ok
+Expected 'undefined' value is identical to actual value 'undefined'
+
+Warm up:
+--------
+array(7) {
+  ["hits"]=>
+  int(1)
+  ["misses"]=>
+  int(1)
+  ["creations"]=>
+  int(2)
+  ["evictions"]=>
+  int(0)
+  ["discards"]=>
+  int(0)
+  ["idle"]=>
+  int(2)
+  ["in_use"]=>
+  int(0)
+}
+
+Pool with the same name:
+------------------------
+array(7) {
+  ["hits"]=>
+  int(3)
+  ["misses"]=>
+  int(2)
+  ["creations"]=>
+  int(3)
+  ["evictions"]=>
+  int(0)
+  ["discards"]=>
+  int(0)
+  ["idle"]=>
+  int(3)
+  ["in_use"]=>
+  int(0)
+}
+
+Eviction by heap size:
+----------------------
+array(7) {
+  ["hits"]=>
+  int(4)
+  ["misses"]=>
+  int(2)
+  ["creations"]=>
+  int(3)
+  ["evictions"]=>
+  int(1)
+  ["discards"]=>
+  int(0)
+  ["idle"]=>
+  int(1)
+  ["in_use"]=>
+  int(0)
+}
+Pool cleared: ok
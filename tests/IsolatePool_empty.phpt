@@ -0,0 +1,43 @@
+--TEST--
+V8\IsolatePool - test emptiness checker
+--SKIPIF--
+<?php if (!extension_loaded("v8")) print "skip"; ?>
+--FILE--
+<?php
+
+/** @var \Phpv8Testsuite $helper */
+$helper = require '.testsuite.php';
+
+// Tests:
+
+$bad = new class extends \V8\IsolatePool {
+    public function __construct()
+    {
+    }
+};
+
+$unconstructed = (new ReflectionClass(\V8\IsolatePool::class))->newInstanceWithoutConstructor();
+
+foreach ([$bad, $unconstructed] as $pool) {
+    foreach (['getName' => [], 'acquire' => [], 'warmUp' => [1], 'clear' => [], 'getStats' => []] as $method => $args) {
+        try {
+            $pool->$method(...$args);
+        } catch (Throwable $e) {
+            echo $method, ': ';
+            $helper->exception_export($e);
+        }
+    }
+}
+
+?>
+--EXPECT--
+getName: V8\Exceptions\Exception: IsolatePool is empty. Forgot to call parent::__construct()?
+acquire: V8\Exceptions\Exception: IsolatePool is empty. Forgot to call parent::__construct()?
+warmUp: V8\Exceptions\Exception: IsolatePool is empty. Forgot to call parent::__construct()?
+clear: V8\Exceptions\Exception: IsolatePool is empty. Forgot to call parent::__construct()?
+getStats: V8\Exceptions\Exception: IsolatePool is empty. Forgot to call parent::__construct()?
+getName: V8\Exceptions\Exception: IsolatePool is empty. Forgot to call parent::__construct()?
+acquire: V8\Exceptions\Exception: IsolatePool is empty. Forgot to call parent::__construct()?
+warmUp: V8\Exceptions\Exception: IsolatePool is empty. Forgot to call parent::__construct()?
+clear: V8\Exceptions\Exception: IsolatePool is empty. Forgot to call parent::__construct()?
+getStats: V8\Exceptions\Exception: IsolatePool is empty. Forgot to call parent::__construct()?
@@ -0,0 +1,86 @@
+--TEST--
+V8\Isolate - CPU time limit
+--SKIPIF--
+<?php if (!extension_loaded("v8")) print "skip"; ?>
+--FILE--
+<?php
+
+/** @var \Phpv8Testsuite $helper */
+$helper = require '.testsuite.php';
+
+require '.v8-helpers.php';
+$v8_helper = new PhpV8Helpers($helper);
+
+// Tests:
+
+$isolate = new V8\Isolate();
+$context = new V8\Context($isolate);
+
+$sleep = new V8\FunctionObject($context, function () {
+    usleep(200000);
+});
+
+$burn = new V8\FunctionObject($context, function () {
+    $t = microtime(true);
+    while (microtime(true) - $t < 0.2) {}
+});
+
+$context->globalObject()->set($context, new V8\StringValue($isolate, 'sleep'), $sleep);
+$context->globalObject()->set($context, new V8\StringValue($isolate, 'burn'), $burn);
+
+$cpu_time_limit = 0.5;
+
+$helper->assert('CPU time limit accessor report no hit', false === $isolate->isCpuTimeLimitHit());
+$helper->assert('Get CPU time limit default value is zero', 0.0 === $isolate->getCpuTimeLimit());
+$isolate->setCpuTimeLimit($cpu_time_limit);
+$helper->assert('Get CPU time limit returns valid value', $cpu_time_limit === $isolate->getCpuTimeLimit());
+$helper->line();
+
+$helper->header('Time when thread is blocked is not counted');
+$script = new V8\Script($context, new \V8\StringValue($isolate, 'for (var i = 0; i < 4; i++) { sleep(); } "done"'));
+$helper->assert('Script completed', 'done' === $script->run($context)->value());
+$helper->assert('CPU time limit accessor report no hit', false === $isolate->isCpuTimeLimitHit());
+$helper->line();
+
+$helper->header('Busy script is terminated');
+$script = new V8\Script($context, new \V8\StringValue($isolate, 'var i = 0; while(true) { i++ };'));
+
+try {
+  $script->run($context);
+} catch(\V8\Exceptions\TimeLimitException $e) {
+  $helper->exception_export($e);
+}
+$helper->assert('CPU time limit accessor report hit', true === $isolate->isCpuTimeLimitHit());
+$helper->assert('Time limit accessor report no hit', false === $isolate->isTimeLimitHit());
+$helper->line();
+
+$helper->header('Time spent in PHP callbacks may be excluded');
+$isolate->setCpuTimeLimit($cpu_time_limit, true);
+$helper->assert('CPU time limit accessor report no hit after limit reset', false === $isolate->isCpuTimeLimitHit());
+
+$script = new V8\Script($context, new \V8\StringValue($isolate, 'for (var i = 0; i < 4; i++) { burn(); } "done"'));
+$helper->assert('Script completed', 'done' === $script->run($context)->value());
+$helper->assert('CPU time limit accessor report no hit', false === $isolate->isCpuTimeLimitHit());
+
+?>
+--EXPECT--
+CPU time limit accessor report no hit: ok
+Get CPU time limit default value is zero: ok
+Get CPU time limit returns valid value: ok
+
+Time when thread is blocked is not counted:
+-------------------------------------------
+Script completed: ok
+CPU time limit accessor report no hit: ok
+
+Busy script is terminated:
+--------------------------
+V8\Exceptions\TimeLimitException: CPU time limit exceeded
+CPU time limit accessor report hit: ok
+Time limit accessor report no hit: ok
+
+Time spent in PHP callbacks may be excluded:
+--------------------------------------------
+CPU time limit accessor report no hit after limit reset: ok
+Script completed: ok
+CPU time limit accessor report no hit: ok
@@ -70,7 +70,7 @@ Memory limit accessor report hit: ok
 
 object(V8\Isolate)#3 (0) {
 }
-object(V8\HeapStatistics)#10 (11) {
+object(V8\HeapStatistics)#10 (13) {
   ["total_heap_size":"V8\HeapStatistics":private]=>
   float(%f)
   ["total_heap_size_executable":"V8\HeapStatistics":private]=>
@@ -93,4 +93,8 @@ object(V8\HeapStatistics)#10 (11) {
   float(%f)
   ["number_of_detached_contexts":"V8\HeapStatistics":private]=>
   float(%f)
+  ["array_buffer_allocated_size":"V8\HeapStatistics":private]=>
+  float(%f)
+  ["peak_array_buffer_allocated_size":"V8\HeapStatistics":private]=>
+  float(%f)
 }
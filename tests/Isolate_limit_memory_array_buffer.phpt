@@ -0,0 +1,158 @@
+--TEST--
+V8\Isolate - memory limit applies to ArrayBuffer allocations
+--SKIPIF--
+<?php if (!extension_loaded("v8")) print "skip"; ?>
+--FILE--
+<?php
+
+/** @var \Phpv8Testsuite $helper */
+$helper = require '.testsuite.php';
+
+require '.v8-helpers.php';
+$v8_helper = new PhpV8Helpers($helper);
+
+// Tests:
+
+$memory_limit = 1024 * 1024 * 10;
+
+$isolate = new V8\Isolate();
+$context = new V8\Context($isolate);
+$v8_helper->injectConsoleLog($context);
+
+$hs = $isolate->getHeapStatistics();
+$helper->assert('No buffers allocated initially', 0.0 === $hs->getArrayBufferAllocatedSize());
+
+$buffer = new V8\ArrayBufferObject($context, 1024 * 1024);
+
+$hs = $isolate->getHeapStatistics();
+$helper->assert('Buffer allocated from php is accounted', 1024.0 * 1024 === $hs->getArrayBufferAllocatedSize());
+$helper->assert('Peak is not less than allocated size', $hs->getPeakArrayBufferAllocatedSize() >= $hs->getArrayBufferAllocatedSize());
+
+$buffer = V8\ArrayBufferObject::fromString($context, str_repeat('x', 1024));
+
+$hs = $isolate->getHeapStatistics();
+$helper->assert('Buffer backed by php string is not accounted', 1024.0 * 1024 === $hs->getArrayBufferAllocatedSize());
+$helper->line();
+
+
+$helper->header('Allocation in js');
+
+$source = '
+    var buffers = [];
+    while(true) {
+      buffers.push(new ArrayBuffer(1024 * 1024)); // 1mb
+    }
+';
+
+$script = new V8\Script($context, new \V8\StringValue($isolate, $source), new \V8\ScriptOrigin('test.js'));
+
+$isolate->setMemoryLimit($memory_limit);
+
+try {
+    $script->run($context);
+} catch(\V8\Exceptions\MemoryLimitException $e) {
+    $helper->exception_export($e);
+    echo 'script execution terminated', PHP_EOL;
+}
+
+$hs = $isolate->getHeapStatistics();
+$helper->assert('Memory limit accessor report hit', true === $isolate->isMemoryLimitHit());
+$helper->assert('Buffers stay under memory limit', $hs->getArrayBufferAllocatedSize() <= $memory_limit);
+$helper->assert('Peak stays under memory limit', $hs->getPeakArrayBufferAllocatedSize() <= $memory_limit);
+$helper->line();
+
+
+$helper->header('Allocation in php');
+
+$isolate = new V8\Isolate(null, $memory_limit);
+$context = new V8\Context($isolate);
+
+try {
+    new V8\ArrayBufferObject($context, $memory_limit + 1);
+} catch(\V8\Exceptions\MemoryLimitException $e) {
+    $helper->exception_export($e);
+}
+
+$helper->assert('Memory limit accessor report hit', true === $isolate->isMemoryLimitHit());
+$helper->assert('Nothing allocated', 0.0 === $isolate->getHeapStatistics()->getArrayBufferAllocatedSize());
+
+$isolate->setMemoryLimit($memory_limit * 2);
+$helper->assert('Memory limit hit is reset', false === $isolate->isMemoryLimitHit());
+
+$buffer = new V8\ArrayBufferObject($context, $memory_limit + 1);
+$helper->assert('Buffer allocated under raised limit', $memory_limit + 1 === $buffer->byteLength());
+$helper->line();
+
+
+$helper->header('Heap usage is counted');
+
+$isolate = new V8\Isolate(null, $memory_limit);
+$context = new V8\Context($isolate);
+
+$v8_helper->CompileRun($context, 'var blob = []; for (var i = 0; i < 6; i++) { blob.push(new Array(128 * 1024).fill(0.5)); }');
+$isolate->lowMemoryNotification();
+
+try {
+    new V8\ArrayBufferObject($context, $memory_limit / 2);
+} catch(\V8\Exceptions\MemoryLimitException $e) {
+    $helper->exception_export($e);
+}
+
+$helper->assert('Memory limit accessor report hit', true === $isolate->isMemoryLimitHit());
+$helper->assert('Nothing allocated', 0.0 === $isolate->getHeapStatistics()->getArrayBufferAllocatedSize());
+$helper->line();
+
+
+$helper->header('Buffer of view kept on heap');
+
+$isolate = new V8\Isolate(null, $memory_limit * 2);
+$context = new V8\Context($isolate);
+
+$buffer = new V8\ArrayBufferObject($context, $memory_limit + 1);
+
+// small typed arrays keep their data on heap till their buffer is requested
+$view = $v8_helper->CompileRun($context, 'new Uint8Array(32)');
+
+$isolate->setMemoryLimit($memory_limit + 1 + 16);
+
+try {
+    $view->buffer();
+} catch(\V8\Exceptions\MemoryLimitException $e) {
+    $helper->exception_export($e);
+}
+
+$helper->assert('Memory limit accessor report hit', true === $isolate->isMemoryLimitHit());
+
+?>
+--EXPECT--
+No buffers allocated initially: ok
+Buffer allocated from php is accounted: ok
+Peak is not less than allocated size: ok
+Buffer backed by php string is not accounted: ok
+
+Allocation in js:
+-----------------
+V8\Exceptions\MemoryLimitException: Memory limit exceeded
+script execution terminated
+Memory limit accessor report hit: ok
+Buffers stay under memory limit: ok
+Peak stays under memory limit: ok
+
+Allocation in php:
+------------------
+V8\Exceptions\MemoryLimitException: Memory limit exceeded
+Memory limit accessor report hit: ok
+Nothing allocated: ok
+Memory limit hit is reset: ok
+Buffer allocated under raised limit: ok
+
+Heap usage is counted:
+----------------------
+V8\Exceptions\MemoryLimitException: Memory limit exceeded
+Memory limit accessor report hit: ok
+Nothing allocated: ok
+
+Buffer of view kept on heap:
+----------------------------
+V8\Exceptions\MemoryLimitException: Memory limit exceeded
+Memory limit accessor report hit: ok
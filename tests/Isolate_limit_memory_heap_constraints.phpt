@@ -0,0 +1,66 @@
+--TEST--
+V8\Isolate - memory limit set on isolate construction
+--SKIPIF--
+<?php if (!extension_loaded("v8")) print "skip"; ?>
+--FILE--
+<?php
+
+/** @var \Phpv8Testsuite $helper */
+$helper = require '.testsuite.php';
+
+require '.v8-helpers.php';
+$v8_helper = new PhpV8Helpers($helper);
+
+// Tests:
+
+$memory_limit = 1024 * 1024 * 10;
+
+try {
+    new V8\Isolate(null, -1);
+} catch (\V8\Exceptions\Exception $e) {
+    $helper->exception_export($e);
+}
+
+$isolate = new V8\Isolate(null, $memory_limit);
+$context = new V8\Context($isolate);
+
+$helper->assert('Get memory limit returns value passed to constructor', $memory_limit === $isolate->getMemoryLimit());
+$helper->assert('Memory limit accessor report no hit', false === $isolate->isMemoryLimitHit());
+$helper->line();
+
+$source    = '
+    var str = " ".repeat(1024); // 1kb
+    var blob = [];
+    while(true) {
+      blob.push(str);
+    }
+';
+
+$script = new V8\Script($context, new \V8\StringValue($isolate, $source), new \V8\ScriptOrigin('test.js'));
+
+try {
+  $script->run($context);
+} catch(\V8\Exceptions\MemoryLimitException $e) {
+  $helper->exception_export($e);
+  echo 'script execution terminated', PHP_EOL;
+}
+
+$helper->assert('Memory limit accessor report hit', true === $isolate->isMemoryLimitHit());
+$helper->assert('Used heap size is close to the limit', $isolate->getHeapStatistics()->getUsedHeapSize() < $memory_limit * 2);
+$helper->line();
+
+$isolate->setMemoryLimit($memory_limit * 2);
+$helper->assert('Memory limit hit reset when limit changed', false === $isolate->isMemoryLimitHit());
+
+?>
+--EXPECT--
+V8\Exceptions\Exception: Memory limit should be a non-negative numeric value
+Get memory limit returns value passed to constructor: ok
+Memory limit accessor report no hit: ok
+
+V8\Exceptions\MemoryLimitException: Memory limit exceeded
+script execution terminated
+Memory limit accessor report hit: ok
+Used heap size is close to the limit: ok
+
+Memory limit hit reset when limit changed: ok
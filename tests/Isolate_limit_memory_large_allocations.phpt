@@ -0,0 +1,67 @@
+--TEST--
+V8\Isolate - memory limit is not a fatal OOM for large allocations
+--SKIPIF--
+<?php if (!extension_loaded("v8")) print "skip"; ?>
+--FILE--
+<?php
+
+/** @var \Phpv8Testsuite $helper */
+$helper = require '.testsuite.php';
+
+require '.v8-helpers.php';
+$v8_helper = new PhpV8Helpers($helper);
+
+// Tests:
+
+$memory_limit = 1024 * 1024 * 10;
+
+// Runs the same way on every supported libv8: with or without near heap limit callback, hitting the limit
+// terminates execution instead of aborting the process.
+$source = '
+    var blob = [];
+    while(true) {
+      blob.push(new Array(128 * 1024).fill(0.5)); // ~1mb of heap numbers per chunk
+    }
+';
+
+foreach (['constructor' => new V8\Isolate(null, $memory_limit), 'setter' => new V8\Isolate()] as $how => $isolate) {
+    $helper->header("Limit set with {$how}");
+
+    $context = new V8\Context($isolate);
+
+    if ('setter' === $how) {
+        $isolate->setMemoryLimit($memory_limit);
+    }
+
+    $script = new V8\Script($context, new \V8\StringValue($isolate, $source), new \V8\ScriptOrigin('test.js'));
+
+    try {
+        $script->run($context);
+    } catch(\V8\Exceptions\MemoryLimitException $e) {
+        $helper->exception_export($e);
+    }
+
+    $helper->assert('Memory limit accessor report hit', true === $isolate->isMemoryLimitHit());
+    $helper->assert('Used heap size is close to the limit', $isolate->getHeapStatistics()->getUsedHeapSize() < $memory_limit * 4);
+
+    $isolate->setMemoryLimit($memory_limit * 100);
+    $helper->assert('Isolate is usable after limit hit', 2 === $v8_helper->CompileRun($context, '1 + 1')->value());
+    $helper->line();
+}
+
+?>
+--EXPECT--
+Limit set with constructor:
+---------------------------
+V8\Exceptions\MemoryLimitException: Memory limit exceeded
+Memory limit accessor report hit: ok
+Used heap size is close to the limit: ok
+Isolate is usable after limit hit: ok
+
+Limit set with setter:
+----------------------
+V8\Exceptions\MemoryLimitException: Memory limit exceeded
+Memory limit accessor report hit: ok
+Used heap size is close to the limit: ok
+Isolate is usable after limit hit: ok
+
@@ -0,0 +1,51 @@
+--TEST--
+V8\Isolate - memory limit lowered below current usage applies on next run
+--SKIPIF--
+<?php if (!extension_loaded("v8")) print "skip"; ?>
+--FILE--
+<?php
+
+/** @var \Phpv8Testsuite $helper */
+$helper = require '.testsuite.php';
+
+require '.v8-helpers.php';
+$v8_helper = new PhpV8Helpers($helper);
+
+// Tests:
+
+$memory_limit = 1024 * 1024 * 10;
+
+$isolate = new V8\Isolate(null, $memory_limit * 10);
+$context = new V8\Context($isolate);
+
+$v8_helper->CompileRun($context, 'var blob = []; for (var i = 0; i < 20; i++) { blob.push(new Array(128 * 1024).fill(0.5)); }');
+
+$helper->assert('Memory limit is not hit with higher limit', false === $isolate->isMemoryLimitHit());
+
+$isolate->setMemoryLimit($memory_limit);
+
+$script = new V8\Script($context, new \V8\StringValue($isolate, 'for (var i = 0; i < 1000000; i++) {} blob.length'), new \V8\ScriptOrigin('test.js'));
+
+try {
+    $script->run($context);
+} catch(\V8\Exceptions\MemoryLimitException $e) {
+    $helper->exception_export($e);
+}
+
+$helper->assert('Memory limit accessor report hit', true === $isolate->isMemoryLimitHit());
+
+$isolate->setMemoryLimit($memory_limit * 10);
+$v8_helper->CompileRun($context, 'blob = null');
+$isolate->lowMemoryNotification();
+$isolate->setMemoryLimit($memory_limit);
+
+$helper->assert('Isolate is usable once usage is within the limit', 2 === $v8_helper->CompileRun($context, '1 + 1')->value());
+$helper->assert('Memory limit is not hit afterwards', false === $isolate->isMemoryLimitHit());
+
+?>
+--EXPECT--
+Memory limit is not hit with higher limit: ok
+V8\Exceptions\MemoryLimitException: Memory limit exceeded
+Memory limit accessor report hit: ok
+Isolate is usable once usage is within the limit: ok
+Memory limit is not hit afterwards: ok
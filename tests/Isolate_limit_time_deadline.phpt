@@ -0,0 +1,70 @@
+--TEST--
+V8\Isolate - time limit is enforced at deadline
+--SKIPIF--
+<?php if (!extension_loaded("v8")) print "skip"; ?>
+--FILE--
+<?php
+
+/** @var \Phpv8Testsuite $helper */
+$helper = require '.testsuite.php';
+
+require '.v8-helpers.php';
+$v8_helper = new PhpV8Helpers($helper);
+
+// Tests:
+
+$isolate = new V8\Isolate();
+$context = new V8\Context($isolate);
+
+
+$source    = '
+    var i = 0;
+    while(true) { i++};
+';
+$file_name = 'test.js';
+
+$script = new V8\Script($context, new \V8\StringValue($isolate, $source), new \V8\ScriptOrigin($file_name));
+
+if ($helper->need_more_time()) {
+  // On travis when valgrind active it takes more time to complete all operations so we just increase initial limits
+  $time_limit = 0.5;
+  $high_range = $time_limit*20;
+  $max_overshoot = $time_limit*20;
+} else {
+  // watchdog wakes up at deadline, but loaded machine may not schedule it right away, so bounds are kept loose
+  $time_limit = 0.005;
+  $high_range = 0.1;
+  $max_overshoot = 0.05;
+}
+
+$helper->assert('Time limit overshoot default value is zero', 0.0 === $isolate->getTimeLimitOvershoot());
+$isolate->setTimeLimit($time_limit);
+
+$t = microtime(true);
+try {
+  $res = $script->run($context);
+} catch(\V8\Exceptions\TimeLimitException $e) {
+  $helper->exception_export($e);
+  echo 'script execution terminated', PHP_EOL;
+} finally {
+  $t = microtime(true) - $t;
+  $helper->assert("Script execution time is within specified range", $t >= $time_limit && $t < $high_range);
+}
+
+$helper->assert('Time limit accessor report hit', true === $isolate->isTimeLimitHit());
+$helper->assert('Time limit overshoot is non-negative', $isolate->getTimeLimitOvershoot() >= 0);
+$helper->assert('Time limit overshoot is small', $isolate->getTimeLimitOvershoot() < $max_overshoot);
+
+$isolate->setTimeLimit($time_limit);
+$helper->assert('Time limit overshoot is reset when time limit set', 0.0 === $isolate->getTimeLimitOvershoot());
+
+?>
+--EXPECT--
+Time limit overshoot default value is zero: ok
+V8\Exceptions\TimeLimitException: Time limit exceeded
+script execution terminated
+Script execution time is within specified range: ok
+Time limit accessor report hit: ok
+Time limit overshoot is non-negative: ok
+Time limit overshoot is small: ok
+Time limit overshoot is reset when time limit set: ok
@@ -0,0 +1,80 @@
+--TEST--
+V8\Isolate - time limit on multiple isolates shares single watchdog
+--SKIPIF--
+<?php if (!extension_loaded("v8")) print "skip"; ?>
+--FILE--
+<?php
+
+/** @var \Phpv8Testsuite $helper */
+$helper = require '.testsuite.php';
+
+require '.v8-helpers.php';
+$v8_helper = new PhpV8Helpers($helper);
+
+// Tests:
+
+$source    = '
+    var i = 0;
+    while(true) { i++};
+';
+$file_name = 'test.js';
+
+if ($helper->need_more_time()) {
+  // On travis when valgrind active it takes more time to complete all operations so we just increase initial limits
+  $time_limit = 2.0;
+  $high_range = $time_limit*20;
+} else {
+  $time_limit = 0.5;
+  $high_range = 0.65;
+}
+
+$isolates = [];
+$contexts = [];
+$scripts = [];
+
+for ($i = 0; $i < 3; $i++) {
+    $isolates[$i] = new V8\Isolate();
+    $contexts[$i] = new V8\Context($isolates[$i]);
+    $scripts[$i] = new V8\Script($contexts[$i], new \V8\StringValue($isolates[$i], $source), new \V8\ScriptOrigin($file_name));
+
+    $isolates[$i]->setTimeLimit($time_limit);
+}
+
+$no_limit_isolate = new V8\Isolate();
+$no_limit_context = new V8\Context($no_limit_isolate);
+$no_limit_script = new V8\Script($no_limit_context, new \V8\StringValue($no_limit_isolate, '"done"'), new \V8\ScriptOrigin($file_name));
+
+foreach ($scripts as $i => $script) {
+    $t = microtime(true);
+    try {
+        $script->run($contexts[$i]);
+    } catch(\V8\Exceptions\TimeLimitException $e) {
+        $helper->exception_export($e);
+    } finally {
+        $t = microtime(true) - $t;
+        $helper->assert("Isolate #{$i} terminated within specified range", $t >= $time_limit && $t < $high_range);
+        $helper->assert("Isolate #{$i} time limit hit", true === $isolates[$i]->isTimeLimitHit());
+    }
+
+    $helper->line();
+}
+
+$helper->assert('Isolate without limits is not affected', 'done' === $no_limit_script->run($no_limit_context)->value());
+$helper->assert('Isolate without limits reports no hit', false === $no_limit_isolate->isTimeLimitHit());
+
+?>
+--EXPECT--
+V8\Exceptions\TimeLimitException: Time limit exceeded
+Isolate #0 terminated within specified range: ok
+Isolate #0 time limit hit: ok
+
+V8\Exceptions\TimeLimitException: Time limit exceeded
+Isolate #1 terminated within specified range: ok
+Isolate #1 time limit hit: ok
+
+V8\Exceptions\TimeLimitException: Time limit exceeded
+Isolate #2 terminated within specified range: ok
+Isolate #2 time limit hit: ok
+
+Isolate without limits is not affected: ok
+Isolate without limits reports no hit: ok
@@ -0,0 +1,142 @@
+--TEST--
+V8\ObjectTemplate::bindConstant(), bindProperty() and bindArrayOffset()
+--SKIPIF--
+<?php if (!extension_loaded("v8")) print "skip"; ?>
+--FILE--
+<?php
+
+/** @var \Phpv8Testsuite $helper */
+$helper = require '.testsuite.php';
+require '.v8-helpers.php';
+$v8_helper = new PhpV8Helpers($helper);
+
+class Config {
+    public $name = 'foo';
+    protected $secret = 'hidden';
+
+    public function bind(\V8\ObjectTemplate $tpl, \V8\Isolate $isolate)
+    {
+        $tpl->bindProperty(new \V8\StringValue($isolate, 'secret'), $this);
+    }
+}
+
+$isolate = new \V8\Isolate();
+
+$config = new Config();
+$config->counter = 1;
+
+$settings = ['level' => 3, 42 => 'answer'];
+
+$tpl = new V8\ObjectTemplate($isolate);
+$tpl->bindConstant(new \V8\StringValue($isolate, 'version'), '1.2.3');
+$tpl->bindConstant(new \V8\StringValue($isolate, 'list'), [1, 2, 3]);
+$tpl->bindProperty(new \V8\StringValue($isolate, 'name'), $config);
+$tpl->bindProperty(new \V8\StringValue($isolate, 'count'), $config, 'counter');
+$tpl->bindProperty(new \V8\StringValue($isolate, 'readonly'), $config, 'name', \V8\PropertyAttribute::READ_ONLY);
+$tpl->bindProperty(new \V8\StringValue($isolate, 'public_secret'), $config, 'secret');
+$tpl->bindArrayOffset(new \V8\StringValue($isolate, 'level'), $settings);
+$tpl->bindArrayOffset(new \V8\StringValue($isolate, 'answer'), $settings, '42');
+$tpl->bindArrayOffset(new \V8\StringValue($isolate, 'missing'), $settings, 'missing');
+
+$config->bind($tpl, $isolate);
+
+try {
+    $tpl->bindConstant(new \V8\StringValue($isolate, 'invalid'), new stdClass());
+} catch (\Throwable $e) {
+    $helper->exception_export($e);
+}
+
+$context = new V8\Context($isolate);
+$context->globalObject()->set($context, new \V8\StringValue($isolate, 'obj'), $tpl->newInstance($context));
+
+$v8_helper->injectConsoleLog($context);
+
+$helper->header('Read');
+
+$v8_helper->CompileRun($context, '
+console.log("version: ", obj.version);
+console.log("list: ", obj.list);
+console.log("name: ", obj.name);
+console.log("count: ", obj.count, " ", typeof obj.count);
+console.log("public_secret: ", obj.public_secret);
+console.log("secret: ", obj.secret);
+console.log("level: ", obj.level);
+console.log("answer: ", obj.answer);
+console.log("missing: ", obj.missing);
+');
+$helper->line();
+
+$helper->header('Changes from php are visible in js');
+
+$config->name = 'bar';
+$config->counter++;
+$settings['level'] = 5;
+$settings['missing'] = 'found';
+
+$v8_helper->CompileRun($context, '
+console.log("name: ", obj.name);
+console.log("count: ", obj.count);
+console.log("level: ", obj.level);
+console.log("missing: ", obj.missing);
+');
+$helper->line();
+
+$helper->header('Changes from js are visible in php');
+
+$v8_helper->CompileRun($context, '
+obj.version = "4.5.6";
+obj.name = "baz";
+obj.readonly = "ignored";
+obj.count = obj.count + 40;
+obj.secret = "revealed";
+obj.level = [1, 2];
+obj.answer = 24;
+');
+
+$helper->assert('Constant is not changed', $v8_helper->CompileRun($context, 'obj.version')->value() === '1.2.3');
+$helper->assert('Bound property is changed', $config->name === 'baz');
+$helper->assert('Read only binding is not changed', $v8_helper->CompileRun($context, 'obj.readonly')->value() === 'baz');
+$helper->assert('Bound property is changed to integer', $config->counter === 42);
+$helper->assert('Protected property is changed', $v8_helper->CompileRun($context, 'obj.secret')->value() === 'revealed');
+$helper->assert('Bound array offset is changed', $settings['level'] === [1, 2]);
+$helper->assert('Bound numeric offset is changed', $settings[42] === 24);
+$helper->line();
+
+$settings_copy = $settings;
+$v8_helper->CompileRun($context, 'obj.answer = 12');
+
+$helper->assert('Array copy is separated on write', $settings_copy[42] === 24 && $settings[42] === 12);
+
+?>
+--EXPECT--
+TypeError: Argument 2 passed to V8\ObjectTemplate::bindConstant() must be of the type scalar, array or null, object given
+Read:
+-----
+version: 1.2.3
+list: [1, 2, 3]
+name: foo
+count: 1 number
+public_secret: null
+secret: hidden
+level: 3
+answer: answer
+missing: <undefined>
+
+Changes from php are visible in js:
+-----------------------------------
+name: bar
+count: 2
+level: 5
+missing: found
+
+Changes from js are visible in php:
+-----------------------------------
+Constant is not changed: ok
+Bound property is changed: ok
+Read only binding is not changed: ok
+Bound property is changed to integer: ok
+Protected property is changed: ok
+Bound array offset is changed: ok
+Bound numeric offset is changed: ok
+
+Array copy is separated on write: ok
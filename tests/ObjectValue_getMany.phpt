@@ -0,0 +1,109 @@
+--TEST--
+V8\ObjectValue::getMany()
+--SKIPIF--
+<?php if (!extension_loaded("v8")) print "skip"; ?>
+--FILE--
+<?php
+
+/** @var \Phpv8Testsuite $helper */
+$helper = require '.testsuite.php';
+
+require '.v8-helpers.php';
+$v8_helper = new PhpV8Helpers($helper);
+
+$isolate = new \V8\Isolate();
+$context = new V8\Context($isolate);
+
+$object = $v8_helper->CompileRun($context, '({
+    string: "test",
+    int: 42,
+    float: 4.2,
+    bool: true,
+    nil: null,
+    func: function () {},
+    symbol: Symbol("foo"),
+    7: "seven",
+    get getter() { return "from getter"; },
+})');
+
+$res = $object->getMany($context, ['string', 'int', 'func', 'missing', 7, '7']);
+
+$helper->assert('Keys are preserved', ['string', 'int', 'func', 'missing', 7] === array_keys($res));
+$helper->value_instanceof($res['string'], V8\StringValue::class);
+$helper->value_instanceof($res['int'], V8\Int32Value::class);
+$helper->value_instanceof($res['func'], V8\FunctionObject::class);
+$helper->value_instanceof($res['missing'], V8\UndefinedValue::class);
+$helper->pretty_dump('Integer key', $res[7]->value());
+$helper->line();
+
+$res = $object->getMany($context, ['string', 'int', 'float', 'bool', 'nil', 'missing', 'getter', 'func', 'symbol'], true);
+
+$helper->pretty_dump('string', $res['string']);
+$helper->pretty_dump('int', $res['int']);
+$helper->pretty_dump('float', $res['float']);
+$helper->pretty_dump('bool', $res['bool']);
+$helper->pretty_dump('nil', $res['nil']);
+$helper->pretty_dump('missing', $res['missing']);
+$helper->pretty_dump('getter', $res['getter']);
+$helper->value_instanceof($res['func'], V8\FunctionObject::class);
+$helper->value_instanceof($res['symbol'], V8\SymbolValue::class);
+$helper->line();
+
+$throwing = $v8_helper->CompileRun($context, '({get foo() { throw new Error("getter failed"); }})');
+
+try {
+    $throwing->getMany($context, ['foo']);
+} catch (\V8\Exceptions\TryCatchException $e) {
+    $helper->exception_export($e);
+}
+
+$getter_calls = [];
+$php_getter = new V8\ObjectValue($context);
+
+foreach (['a', 'b', 'c'] as $name) {
+    $php_getter->setAccessor($context, new \V8\StringValue($isolate, $name), function (\V8\NameValue $name, \V8\PropertyCallbackInfo $info) use (&$getter_calls) {
+        $getter_calls[] = $name->value();
+
+        if ('b' === $name->value()) {
+            throw new RuntimeException('php getter failed');
+        }
+    });
+}
+
+try {
+    $php_getter->getMany($context, ['a', 'b', 'c']);
+} catch (\Throwable $e) {
+    $helper->exception_export($e);
+}
+
+$helper->assert('Getters after failed one are not called', $getter_calls === ['a', 'b']);
+
+try {
+    $object->getMany($context, [1.5]);
+} catch (\V8\Exceptions\ValueException $e) {
+    $helper->exception_export($e);
+}
+
+?>
+--EXPECT--
+Keys are preserved: ok
+Value is instance of V8\StringValue
+Value is instance of V8\Int32Value
+Value is instance of V8\FunctionObject
+Value is instance of V8\UndefinedValue
+Integer key: string(5) "seven"
+
+string: string(4) "test"
+int: int(42)
+float: float(4.2)
+bool: bool(true)
+nil: NULL
+missing: NULL
+getter: string(11) "from getter"
+Value is instance of V8\FunctionObject
+Value is instance of V8\SymbolValue
+
+V8\Exceptions\TryCatchException: Error: getter failed
+RuntimeException: php getter failed
+Getters after failed one are not called: ok
+V8\Exceptions\ValueException: Property key should be either string or integer, float given
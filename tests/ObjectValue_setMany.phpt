@@ -0,0 +1,84 @@
+--TEST--
+V8\ObjectValue::setMany()
+--SKIPIF--
+<?php if (!extension_loaded("v8")) print "skip"; ?>
+--FILE--
+<?php
+
+/** @var \Phpv8Testsuite $helper */
+$helper = require '.testsuite.php';
+
+require '.v8-helpers.php';
+$v8_helper = new PhpV8Helpers($helper);
+
+$isolate = new \V8\Isolate();
+$context = new V8\Context($isolate);
+
+$fnc = new \V8\FunctionObject($context, function () {});
+
+$object = new V8\ObjectValue($context);
+$context->globalObject()->set($context, new \V8\StringValue($isolate, 'obj'), $object);
+
+$res = $object->setMany($context, [
+    'string' => 'test',
+    'int'    => 42,
+    'float'  => 4.2,
+    'null'   => null,
+    'list'   => [1, 2, 3],
+    'map'    => ['foo' => 'bar'],
+    'func'   => $fnc,
+    'js'     => new \V8\StringValue($isolate, 'js string'),
+    7        => 'seven',
+]);
+
+$helper->assert('All properties set', true === $res);
+$v8_helper->ExpectString($context, 'JSON.stringify(obj)', '{"7":"seven","string":"test","int":42,"float":4.2,"null":null,"list":[1,2,3],"map":{"foo":"bar"},"js":"js string"}');
+$v8_helper->ExpectTrue($context, 'typeof obj.func === "function"');
+$helper->line();
+
+$setter = $v8_helper->CompileRun($context, '({set foo(v) { throw new Error("setter failed: " + v); }})');
+
+try {
+    $setter->setMany($context, ['foo' => 'bar']);
+} catch (\V8\Exceptions\TryCatchException $e) {
+    $helper->exception_export($e);
+}
+
+$setter_calls = [];
+$php_setter = new V8\ObjectValue($context);
+
+foreach (['a', 'b', 'c'] as $name) {
+    $php_setter->setAccessor($context, new \V8\StringValue($isolate, $name), function () {
+    }, function (\V8\NameValue $name, \V8\Value $value, \V8\PropertyCallbackInfo $info) use (&$setter_calls) {
+        $setter_calls[] = $name->value();
+
+        if ('b' === $name->value()) {
+            throw new RuntimeException('php setter failed');
+        }
+    });
+}
+
+try {
+    $php_setter->setMany($context, ['a' => 1, 'b' => 2, 'c' => 3]);
+} catch (\Throwable $e) {
+    $helper->exception_export($e);
+}
+
+$helper->assert('Setters after failed one are not called', $setter_calls === ['a', 'b']);
+
+try {
+    $object->setMany($context, ['resource' => STDIN]);
+} catch (\V8\Exceptions\ValueException $e) {
+    $helper->exception_export($e);
+}
+
+?>
+--EXPECT--
+All properties set: ok
+Expected '{"7":"seven","string":"test","int":42,"float":4.2,"null":null,"list":[1,2,3],"map":{"foo":"bar"},"js":"js string"}' value is identical to actual value '{"7":"seven","string":"test","int":42,"float":4.2,"null":null,"list":[1,2,3],"map":{"foo":"bar"},"js":"js string"}'
+Expected true value is identical to actual value true
+
+V8\Exceptions\TryCatchException: Error: setter failed: bar
+RuntimeException: php setter failed
+Setters after failed one are not called: ok
+V8\Exceptions\ValueException: Unable to convert value of type resource
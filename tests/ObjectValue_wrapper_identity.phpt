@@ -0,0 +1,61 @@
+--TEST--
+V8\ObjectValue - js object maps to the same php wrapper while it is alive
+--SKIPIF--
+<?php if (!extension_loaded("v8")) print "skip"; ?>
+--FILE--
+<?php
+
+/** @var \Phpv8Testsuite $helper */
+$helper = require '.testsuite.php';
+
+require '.v8-helpers.php';
+$v8_helper = new PhpV8Helpers($helper);
+
+$isolate = new V8\Isolate();
+$context = new V8\Context($isolate);
+
+$items = $v8_helper->CompileRun($context, 'var items = []; for (var i = 0; i < 10000; i++) { items.push({id: i}); } items');
+
+$wrappers = [];
+$same = true;
+
+for ($i = 0; $i < 10000; $i++) {
+    $wrappers[$i] = $items->get($context, new V8\Int32Value($isolate, $i));
+}
+
+for ($i = 0; $i < 10000; $i++) {
+    $wrapper = $items->get($context, new V8\Int32Value($isolate, $i));
+
+    $same = $same && $wrapper === $wrappers[$i] && $i === $wrapper->get($context, new V8\StringValue($isolate, 'id'))->value();
+}
+
+$helper->assert('Each object maps to its own wrapper', $same);
+
+$object = new V8\ObjectValue($context);
+$context->globalObject()->set($context, new V8\StringValue($isolate, 'obj'), $object);
+
+$helper->assert('Wrapper created in php is found', $object === $context->globalObject()->get($context, new V8\StringValue($isolate, 'obj')));
+
+$plain = $v8_helper->CompileRun($context, 'var plain = {a: 1}; var twin = {a: 1}; plain');
+$helper->assert('Wrapper of js object is found', $plain === $context->globalObject()->get($context, new V8\StringValue($isolate, 'plain')));
+
+// wrapper is not stored on js object, so it keeps the same own keys as identical object that was never wrapped
+$v8_helper->ExpectTrue($context, 'Object.getOwnPropertySymbols(plain).length === 0');
+$v8_helper->ExpectTrue($context, 'JSON.stringify(Reflect.ownKeys(plain)) === JSON.stringify(Reflect.ownKeys(twin))');
+
+$object = null;
+$wrappers = null;
+
+$object = $context->globalObject()->get($context, new V8\StringValue($isolate, 'obj'));
+$helper->assert('New wrapper is created once old one is gone', $object instanceof V8\ObjectValue);
+$helper->assert('New wrapper is found afterwards', $object === $context->globalObject()->get($context, new V8\StringValue($isolate, 'obj')));
+
+?>
+--EXPECT--
+Each object maps to its own wrapper: ok
+Wrapper created in php is found: ok
+Wrapper of js object is found: ok
+Expected true value is identical to actual value true
+Expected true value is identical to actual value true
+New wrapper is created once old one is gone: ok
+New wrapper is found afterwards: ok
@@ -0,0 +1,168 @@
+--TEST--
+V8\PreparedCall
+--SKIPIF--
+<?php if (!extension_loaded("v8")) print "skip"; ?>
+--FILE--
+<?php
+
+/** @var \Phpv8Testsuite $helper */
+$helper = require '.testsuite.php';
+
+require '.v8-helpers.php';
+$v8_helper = new \PhpV8Helpers($helper);
+
+$isolate = new \V8\Isolate();
+$context = new \V8\Context($isolate);
+
+$v8_helper->CompileRun($context, '
+var calls = 0;
+var obj = {
+    prefix: "obj",
+    join: function () {
+        calls++;
+        var result = [this.prefix];
+        for (var i = 0; i < arguments.length; i++) {
+            if (arguments[i] === "throw") {
+                throw new Error("Thrown on call " + calls);
+            }
+            result.push(typeof arguments[i] + ":" + String(arguments[i]));
+        }
+        return result.join(", ");
+    }
+};
+');
+
+/** @var \V8\ObjectValue $obj */
+$obj = $context->globalObject()->get($context, new \V8\StringValue($isolate, 'obj'));
+/** @var \V8\FunctionObject $join */
+$join = $obj->get($context, new \V8\StringValue($isolate, 'join'));
+
+$call = new \V8\PreparedCall($context, $join, $obj);
+
+$helper->header('Object representation');
+$helper->assert('Isolate is stored', $call->getIsolate() === $isolate);
+$helper->assert('Context is stored', $call->getContext() === $context);
+$helper->assert('Function is stored', $call->getFunction() === $join);
+$helper->assert('Receiver is stored', $call->getReceiver() === $obj);
+$helper->line();
+
+$helper->header('Invoke');
+$helper->pretty_dump('No arguments', $call->invoke()->value());
+$helper->pretty_dump('Scalars and values', $call->invoke(null, true, 42, 1.5, 'foo', new \V8\StringValue($isolate, 'bar'))->value());
+$helper->pretty_dump('More arguments than fit inline', $call->invoke(...range(1, 10))->value());
+$helper->assert('Result matches call()', $call->invoke(1, 'two')->value() === $join->callArgs($context, $obj, 1, 'two')->value());
+$helper->line();
+
+$helper->header('Invoke batch');
+$results = $call->invokeBatch([[], [1, 2], 'key' => ['foo', new \V8\StringValue($isolate, 'bar')]]);
+foreach ($results as $key => $result) {
+    $helper->pretty_dump("Result {$key}", $result->value());
+}
+$helper->assert('Empty batch gives empty result', $call->invokeBatch([]) === []);
+$helper->line();
+
+$helper->header('Errors');
+
+try {
+    $call->invoke('throw');
+} catch (\Throwable $e) {
+    $helper->exception_export($e);
+}
+
+try {
+    $call->invokeBatch([[1], ['throw'], [2]]);
+} catch (\Throwable $e) {
+    $helper->exception_export($e);
+}
+
+$helper->assert('Calls after failed batch item are not made', $v8_helper->CompileRun($context, 'calls')->value() == 11);
+
+$php_calls = [];
+$php_callback = new \V8\FunctionObject($context, function (\V8\FunctionCallbackInfo $args) use (&$php_calls) {
+    $arg = $args->arguments()[0]->value();
+    $php_calls[] = $arg;
+
+    if ('throw' === $arg) {
+        throw new RuntimeException('Thrown from php callback');
+    }
+
+    $args->getReturnValue()->set(new \V8\StringValue($args->getIsolate(), 'php:' . $arg));
+});
+
+try {
+    (new \V8\PreparedCall($context, $php_callback, $context->globalObject()))->invokeBatch([['foo'], ['throw'], ['bar']]);
+} catch (\Throwable $e) {
+    $helper->exception_export($e);
+}
+
+$helper->assert('Calls after php callback failed are not made', $php_calls === ['foo', 'throw']);
+
+try {
+    $call->invoke(1, [1]);
+} catch (\Throwable $e) {
+    $helper->exception_export($e);
+}
+
+try {
+    $call->invokeBatch([[1], 'foo']);
+} catch (\Throwable $e) {
+    $helper->exception_export($e);
+}
+
+try {
+    $call->invokeBatch([[1, new stdClass()]]);
+} catch (\Throwable $e) {
+    $helper->exception_export($e);
+}
+
+try {
+    $isolate2 = new \V8\Isolate();
+
+    $call->invokeBatch([['foo', new \V8\StringValue($isolate2)]]);
+} catch (\Throwable $e) {
+    $helper->exception_export($e);
+}
+
+try {
+    $isolate2 = new \V8\Isolate();
+
+    new \V8\PreparedCall($context, $join, new \V8\StringValue($isolate2));
+} catch (\Throwable $e) {
+    $helper->exception_export($e);
+}
+
+?>
+--EXPECT--
+Object representation:
+----------------------
+Isolate is stored: ok
+Context is stored: ok
+Function is stored: ok
+Receiver is stored: ok
+
+Invoke:
+-------
+No arguments: string(3) "obj"
+Scalars and values: string(77) "obj, object:null, boolean:true, number:42, number:1.5, string:foo, string:bar"
+More arguments than fit inline: string(104) "obj, number:1, number:2, number:3, number:4, number:5, number:6, number:7, number:8, number:9, number:10"
+Result matches call(): ok
+
+Invoke batch:
+-------------
+Result 0: string(3) "obj"
+Result 1: string(23) "obj, number:1, number:2"
+Result 2: string(27) "obj, string:foo, string:bar"
+Empty batch gives empty result: ok
+
+Errors:
+-------
+V8\Exceptions\TryCatchException: Error: Thrown on call 9
+V8\Exceptions\TryCatchException: Error: Thrown on call 11
+Calls after failed batch item are not made: ok
+RuntimeException: Thrown from php callback
+Calls after php callback failed are not made: ok
+TypeError: Argument 2 passed to V8\PreparedCall::invoke() must be an instance of \V8\Value or scalar, array given
+TypeError: Argument 1 passed to V8\PreparedCall::invokeBatch() must be an array of arrays, string given at 1 offset
+TypeError: Argument 1 passed to V8\PreparedCall::invokeBatch() must be an array of \V8\Value objects or scalars, instance of stdClass given at 1 offset
+V8\Exceptions\Exception: Isolates mismatch: argument 1 passed to V8\PreparedCall::invokeBatch() at 1 offset
+V8\Exceptions\Exception: Isolates mismatch
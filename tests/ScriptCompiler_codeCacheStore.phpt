@@ -0,0 +1,218 @@
+--TEST--
+V8\ScriptCompiler::setCodeCacheStore()
+--SKIPIF--
+<?php if (!extension_loaded("v8")) print "skip"; ?>
+--FILE--
+<?php
+
+/** @var \Phpv8Testsuite $helper */
+$helper = require '.testsuite.php';
+
+use V8\ScriptCompiler;
+use V8\ScriptCompiler\CachedData;
+use V8\ScriptCompiler\CodeCacheStoreInterface;
+
+
+class TracingCodeCacheStore implements CodeCacheStoreInterface
+{
+    public $store;
+
+    public function __construct(CodeCacheStoreInterface $store)
+    {
+        $this->store = $store;
+    }
+
+    public function get(string $key): ?CachedData
+    {
+        $cached_data = $this->store->get($key);
+        echo 'get: ', null === $cached_data ? 'miss' : 'hit', PHP_EOL;
+
+        return $cached_data;
+    }
+
+    public function set(string $key, CachedData $cached_data)
+    {
+        echo 'set', PHP_EOL;
+        $this->store->set($key, $cached_data);
+    }
+
+    public function delete(string $key)
+    {
+        echo 'delete', PHP_EOL;
+        $this->store->delete($key);
+    }
+}
+
+$directory = sys_get_temp_dir() . '/php-v8-code-cache-' . getmypid();
+@mkdir($directory);
+
+$isolate = new V8\Isolate();
+$context = new V8\Context($isolate);
+
+$source_string = new V8\StringValue($isolate, "function f() { return 'abc'; }; f() + 'def'");
+$origin        = new V8\ScriptOrigin('test.js');
+
+$helper->assert('No store set by default', ScriptCompiler::getCodeCacheStore() === null);
+$helper->line();
+
+foreach (['memory' => new ScriptCompiler\MemoryCodeCacheStore(), 'directory' => new ScriptCompiler\DirectoryCodeCacheStore($directory)] as $name => $store) {
+    $helper->header(ucfirst($name) . ' store');
+
+    $store = new TracingCodeCacheStore($store);
+    ScriptCompiler::setCodeCacheStore($store);
+    $helper->assert('Store set', ScriptCompiler::getCodeCacheStore() === $store);
+
+    $source = new ScriptCompiler\Source($source_string, $origin);
+
+    $script = ScriptCompiler::compile($context, $source);
+    echo 'compiled', PHP_EOL;
+    $helper->pretty_dump('Script result', $script->run($context)->value());
+    $helper->pretty_dump('Script result', $script->run($context)->value());
+    $helper->assert('Source left untouched', $source->getCachedData() === null);
+
+    $script = ScriptCompiler::compile($context, $source);
+    $helper->pretty_dump('Script result', $script->run($context)->value());
+
+    $unbound = ScriptCompiler::compileUnboundScript($context, $source);
+    $helper->pretty_dump('Script result', $unbound->bindToContext($context)->run($context)->value());
+
+    echo 'different origin:', PHP_EOL;
+    ScriptCompiler::compileUnboundScript($context, new ScriptCompiler\Source($source_string, new V8\ScriptOrigin('other.js')));
+
+    echo 'explicit options:', PHP_EOL;
+    ScriptCompiler::compile($context, $source, ScriptCompiler::OPTION_EAGER_COMPILE);
+    $helper->line();
+}
+
+$helper->header('Rejected cache data');
+
+$store = new ScriptCompiler\MemoryCodeCacheStore();
+
+ScriptCompiler::setCodeCacheStore(new class($store) extends TracingCodeCacheStore {
+    public function get(string $key): ?CachedData
+    {
+        if ($this->store->get($key)) {
+            // replace good data with garbage
+            $this->store->set($key, new CachedData('garbage'));
+        }
+
+        return parent::get($key);
+    }
+});
+
+$script = ScriptCompiler::compile($context, new ScriptCompiler\Source($source_string, $origin));
+$helper->pretty_dump('Script result', $script->run($context)->value());
+$helper->line();
+
+$helper->header('Invalid store');
+
+ScriptCompiler::setCodeCacheStore(new class implements CodeCacheStoreInterface {
+    public function get(string $key): ?CachedData
+    {
+        throw new RuntimeException('Store is down');
+    }
+
+    public function set(string $key, CachedData $cached_data)
+    {
+    }
+
+    public function delete(string $key)
+    {
+    }
+});
+
+try {
+    ScriptCompiler::compile($context, new ScriptCompiler\Source($source_string, $origin));
+} catch (RuntimeException $e) {
+    $helper->exception_export($e);
+}
+
+ScriptCompiler::setCodeCacheStore(null);
+$helper->assert('Store unset', ScriptCompiler::getCodeCacheStore() === null);
+$helper->line();
+
+$helper->header('Directory store API');
+
+try {
+    new ScriptCompiler\DirectoryCodeCacheStore(__DIR__ . '/nonexistent');
+} catch (\V8\Exceptions\Exception $e) {
+    $helper->exception_export($e);
+}
+
+$store = new ScriptCompiler\DirectoryCodeCacheStore($directory);
+$helper->assert('Directory is set', $store->getDirectory() === $directory);
+
+try {
+    $store->get('../escape');
+} catch (\V8\Exceptions\ValueException $e) {
+    $helper->exception_export($e);
+}
+
+$store->set('php-v8-test', new CachedData('data'));
+$helper->assert('Data stored', $store->get('php-v8-test')->getData() === 'data');
+$store->delete('php-v8-test');
+$helper->assert('Data deleted', $store->get('php-v8-test') === null);
+$store->delete('php-v8-test');
+
+array_map('unlink', glob($directory . '/*'));
+rmdir($directory);
+
+?>
+--EXPECTF--
+No store set by default: ok
+
+Memory store:
+-------------
+Store set: ok
+get: miss
+compiled
+set
+Script result: string(6) "abcdef"
+Script result: string(6) "abcdef"
+Source left untouched: ok
+get: hit
+Script result: string(6) "abcdef"
+get: hit
+Script result: string(6) "abcdef"
+different origin:
+get: miss
+set
+explicit options:
+
+Directory store:
+----------------
+Store set: ok
+get: miss
+compiled
+set
+Script result: string(6) "abcdef"
+Script result: string(6) "abcdef"
+Source left untouched: ok
+get: hit
+Script result: string(6) "abcdef"
+get: hit
+Script result: string(6) "abcdef"
+different origin:
+get: miss
+set
+explicit options:
+
+Rejected cache data:
+--------------------
+get: hit
+delete
+set
+Script result: string(6) "abcdef"
+
+Invalid store:
+--------------
+RuntimeException: Store is down
+Store unset: ok
+
+Directory store API:
+--------------------
+V8\Exceptions\Exception: Code cache directory '%s/nonexistent' does not exist
+Directory is set: ok
+V8\Exceptions\ValueException: Code cache key should be non-empty string of alphanumeric, '-', '_' and '.' chars and should not start with '.'
+Data stored: ok
+Data deleted: ok
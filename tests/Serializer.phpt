@@ -0,0 +1,205 @@
+--TEST--
+V8\Serializer and V8\Deserializer
+--SKIPIF--
+<?php if (!extension_loaded("v8")) print "skip"; ?>
+--FILE--
+<?php
+
+/** @var \Phpv8Testsuite $helper */
+$helper = require '.testsuite.php';
+
+require '.v8-helpers.php';
+$v8_helper = new PhpV8Helpers($helper);
+
+
+$isolate = new V8\Isolate();
+$context = new V8\Context($isolate);
+
+$other_isolate = new V8\Isolate();
+$other_context = new V8\Context($other_isolate);
+
+
+$helper->header('Round trip');
+
+$value = $v8_helper->CompileRun($context, '
+    var shared = {answer: 42};
+    var sparse = [1, 2];
+    sparse[10] = 3;
+
+    ({
+        string: "foo ф\u{1F600}",
+        number: 4.2,
+        int: -42,
+        list: [1, , "two", shared],
+        sparse: sparse,
+        nested: {shared: shared},
+        date: new Date(1500000000000),
+        regexp: /foo/gi,
+        map: new Map([["key", "value"], [1, shared]]),
+        set: new Set([1, "two"]),
+        bytes: new Uint16Array([1, 2, 65535]),
+        boxed: new String("boxed"),
+    })
+');
+
+$data = V8\Serializer::serialize($context, $value);
+
+$helper->assert('Serialized to string', is_string($data) && strlen($data) > 0);
+
+$copy = V8\Deserializer::deserialize($other_context, $data);
+$helper->assert('Deserialized value is an object', $copy instanceof V8\ObjectValue);
+
+$other_context->globalObject()->set($other_context, new V8\StringValue($other_isolate, 'copy'), $copy);
+
+$v8_helper->ExpectTrue($other_context, 'copy.string === "foo ф\u{1F600}"');
+$v8_helper->ExpectTrue($other_context, 'copy.number === 4.2 && copy.int === -42');
+$v8_helper->ExpectTrue($other_context, 'copy.list.length === 4 && !(1 in copy.list) && copy.list[2] === "two"');
+$v8_helper->ExpectTrue($other_context, 'copy.sparse.length === 11 && copy.sparse[10] === 3');
+$v8_helper->ExpectTrue($other_context, 'copy.list[3] === copy.nested.shared && copy.map.get(1) === copy.nested.shared');
+$v8_helper->ExpectTrue($other_context, 'copy.date instanceof Date && copy.date.getTime() === 1500000000000');
+$v8_helper->ExpectTrue($other_context, 'copy.regexp instanceof RegExp && copy.regexp.toString() === "/foo/gi"');
+$v8_helper->ExpectTrue($other_context, 'copy.map instanceof Map && copy.map.get("key") === "value"');
+$v8_helper->ExpectTrue($other_context, 'copy.set instanceof Set && copy.set.has("two")');
+$v8_helper->ExpectTrue($other_context, 'copy.bytes instanceof Uint16Array && copy.bytes[2] === 65535');
+$v8_helper->ExpectTrue($other_context, 'copy.boxed instanceof String && copy.boxed.valueOf() === "boxed"');
+$helper->line();
+
+
+$helper->header('Primitives');
+
+$data = V8\Serializer::serialize($context, new V8\StringValue($isolate, 'test'));
+$res = V8\Deserializer::deserialize($other_context, $data);
+$helper->assert('String deserialized', $res instanceof V8\StringValue && 'test' === $res->value());
+
+$data = V8\Serializer::serialize($context, new V8\NullValue($isolate));
+$res = V8\Deserializer::deserialize($other_context, $data);
+$helper->assert('Null deserialized', $res instanceof V8\NullValue);
+$helper->line();
+
+
+$helper->header('Host objects');
+
+$template = new V8\ObjectTemplate($isolate);
+$template->setInternalFieldCount(1);
+$helper->assert('Internal field count set', 1 === $template->internalFieldCount());
+
+$host = $template->newInstance($context);
+$host->set($context, new V8\StringValue($isolate, 'id'), new V8\NumberValue($isolate, 7));
+
+$wrapper = new V8\ObjectValue($context);
+$wrapper->set($context, new V8\StringValue($isolate, 'host'), $host);
+
+try {
+    V8\Serializer::serialize($context, $wrapper);
+} catch (\V8\Exceptions\TryCatchException $e) {
+    $helper->assert('Host object can not be serialized without writer', true);
+}
+
+$data = V8\Serializer::serialize($context, $wrapper, function (V8\ObjectValue $object) use ($context, $isolate) {
+    return 'host:' . $object->get($context, new V8\StringValue($isolate, 'id'))->value();
+});
+
+$other_template = new V8\ObjectTemplate($other_isolate);
+$other_template->setInternalFieldCount(1);
+
+$res = V8\Deserializer::deserialize($other_context, $data, function (string $data) use ($other_context, $other_template, $helper) {
+    $helper->assert('Host object data passed to reader', 'host:7' === $data);
+
+    return $other_template->newInstance($other_context);
+});
+
+$helper->assert('Host object deserialized', $res->get($other_context, new V8\StringValue($other_isolate, 'host')) instanceof V8\ObjectValue);
+
+try {
+    V8\Deserializer::deserialize($other_context, $data, function () {
+        return 'not an object';
+    });
+} catch (\V8\Exceptions\ValueException $e) {
+    $helper->exception_export($e);
+}
+
+try {
+    V8\Deserializer::deserialize($other_context, $data, function () use ($context) {
+        return new V8\ObjectValue($context);
+    });
+} catch (\V8\Exceptions\Exception $e) {
+    $helper->exception_export($e);
+}
+
+try {
+    V8\Serializer::serialize($context, $wrapper, function () {
+        return 42;
+    });
+} catch (\V8\Exceptions\ValueException $e) {
+    $helper->exception_export($e);
+}
+
+try {
+    V8\Serializer::serialize($context, $wrapper, function () {
+        throw new RuntimeException('Writer failed');
+    });
+} catch (RuntimeException $e) {
+    $helper->exception_export($e);
+}
+$helper->line();
+
+
+$helper->header('Errors');
+
+try {
+    V8\Serializer::serialize($context, $v8_helper->CompileRun($context, 'Symbol("foo")'));
+} catch (\V8\Exceptions\TryCatchException $e) {
+    $helper->exception_export($e);
+}
+
+try {
+    V8\Serializer::serialize($other_context, $wrapper);
+} catch (\V8\Exceptions\Exception $e) {
+    $helper->exception_export($e);
+}
+
+try {
+    V8\Deserializer::deserialize($other_context, 'garbage');
+} catch (\V8\Exceptions\Exception $e) {
+    $helper->exception_export($e);
+}
+
+?>
+--EXPECT--
+Round trip:
+-----------
+Serialized to string: ok
+Deserialized value is an object: ok
+Expected true value is identical to actual value true
+Expected true value is identical to actual value true
+Expected true value is identical to actual value true
+Expected true value is identical to actual value true
+Expected true value is identical to actual value true
+Expected true value is identical to actual value true
+Expected true value is identical to actual value true
+Expected true value is identical to actual value true
+Expected true value is identical to actual value true
+Expected true value is identical to actual value true
+Expected true value is identical to actual value true
+
+Primitives:
+-----------
+String deserialized: ok
+Null deserialized: ok
+
+Host objects:
+-------------
+Internal field count set: ok
+Host object can not be serialized without writer: ok
+Host object data passed to reader: ok
+Host object deserialized: ok
+V8\Exceptions\ValueException: Host object reader should return V8\ObjectValue
+V8\Exceptions\Exception: Isolates mismatch
+V8\Exceptions\ValueException: Host object writer should return string, integer given
+RuntimeException: Writer failed
+
+Errors:
+-------
+V8\Exceptions\TryCatchException: Error: Symbol(foo) could not be cloned.
+V8\Exceptions\Exception: Isolates mismatch
+V8\Exceptions\TryCatchException: Error: Unable to deserialize cloned data due to invalid or unsupported version.
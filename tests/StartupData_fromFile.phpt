@@ -0,0 +1,69 @@
+--TEST--
+V8\StartupData::fromFile()
+--SKIPIF--
+<?php if (!extension_loaded("v8")) print "skip"; ?>
+--FILE--
+<?php
+
+/** @var \Phpv8Testsuite $helper */
+$helper = require '.testsuite.php';
+
+$file = tempnam(sys_get_temp_dir(), 'php-v8-startup-data');
+
+$source = 'function test_snapshot() { return "hello, world";}';
+$blob = V8\StartupData::createFromSource($source)->getData();
+file_put_contents($file, $blob);
+
+$data = V8\StartupData::fromFile($file);
+
+$helper->assert('Mapped blob is the same as written', $data->getData() === $blob);
+$helper->assert('Mapped blob is not rejected', $data->isRejected(), false);
+
+$isolate = new \V8\Isolate($data);
+$context = new \V8\Context($isolate);
+
+$helper->assert('Mapped blob is not rejected', $data->isRejected(), false);
+$data = null;
+
+$helper->assert('Context global is affected by mapped blob', $context->globalObject()->get($context, new \V8\StringValue($isolate, 'test_snapshot'))->isFunction());
+$helper->line();
+
+$data = V8\StartupData::fromFile($file);
+$data->persist('test');
+$helper->assert('Mapped blob persisted as is', V8\StartupData::fetchPersisted('test')->getData() === $blob);
+V8\StartupData::forgetPersisted('test');
+$helper->line();
+
+foreach ([
+    'missing file' => null,
+    'small file'   => 'abc',
+    'other tag'    => pack('VV', 0, 0) . substr($blob, 8),
+] as $name => $contents) {
+    if (null === $contents) {
+        unlink($file);
+    } else {
+        file_put_contents($file, $contents);
+    }
+
+    try {
+        V8\StartupData::fromFile($file);
+    } catch (\V8\Exceptions\Exception $e) {
+        echo $name, ': ';
+        $helper->exception_export($e);
+    }
+}
+
+@unlink($file);
+
+?>
+--EXPECTF--
+Mapped blob is the same as written: ok
+Mapped blob is not rejected: ok
+Mapped blob is not rejected: ok
+Context global is affected by mapped blob: ok
+
+Mapped blob persisted as is: ok
+
+missing file: V8\Exceptions\Exception: Unable to map startup blob file '%s': No such file or directory
+small file: V8\Exceptions\Exception: Invalid startup blob (too small)
+other tag: V8\Exceptions\Exception: Invalid startup blob (created by different v8 or php-v8 version)
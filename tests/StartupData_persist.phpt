@@ -0,0 +1,61 @@
+--TEST--
+V8\StartupData::persist()
+--SKIPIF--
+<?php if (!extension_loaded("v8")) print "skip"; ?>
+--FILE--
+<?php
+
+/** @var \Phpv8Testsuite $helper */
+$helper = require '.testsuite.php';
+
+$source = 'function test_snapshot() { return "hello, world";}';
+$data = V8\StartupData::createFromSource($source);
+
+$helper->assert('Nothing persisted under unknown name', V8\StartupData::fetchPersisted('test') === null);
+$helper->assert('Nothing to forget under unknown name', V8\StartupData::forgetPersisted('test') === false);
+$helper->line();
+
+$data->persist('test');
+$helper->assert('Persisted data still usable', strlen($data->getData()) > 400000);
+
+$persisted = V8\StartupData::fetchPersisted('test');
+$helper->assert('Persisted data fetched', $persisted instanceof V8\StartupData);
+$helper->assert('Fetched data is not the same object', $persisted !== $data);
+$helper->assert('Fetched data is the same blob', $persisted->getData() === $data->getData());
+$data = null;
+$helper->line();
+
+$isolate = new \V8\Isolate($persisted);
+$context = new \V8\Context($isolate);
+
+$helper->assert('Fetched data is not rejected', $persisted->isRejected(), false);
+$helper->assert('Context global is affected by fetched data', $context->globalObject()->get($context, new \V8\StringValue($isolate, 'test_snapshot'))->isFunction());
+$helper->line();
+
+$other = V8\StartupData::createFromSource('var test_other = 1;');
+$other->persist('test');
+$helper->assert('Persisting with the same name replaces data', V8\StartupData::fetchPersisted('test')->getData() === $other->getData());
+$helper->assert('Previously fetched data still usable', strlen($persisted->getData()) > 400000);
+$helper->line();
+
+$helper->assert('Persisted data forgotten', V8\StartupData::forgetPersisted('test') === true);
+$helper->assert('Forgotten data can not be fetched', V8\StartupData::fetchPersisted('test') === null);
+
+?>
+--EXPECT--
+Nothing persisted under unknown name: ok
+Nothing to forget under unknown name: ok
+
+Persisted data still usable: ok
+Persisted data fetched: ok
+Fetched data is not the same object: ok
+Fetched data is the same blob: ok
+
+Fetched data is not rejected: ok
+Context global is affected by fetched data: ok
+
+Persisting with the same name replaces data: ok
+Previously fetched data still usable: ok
+
+Persisted data forgotten: ok
+Forgotten data can not be fetched: ok
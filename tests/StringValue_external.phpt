@@ -0,0 +1,83 @@
+--TEST--
+V8\StringValue::external()
+--SKIPIF--
+<?php if (!extension_loaded("v8")) print "skip"; ?>
+--FILE--
+<?php
+
+/** @var \Phpv8Testsuite $helper */
+$helper = require '.testsuite.php';
+
+$isolate = new V8\Isolate();
+$context = new V8\Context($isolate);
+
+$data = str_repeat('{"key": "value"}, ', 1024 * 64);
+
+$value = V8\StringValue::external($isolate, $data);
+
+$helper->assert('External string is StringValue', $value instanceof V8\StringValue);
+$helper->assert('ASCII string is external', $value->isExternal());
+$helper->assert('External string is one-byte', $value->isOneByte());
+$helper->assert('External string holds the same data', $value->value() === $data);
+$helper->assert('External string length', $value->length() === strlen($data));
+$helper->line();
+
+$context->globalObject()->set($context, new V8\StringValue($isolate, 'data'), $value);
+$result = (new V8\Script($context, new V8\StringValue($isolate, 'data.length + ":" + data.slice(0, 16)')))->run($context);
+$helper->pretty_dump('JS sees external string', $result->value());
+
+// PHP string may be changed or gone, V8 keeps its own reference
+$data .= 'tail';
+unset($data);
+$helper->assert('External string is untouched', strlen($value->value()) === 16 * 1024 * 64 + 2 * 1024 * 64);
+$helper->line();
+
+$value = V8\StringValue::external($isolate, 'ünïcödé');
+$helper->assert('Non-ASCII string is not external', !$value->isExternal());
+$helper->pretty_dump('Non-ASCII string value', $value->value());
+
+$value = V8\StringValue::external($isolate, '');
+$helper->assert('Empty string is not external', !$value->isExternal());
+$helper->pretty_dump('Empty string value', $value->value());
+
+$value = new V8\StringValue($isolate, 'regular');
+$helper->assert('Regular string is not external', !$value->isExternal());
+$helper->line();
+
+$pool = new V8\IsolatePool('external', null, 1);
+$isolate = $pool->acquire();
+$value = V8\StringValue::external($isolate, str_repeat('x', 1024));
+$value = null;
+$isolate = null;
+$stats = $pool->getStats();
+$helper->assert('Isolate with collectable external strings goes back to pool', $stats['idle'] === 1 && $stats['discards'] === 0);
+
+$isolate = $pool->acquire();
+$context = new V8\Context($isolate);
+$value = V8\StringValue::external($isolate, str_repeat('x', 1024));
+$context->globalObject()->set($context, new V8\StringValue($isolate, 'data'), $value);
+$value = null;
+$context = null;
+$isolate = null;
+$stats = $pool->getStats();
+$helper->assert('Isolate ends up in pool or discarded', $stats['idle'] + $stats['discards'] === 1);
+
+?>
+--EXPECT--
+External string is StringValue: ok
+ASCII string is external: ok
+External string is one-byte: ok
+External string holds the same data: ok
+External string length: ok
+
+JS sees external string: string(24) "1179648:{"key": "value"}"
+External string is untouched: ok
+
+Non-ASCII string is not external: ok
+Non-ASCII string value: string(14) "ünïcödé"
+Empty string is not external: ok
+Empty string value: string(0) ""
+Regular string is not external: ok
+
+Isolate with collectable external strings goes back to pool: ok
+Isolate ends up in pool or discarded: ok
@@ -0,0 +1,61 @@
+--TEST--
+V8\StringValue::value() - one-byte and two-byte strings
+--SKIPIF--
+<?php if (!extension_loaded("v8")) print "skip"; ?>
+--FILE--
+<?php
+
+/** @var \Phpv8Testsuite $helper */
+$helper = require '.testsuite.php';
+
+$isolate = new V8\Isolate();
+$context = new V8\Context($isolate);
+
+$run = function (string $source) use ($isolate, $context) {
+    return (new V8\Script($context, new V8\StringValue($isolate, $source)))->run($context);
+};
+
+$value = $run('""');
+$helper->assert('Empty string', '' === $value->value());
+
+$value = $run('"ascii only"');
+$helper->assert('ASCII string is one-byte', $value->isOneByte());
+$helper->pretty_dump('ASCII string', $value->value());
+
+$value = $run('"café crème brûlée"');
+$helper->assert('Latin1 string is one-byte', $value->isOneByte());
+$helper->pretty_dump('Latin1 string', $value->value());
+
+$value = $run('"ÿ".repeat(3)');
+$helper->assert('Latin1-only string is one-byte', $value->isOneByte());
+$helper->pretty_dump('Latin1-only string', $value->value());
+
+$value = $run('"привіт 😀"');
+$helper->assert('Non-latin1 string is two-byte', !$value->isOneByte());
+$helper->pretty_dump('Two-byte string', $value->value());
+
+$value = $run('"x".repeat(1024 * 1024) + "é"');
+$helper->assert('Large latin1 string', str_repeat('x', 1024 * 1024) . 'é' === $value->value());
+
+$value = $run('"ж".repeat(1024 * 1024)');
+$helper->assert('Large two-byte string', str_repeat('ж', 1024 * 1024) === $value->value());
+$helper->line();
+
+$value = $run('({ascii: "foo", latin1: "é", utf: "ж😀"})');
+$helper->pretty_dump('JSON::stringify()', V8\JSON::stringify($context, $value));
+
+?>
+--EXPECT--
+Empty string: ok
+ASCII string is one-byte: ok
+ASCII string: string(10) "ascii only"
+Latin1 string is one-byte: ok
+Latin1 string: string(21) "café crème brûlée"
+Latin1-only string is one-byte: ok
+Latin1-only string: string(6) "ÿÿÿ"
+Non-latin1 string is two-byte: ok
+Two-byte string: string(17) "привіт 😀"
+Large latin1 string: ok
+Large two-byte string: ok
+
+JSON::stringify(): string(44) "{"ascii":"foo","latin1":"é","utf":"ж😀"}"
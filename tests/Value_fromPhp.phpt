@@ -0,0 +1,173 @@
+--TEST--
+V8\Value::fromPhp()
+--SKIPIF--
+<?php if (!extension_loaded("v8")) print "skip"; ?>
+--FILE--
+<?php
+
+/** @var \Phpv8Testsuite $helper */
+$helper = require '.testsuite.php';
+
+require '.v8-helpers.php';
+$v8_helper = new PhpV8Helpers($helper);
+
+class Serialized implements JsonSerializable {
+    public function jsonSerialize() {
+        return ['serialized' => true];
+    }
+}
+
+class SerializesToItself implements JsonSerializable {
+    public $public = 'public';
+    protected $protected = 'protected';
+    private $private = 'private';
+
+    public function jsonSerialize() {
+        return $this;
+    }
+}
+
+class Plain {
+    public $foo = 'bar';
+    protected $protected = 'protected';
+    private $private = 'private';
+}
+
+class Throwing implements JsonSerializable {
+    public function jsonSerialize() {
+        throw new RuntimeException('Nope');
+    }
+}
+
+// Tests:
+
+$isolate = new V8\Isolate();
+$context = new V8\Context($isolate);
+
+$stringify = function ($value) use ($context) {
+    return V8\JSON::stringify($context, V8\Value::fromPhp($context, $value));
+};
+
+$helper->header('Scalars');
+$helper->method_export(V8\Value::fromPhp($context, null), 'isNull');
+$helper->method_export(V8\Value::fromPhp($context, true), 'isTrue');
+$helper->method_export(V8\Value::fromPhp($context, false), 'isFalse');
+$helper->value_instanceof(V8\Value::fromPhp($context, 42), V8\Int32Value::class);
+$helper->value_instanceof(V8\Value::fromPhp($context, PHP_INT_MAX), V8\NumberValue::class);
+$helper->value_instanceof(V8\Value::fromPhp($context, 4.2), V8\NumberValue::class);
+$helper->value_instanceof(V8\Value::fromPhp($context, 'foo'), V8\StringValue::class);
+$helper->pretty_dump('UTF-8 string', V8\Value::fromPhp($context, 'ünïcödé')->value());
+$helper->space();
+
+$helper->header('Arrays and objects');
+$helper->pretty_dump('List', $stringify([1, 'two', 3.5, null, true]));
+$helper->pretty_dump('Empty array', $stringify([]));
+$helper->pretty_dump('Map', $stringify(['foo' => 'bar', 'nested' => ['list' => [1, 2], 'map' => ['a' => 1]]]));
+$helper->pretty_dump('Sparse array', $stringify([1 => 'one', 2 => 'two']));
+$helper->pretty_dump('Negative keys', $stringify([-1 => 'minus one']));
+$helper->pretty_dump('stdClass', $stringify((object) ['foo' => 'bar']));
+$helper->pretty_dump('Plain object', $stringify(new Plain()));
+$helper->pretty_dump('JsonSerializable', $stringify(new Serialized()));
+$helper->pretty_dump('JsonSerializable to itself', $stringify(new SerializesToItself()));
+
+$value = V8\Value::fromPhp($context, ['list' => [1, 2, 3]]);
+$helper->value_instanceof($value, V8\ObjectValue::class);
+$helper->value_instanceof($value->get($context, new V8\StringValue($isolate, 'list')), V8\ArrayObject::class);
+
+$js_value = new V8\StringValue($isolate, 'js');
+$value = V8\Value::fromPhp($context, [$js_value]);
+$helper->assert('V8\Value instances are passed as is', $value->get($context, new V8\Int32Value($isolate, 0))->sameValue($js_value));
+$helper->space();
+
+$helper->header('Errors');
+
+try {
+    V8\Value::fromPhp($context, STDIN);
+} catch (V8\Exceptions\ValueException $e) {
+    $helper->exception_export($e);
+}
+
+$cycle = ['foo' => 'bar'];
+$cycle['self'] = &$cycle;
+
+try {
+    V8\Value::fromPhp($context, $cycle);
+} catch (V8\Exceptions\ValueException $e) {
+    $helper->exception_export($e);
+}
+
+$object = new stdClass();
+$object->self = $object;
+
+try {
+    V8\Value::fromPhp($context, $object);
+} catch (V8\Exceptions\ValueException $e) {
+    $helper->exception_export($e);
+}
+
+try {
+    V8\Value::fromPhp($context, [[[1]]], 2);
+} catch (V8\Exceptions\ValueException $e) {
+    $helper->exception_export($e);
+}
+
+$helper->pretty_dump('Exact depth', $stringify([[1]], 2));
+
+try {
+    V8\Value::fromPhp($context, [new Throwing()]);
+} catch (RuntimeException $e) {
+    $helper->exception_export($e);
+}
+
+try {
+    V8\Value::fromPhp($context, 1, 0);
+} catch (V8\Exceptions\ValueException $e) {
+    $helper->exception_export($e);
+}
+
+try {
+    V8\Value::fromPhp($context, [new V8\StringValue(new V8\Isolate(), 'other')]);
+} catch (V8\Exceptions\Exception $e) {
+    $helper->exception_export($e);
+}
+
+?>
+--EXPECT--
+Scalars:
+--------
+V8\NullValue(V8\Value)->isNull(): bool(true)
+V8\BooleanValue(V8\Value)->isTrue(): bool(true)
+V8\BooleanValue(V8\Value)->isFalse(): bool(true)
+Value is instance of V8\Int32Value
+Value is instance of V8\NumberValue
+Value is instance of V8\NumberValue
+Value is instance of V8\StringValue
+UTF-8 string: string(14) "ünïcödé"
+
+
+Arrays and objects:
+-------------------
+List: string(23) "[1,"two",3.5,null,true]"
+Empty array: string(2) "[]"
+Map: string(51) "{"foo":"bar","nested":{"list":[1,2],"map":{"a":1}}}"
+Sparse array: string(21) "{"1":"one","2":"two"}"
+Negative keys: string(18) "{"-1":"minus one"}"
+stdClass: string(13) "{"foo":"bar"}"
+Plain object: string(13) "{"foo":"bar"}"
+JsonSerializable: string(19) "{"serialized":true}"
+JsonSerializable to itself: string(19) "{"public":"public"}"
+Value is instance of V8\ObjectValue
+Value is instance of V8\ArrayObject
+V8\Value instances are passed as is: ok
+
+
+Errors:
+-------
+V8\Exceptions\ValueException: Unable to convert value of type resource
+V8\Exceptions\ValueException: Unable to convert circular structure
+V8\Exceptions\ValueException: Unable to convert circular structure
+V8\Exceptions\ValueException: Maximum nesting depth of 2 exceeded
+Exact depth: string(5) "[[1]]"
+RuntimeException: Nope
+V8\Exceptions\ValueException: Max depth should be a positive number
+V8\Exceptions\Exception: Isolates mismatch
@@ -0,0 +1,121 @@
+--TEST--
+V8\Value::toPhp()
+--SKIPIF--
+<?php if (!extension_loaded("v8")) print "skip"; ?>
+--FILE--
+<?php
+
+/** @var \Phpv8Testsuite $helper */
+$helper = require '.testsuite.php';
+
+require '.v8-helpers.php';
+$v8_helper = new PhpV8Helpers($helper);
+
+// Tests:
+
+$isolate = new V8\Isolate();
+$context = new V8\Context($isolate);
+
+$to_php = function (string $source, int $max_depth = 512) use ($v8_helper, $context) {
+    return $v8_helper->CompileRun($context, $source)->toPhp($context, $max_depth);
+};
+
+$helper->header('Primitives');
+$helper->pretty_dump('undefined', $to_php('undefined'));
+$helper->pretty_dump('null', $to_php('null'));
+$helper->pretty_dump('true', $to_php('true'));
+$helper->pretty_dump('int', $to_php('42'));
+$helper->pretty_dump('negative int', $to_php('-42'));
+$helper->pretty_dump('uint32', $to_php('4294967295'));
+$helper->pretty_dump('integral double', $to_php('Math.pow(2, 40)'));
+$helper->pretty_dump('double', $to_php('4.2'));
+$helper->pretty_dump('NaN', $to_php('NaN'));
+$helper->pretty_dump('string', $to_php('"ünïcödé"'));
+$helper->space();
+
+$helper->header('Arrays and objects');
+$helper->assert('Array', [1, 'two', null, null] === $to_php('[1, "two", null, undefined]'));
+$helper->assert('Array with holes', [null, 1] === $to_php('[, 1]'));
+$helper->assert('Object', ['foo' => 'bar', 'nested' => ['list' => [1, 2]]] === $to_php('({foo: "bar", nested: {list: [1, 2]}})'));
+$helper->assert('Object with index keys', [1 => 'one', 'two' => 2] === $to_php('({1: "one", two: 2})'));
+$helper->assert('Non-enumerable properties are skipped', ['visible' => true] === $to_php('Object.defineProperty({visible: true}, "hidden", {value: true, enumerable: false})'));
+$helper->assert('Inherited properties are skipped', ['own' => true] === $to_php('var o = Object.create({inherited: true}); o.own = true; o'));
+$helper->assert('Getters are invoked', ['value' => 42] === $to_php('({get value() { return 42; }})'));
+
+$res = $to_php('var shared = {}; [shared, shared]');
+$helper->assert('Shared objects are not cycles', [[], []] === $res);
+
+$res = $to_php('({fn: function () {}, date: new Date(0), symbol: Symbol("foo")})');
+$helper->value_instanceof($res['fn'], V8\FunctionObject::class);
+$helper->value_instanceof($res['date'], V8\DateObject::class);
+$helper->value_instanceof($res['symbol'], V8\SymbolValue::class);
+$helper->space();
+
+$helper->header('Errors');
+
+try {
+    $to_php('var o = {}; o.self = o; o');
+} catch (V8\Exceptions\ValueException $e) {
+    $helper->exception_export($e);
+}
+
+try {
+    $to_php('[[[1]]]', 2);
+} catch (V8\Exceptions\ValueException $e) {
+    $helper->exception_export($e);
+}
+
+try {
+    $to_php('({get value() { throw new Error("getter failed"); }})');
+} catch (V8\Exceptions\TryCatchException $e) {
+    $helper->exception_export($e);
+}
+
+$helper->space();
+
+$helper->header('Round trip');
+
+$data = ['id' => 1, 'title' => 'Hello', 'tags' => ['a', 'b'], 'meta' => ['score' => 4.5, 'draft' => false, 'author' => null]];
+$helper->assert('Round trip keeps data', $data === V8\Value::fromPhp($context, $data)->toPhp($context));
+
+?>
+--EXPECT--
+Primitives:
+-----------
+undefined: NULL
+null: NULL
+true: bool(true)
+int: int(42)
+negative int: int(-42)
+uint32: int(4294967295)
+integral double: int(1099511627776)
+double: float(4.2)
+NaN: float(NAN)
+string: string(11) "ünïcödé"
+
+
+Arrays and objects:
+-------------------
+Array: ok
+Array with holes: ok
+Object: ok
+Object with index keys: ok
+Non-enumerable properties are skipped: ok
+Inherited properties are skipped: ok
+Getters are invoked: ok
+Shared objects are not cycles: ok
+Value is instance of V8\FunctionObject
+Value is instance of V8\DateObject
+Value is instance of V8\SymbolValue
+
+
+Errors:
+-------
+V8\Exceptions\ValueException: Unable to convert circular structure
+V8\Exceptions\ValueException: Maximum nesting depth of 2 exceeded
+V8\Exceptions\TryCatchException: Error: getter failed
+
+
+Round trip:
+-----------
+Round trip keeps data: ok
@@ -18,6 +18,7 @@
 #include "php_v8_a.h"
 
 #include "php_v8_isolate.h"
+#include "php_v8_isolate_pool.h"
 #include "php_v8_startup_data.h"
 #include "php_v8_heap_statistics.h"
 #include "php_v8_exceptions.h"
@@ -34,6 +35,7 @@
 #include "php_v8_script.h"
 #include "php_v8_unbound_script.h"
 #include "php_v8_cached_data.h"
+#include "php_v8_code_cache.h"
 #include "php_v8_source.h"
 #include "php_v8_script_compiler.h"
 #include "php_v8_undefined.h"
@@ -54,12 +56,17 @@
 #include "php_v8_date.h"
 #include "php_v8_regexp.h"
 #include "php_v8_proxy.h"
+#include "php_v8_array_buffer.h"
+#include "php_v8_array_buffer_view.h"
+#include "php_v8_typed_array.h"
+#include "php_v8_data_view.h"
 #include "php_v8_promise_resolver.h"
 #include "php_v8_promise.h"
 #include "php_v8_number_object.h"
 #include "php_v8_boolean_object.h"
 #include "php_v8_string_object.h"
 #include "php_v8_symbol_object.h"
+#include "php_v8_prepared_call.h"
 #include "php_v8_object.h"
 #include "php_v8_template.h"
 #include "php_v8_return_value.h"
@@ -69,6 +76,8 @@
 #include "php_v8_named_property_handler_configuration.h"
 #include "php_v8_indexed_property_handler_configuration.h"
 #include "php_v8_json.h"
+#include "php_v8_serializer.h"
+#include "php_v8_deserializer.h"
 
 #include "php_v8_value.h"
 #include "php_v8_data.h"
@@ -112,6 +121,7 @@ PHP_MINIT_FUNCTION(v8)
     PHP_MINIT(php_v8_heap_statistics)(INIT_FUNC_ARGS_PASSTHRU);
     PHP_MINIT(php_v8_startup_data)(INIT_FUNC_ARGS_PASSTHRU);
     PHP_MINIT(php_v8_isolate)(INIT_FUNC_ARGS_PASSTHRU);
+    PHP_MINIT(php_v8_isolate_pool)(INIT_FUNC_ARGS_PASSTHRU);
     PHP_MINIT(php_v8_context)(INIT_FUNC_ARGS_PASSTHRU);
 
     PHP_MINIT(php_v8_script)(INIT_FUNC_ARGS_PASSTHRU);
@@ -119,6 +129,7 @@ PHP_MINIT_FUNCTION(v8)
     PHP_MINIT(php_v8_cached_data)(INIT_FUNC_ARGS_PASSTHRU);
     PHP_MINIT(php_v8_source)(INIT_FUNC_ARGS_PASSTHRU);
     PHP_MINIT(php_v8_script_compiler)(INIT_FUNC_ARGS_PASSTHRU);
+    PHP_MINIT(php_v8_code_cache)(INIT_FUNC_ARGS_PASSTHRU);
 
     PHP_MINIT(php_v8_exception_manger)(INIT_FUNC_ARGS_PASSTHRU);
     PHP_MINIT(php_v8_try_catch)(INIT_FUNC_ARGS_PASSTHRU);
@@ -152,12 +163,18 @@ PHP_MINIT_FUNCTION(v8)
     PHP_MINIT(php_v8_promise)(INIT_FUNC_ARGS_PASSTHRU);
     PHP_MINIT(php_v8_promise_resolver)(INIT_FUNC_ARGS_PASSTHRU);
     PHP_MINIT(php_v8_proxy)(INIT_FUNC_ARGS_PASSTHRU);
+    PHP_MINIT(php_v8_array_buffer)(INIT_FUNC_ARGS_PASSTHRU);
+    PHP_MINIT(php_v8_array_buffer_view)(INIT_FUNC_ARGS_PASSTHRU);
+    PHP_MINIT(php_v8_typed_array)(INIT_FUNC_ARGS_PASSTHRU); /* TypedArrayObject inherits ArrayBufferViewObject */
+    PHP_MINIT(php_v8_data_view)(INIT_FUNC_ARGS_PASSTHRU);   /* DataViewObject inherits ArrayBufferViewObject */
 
     PHP_MINIT(php_v8_number_object)(INIT_FUNC_ARGS_PASSTHRU);
     PHP_MINIT(php_v8_boolean_object)(INIT_FUNC_ARGS_PASSTHRU);
     PHP_MINIT(php_v8_string_object)(INIT_FUNC_ARGS_PASSTHRU);
     PHP_MINIT(php_v8_symbol_object)(INIT_FUNC_ARGS_PASSTHRU);
 
+    PHP_MINIT(php_v8_prepared_call)(INIT_FUNC_ARGS_PASSTHRU);
+
     PHP_MINIT(php_v8_template)(INIT_FUNC_ARGS_PASSTHRU);
     PHP_MINIT(php_v8_object_template)(INIT_FUNC_ARGS_PASSTHRU);
     PHP_MINIT(php_v8_function_template)(INIT_FUNC_ARGS_PASSTHRU);
@@ -173,6 +190,8 @@ PHP_MINIT_FUNCTION(v8)
     PHP_MINIT(php_v8_indexed_property_handler_configuration)(INIT_FUNC_ARGS_PASSTHRU);
 
     PHP_MINIT(php_v8_json)(INIT_FUNC_ARGS_PASSTHRU);
+    PHP_MINIT(php_v8_serializer)(INIT_FUNC_ARGS_PASSTHRU);
+    PHP_MINIT(php_v8_deserializer)(INIT_FUNC_ARGS_PASSTHRU);
 
     /* If you have INI entries, uncomment these lines
     REGISTER_INI_ENTRIES();
@@ -189,6 +208,10 @@ PHP_MSHUTDOWN_FUNCTION(v8)
     /* uncomment this line if you have INI entries
     UNREGISTER_INI_ENTRIES();
     */
+    php_v8_isolate_limits_shutdown();
+    php_v8_isolate_pool_shutdown();
+    php_v8_startup_data_shutdown();
+    php_v8_cached_data_shutdown();
     php_v8_shutdown();
     return SUCCESS;
 }
@@ -208,6 +231,8 @@ PHP_RINIT_FUNCTION(v8)
  */
 PHP_RSHUTDOWN_FUNCTION(v8)
 {
+    php_v8_code_cache_request_shutdown();
+
     return SUCCESS;
 }
 /* }}} */
@@ -244,6 +269,10 @@ static PHP_GINIT_FUNCTION(v8)
 #endif
     v8_globals->v8_initialized = false;
     v8_globals->platform = nullptr;
+    v8_globals->isolate_pools = nullptr;
+    v8_globals->persistent_startup_data = nullptr;
+    v8_globals->persistent_cached_data = nullptr;
+    ZVAL_UNDEF(&v8_globals->code_cache_store);
 }
 /* }}} */
 